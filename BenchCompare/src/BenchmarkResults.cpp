@@ -0,0 +1,122 @@
+#include "BenchmarkResults.h"
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
+#include <filesystem>
+
+namespace DemoEngine::Bench
+{
+	static double GetUnitToNanoseconds(const std::string& unit)
+	{
+		if (unit == "us") return 1e3;
+		if (unit == "ms") return 1e6;
+		if (unit == "s") return 1e9;
+		return 1.0;
+	}
+
+	BenchmarkSamples* BenchmarkRun::Find(const std::string& name)
+	{
+		for (BenchmarkSamples& samples : Benchmarks)
+		{
+			if (samples.Name == name)
+				return &samples;
+		}
+		return nullptr;
+	}
+
+	const BenchmarkSamples* BenchmarkRun::Find(const std::string& name) const
+	{
+		return const_cast<BenchmarkRun*>(this)->Find(name);
+	}
+
+	std::string BenchmarkRun::GetLabel() const
+	{
+		for (const auto& [key, value] : Context)
+		{
+			if (key == "commit")
+				return value;
+		}
+		return Date.empty() ? std::filesystem::path(Path).stem().string() : Date;
+	}
+
+	bool LoadBenchmarkRun(const std::string& path, BenchmarkRun& run, std::string& error)
+	{
+		// JSON is a subset of YAML, so the parser the engine already ships reads these files
+		YAML::Node root;
+		try { root = YAML::LoadFile(path); }
+		catch (const YAML::Exception& e)
+		{
+			error = e.what();
+			return false;
+		}
+
+		if (!root["benchmarks"] || !root["benchmarks"].IsSequence())
+		{
+			error = "no \"benchmarks\" array";
+			return false;
+		}
+
+		run = {};
+		run.Path = path;
+		if (const YAML::Node context = root["context"])
+		{
+			for (const auto& entry : context)
+			{
+				if (entry.second.IsScalar())
+					run.Context.emplace_back(entry.first.as<std::string>(), entry.second.as<std::string>());
+			}
+			if (context["date"])
+				run.Date = context["date"].as<std::string>();
+		}
+
+		for (const YAML::Node& benchmark : root["benchmarks"])
+		{
+			// Aggregates are recomputed from the repetitions
+			if (benchmark["run_type"] && benchmark["run_type"].as<std::string>() == "aggregate")
+				continue;
+
+			std::string name = benchmark["run_name"] ? benchmark["run_name"].as<std::string>() : benchmark["name"].as<std::string>();
+			BenchmarkSamples* samples = run.Find(name);
+			if (!samples)
+			{
+				samples = &run.Benchmarks.emplace_back();
+				samples->Name = name;
+			}
+
+			if (benchmark["error_occurred"] && benchmark["error_occurred"].as<bool>())
+			{
+				samples->Error = benchmark["error_message"] ? benchmark["error_message"].as<std::string>() : "error";
+				continue;
+			}
+
+			double scale = GetUnitToNanoseconds(benchmark["time_unit"] ? benchmark["time_unit"].as<std::string>() : "ns");
+			samples->RealTime.push_back(benchmark["real_time"].as<double>() * scale);
+			samples->CPUTime.push_back(benchmark["cpu_time"].as<double>() * scale);
+		}
+
+		return true;
+	}
+
+	std::vector<BenchmarkRun> LoadBenchmarkHistory(const std::string& directory)
+	{
+		std::vector<BenchmarkRun> history;
+
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+		{
+			if (entry.path().extension() != ".json")
+				continue;
+
+			BenchmarkRun run;
+			std::string error;
+			if (LoadBenchmarkRun(entry.path().string(), run, error))
+				history.push_back(std::move(run));
+		}
+
+		// ISO dates sort chronologically as text
+		std::sort(history.begin(), history.end(), [](const BenchmarkRun& a, const BenchmarkRun& b)
+		{
+			return a.Date != b.Date ? a.Date < b.Date : a.Path < b.Path;
+		});
+		return history;
+	}
+}
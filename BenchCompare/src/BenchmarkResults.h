@@ -0,0 +1,36 @@
+#pragma once
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace DemoEngine::Bench
+{
+	// Every repetition of one benchmark, normalised to nanoseconds per iteration
+	struct BenchmarkSamples
+	{
+		std::string Name;
+		std::vector<double> RealTime;
+		std::vector<double> CPUTime;
+		std::string Error;
+
+		const std::vector<double>& Get(bool cpuTime) const { return cpuTime ? CPUTime : RealTime; }
+	};
+
+	// One DemoEngineBench JSON file (google-benchmark's format)
+	struct BenchmarkRun
+	{
+		std::string Path;
+		std::string Date;
+		std::vector<std::pair<std::string, std::string>> Context;
+		std::vector<BenchmarkSamples> Benchmarks; // In file order
+
+		BenchmarkSamples* Find(const std::string& name);
+		const BenchmarkSamples* Find(const std::string& name) const;
+		std::string GetLabel() const; // Commit from --benchmark_context, else the date
+	};
+
+	bool LoadBenchmarkRun(const std::string& path, BenchmarkRun& run, std::string& error);
+
+	// Every *.json under directory that loads, oldest first
+	std::vector<BenchmarkRun> LoadBenchmarkHistory(const std::string& directory);
+}
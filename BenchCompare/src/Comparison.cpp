@@ -0,0 +1,124 @@
+#include "Comparison.h"
+#include <cmath>
+
+namespace DemoEngine::Bench
+{
+	const char* VerdictToString(Verdict verdict)
+	{
+		switch (verdict)
+		{
+			case Verdict::Same: return "same";
+			case Verdict::Improved: return "improved";
+			case Verdict::Regressed: return "REGRESSED";
+			case Verdict::Unsure: return "unsure";
+			case Verdict::Added: return "added";
+			case Verdict::Removed: return "removed";
+			case Verdict::Failed: return "FAILED";
+		}
+		return "?";
+	}
+
+	static double GetThreshold(const std::string& name, const ComparisonOptions& options)
+	{
+		for (const auto& [pattern, threshold] : options.Thresholds)
+		{
+			if (std::regex_search(name, pattern))
+				return threshold;
+		}
+		return options.Threshold;
+	}
+
+	static BenchmarkComparison Compare(const BenchmarkSamples& baseline, const BenchmarkSamples& contender, const ComparisonOptions& options)
+	{
+		BenchmarkComparison comparison;
+		comparison.Name = baseline.Name;
+		comparison.Threshold = GetThreshold(baseline.Name, options);
+
+		if (!baseline.Error.empty() || !contender.Error.empty())
+		{
+			comparison.Result = Verdict::Failed;
+			comparison.Error = !contender.Error.empty() ? contender.Error : baseline.Error;
+			return comparison;
+		}
+
+		const std::vector<double>& before = baseline.Get(options.UseCPUTime);
+		const std::vector<double>& after = contender.Get(options.UseCPUTime);
+		comparison.BaselineCount = before.size();
+		comparison.ContenderCount = after.size();
+		if (before.empty() || after.empty())
+		{
+			comparison.Result = Verdict::Failed;
+			comparison.Error = "no samples";
+			return comparison;
+		}
+
+		comparison.BaselineMedian = Median(before);
+		comparison.ContenderMedian = Median(after);
+		if (comparison.BaselineMedian > 0.0)
+			comparison.BaselineNoise = MedianAbsoluteDeviation(before) / comparison.BaselineMedian;
+		if (comparison.ContenderMedian > 0.0)
+			comparison.ContenderNoise = MedianAbsoluteDeviation(after) / comparison.ContenderMedian;
+
+		// Below the timer's resolution there is no relative change to speak of
+		if (comparison.BaselineMedian <= 0.0)
+		{
+			comparison.Result = comparison.ContenderMedian <= 0.0 ? Verdict::Same : Verdict::Unsure;
+			if (comparison.Result == Verdict::Unsure)
+				comparison.Error = "baseline median is zero";
+			return comparison;
+		}
+
+		comparison.Change = comparison.ContenderMedian / comparison.BaselineMedian - 1.0;
+
+		// A single repetition says nothing about noise, so it can't carry a verdict either way
+		bool significant = false;
+		if (before.size() >= 2 && after.size() >= 2)
+		{
+			comparison.ChangeInterval = BootstrapRelativeChange(before, after, options.Confidence);
+			comparison.HasInterval = !std::isnan(comparison.ChangeInterval.Low);
+			significant = comparison.HasInterval && (comparison.ChangeInterval.Low > 0.0 || comparison.ChangeInterval.High < 0.0);
+		}
+
+		if (std::abs(comparison.Change) <= comparison.Threshold)
+			comparison.Result = Verdict::Same;
+		else if (!significant)
+		{
+			comparison.Result = Verdict::Unsure;
+			if (!comparison.HasInterval)
+				comparison.Error = "too few repetitions";
+		}
+		else
+			comparison.Result = comparison.Change > 0.0 ? Verdict::Regressed : Verdict::Improved;
+
+		return comparison;
+	}
+
+	std::vector<BenchmarkComparison> CompareRuns(const BenchmarkRun& baseline, const BenchmarkRun& contender, const ComparisonOptions& options)
+	{
+		std::vector<BenchmarkComparison> comparisons;
+
+		for (const BenchmarkSamples& before : baseline.Benchmarks)
+		{
+			if (const BenchmarkSamples* after = contender.Find(before.Name))
+				comparisons.push_back(Compare(before, *after, options));
+			else
+			{
+				BenchmarkComparison& removed = comparisons.emplace_back();
+				removed.Name = before.Name;
+				removed.Result = Verdict::Removed;
+			}
+		}
+
+		for (const BenchmarkSamples& after : contender.Benchmarks)
+		{
+			if (!baseline.Find(after.Name))
+			{
+				BenchmarkComparison& added = comparisons.emplace_back();
+				added.Name = after.Name;
+				added.Result = Verdict::Added;
+			}
+		}
+
+		return comparisons;
+	}
+}
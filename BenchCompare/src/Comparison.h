@@ -0,0 +1,48 @@
+#pragma once
+#include "BenchmarkResults.h"
+#include "Statistics.h"
+#include <regex>
+
+namespace DemoEngine::Bench
+{
+	enum class Verdict
+	{
+		Same = 0,
+		Improved,
+		Regressed,
+		Unsure, // Past the threshold, but without repetitions or with an interval that includes no change
+		Added, // Only in the contender
+		Removed, // Only in the baseline
+		Failed // Errored in either run
+	};
+
+	const char* VerdictToString(Verdict verdict);
+
+	struct ComparisonOptions
+	{
+		bool UseCPUTime = false;
+		double Threshold = 0.05; // Relative change of the medians
+		std::vector<std::pair<std::regex, double>> Thresholds; // Per-benchmark overrides, first match wins
+		double Confidence = 0.95;
+	};
+
+	struct BenchmarkComparison
+	{
+		std::string Name;
+		Verdict Result = Verdict::Same;
+		std::string Error;
+
+		double BaselineMedian = 0.0, ContenderMedian = 0.0; // Nanoseconds
+		double BaselineNoise = 0.0, ContenderNoise = 0.0; // MAD relative to the median
+		size_t BaselineCount = 0, ContenderCount = 0;
+
+		double Change = 0.0; // Contender over baseline, minus one
+		Interval ChangeInterval;
+		bool HasInterval = false;
+		double Threshold = 0.0;
+	};
+
+	// A benchmark regresses when its median slows by more than its threshold and the
+	// bootstrapped interval excludes zero, which needs two or more repetitions on each side
+	std::vector<BenchmarkComparison> CompareRuns(const BenchmarkRun& baseline, const BenchmarkRun& contender, const ComparisonOptions& options);
+}
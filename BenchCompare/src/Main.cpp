@@ -0,0 +1,130 @@
+#include "BenchmarkResults.h"
+#include "Comparison.h"
+#include "Report.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+using namespace DemoEngine::Bench;
+
+static void PrintUsage()
+{
+	printf(
+		"Compares two DemoEngineBench result files and fails when a benchmark regressed.\n\n"
+		"BenchCompare <baseline.json> <contender.json> [options]\n"
+		"  --metric real|cpu            Time to compare (default real)\n"
+		"  --threshold <percent>        Allowed slowdown of the median (default 5)\n"
+		"  --threshold-for <regex>=<percent>  Override for matching benchmarks, e.g. BM_Scene.*=10\n"
+		"  --confidence <percent>       Bootstrap interval (default 95)\n"
+		"  --history <directory>        Stored result files to chart trends from, e.g. Benchmarks\n"
+		"  --markdown <path>            Write a markdown report\n"
+		"  --html <path>                Write an HTML report\n\n"
+		"Run the benchmarks with --benchmark_repetitions=5 or more, so noise can be told apart\n"
+		"from real changes. Exit code: 0 pass, 1 regression or failure, 2 bad input.\n");
+}
+
+static bool IsSameFile(const std::string& a, const std::string& b)
+{
+	std::error_code ec;
+	return std::filesystem::equivalent(a, b, ec);
+}
+
+int main(int argc, char** argv)
+{
+	std::vector<std::string> inputs;
+	ComparisonOptions options;
+	std::string historyDirectory, markdownPath, htmlPath;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (arg == "--help" || arg == "-h")
+		{
+			PrintUsage();
+			return 0;
+		}
+		else if (arg == "--metric" && hasValue)
+			options.UseCPUTime = std::string(argv[++i]) == "cpu";
+		else if (arg == "--threshold" && hasValue)
+			options.Threshold = std::atof(argv[++i]) / 100.0;
+		else if (arg == "--threshold-for" && hasValue)
+		{
+			std::string value = argv[++i];
+			size_t separator = value.rfind('=');
+			if (separator == std::string::npos)
+			{
+				fprintf(stderr, "Expected <regex>=<percent>, got '%s'\n", value.c_str());
+				return 2;
+			}
+
+			try { options.Thresholds.emplace_back(std::regex(value.substr(0, separator)), std::atof(value.c_str() + separator + 1) / 100.0); }
+			catch (const std::regex_error&)
+			{
+				fprintf(stderr, "Invalid regex in '%s'\n", value.c_str());
+				return 2;
+			}
+		}
+		else if (arg == "--confidence" && hasValue)
+			options.Confidence = std::atof(argv[++i]) / 100.0;
+		else if (arg == "--history" && hasValue)
+			historyDirectory = argv[++i];
+		else if (arg == "--markdown" && hasValue)
+			markdownPath = argv[++i];
+		else if (arg == "--html" && hasValue)
+			htmlPath = argv[++i];
+		else if (arg.compare(0, 2, "--") != 0)
+			inputs.push_back(arg);
+		else
+		{
+			fprintf(stderr, "Unknown option '%s'\n", arg.c_str());
+			return 2;
+		}
+	}
+
+	if (inputs.size() != 2)
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	BenchmarkRun baseline, contender;
+	std::string error;
+	if (!LoadBenchmarkRun(inputs[0], baseline, error) || !LoadBenchmarkRun(inputs[1], contender, error))
+	{
+		fprintf(stderr, "Could not read benchmark results: %s\n", error.c_str());
+		return 2;
+	}
+
+	std::vector<BenchmarkRun> history;
+	if (!historyDirectory.empty())
+		history = LoadBenchmarkHistory(historyDirectory);
+
+	Report report;
+	report.Baseline = &baseline;
+	report.Contender = &contender;
+	report.Comparisons = CompareRuns(baseline, contender, options);
+	report.UseCPUTime = options.UseCPUTime;
+	report.Confidence = options.Confidence;
+
+	// The history charts end on the contender; both inputs stand in for their copies in the directory
+	for (const BenchmarkRun& run : history)
+	{
+		if (!IsSameFile(run.Path, baseline.Path) && !IsSameFile(run.Path, contender.Path))
+			report.History.push_back(&run);
+	}
+	report.History.push_back(&baseline);
+	std::stable_sort(report.History.begin(), report.History.end(), [](const BenchmarkRun* a, const BenchmarkRun* b) { return a->Date < b->Date; });
+	report.History.push_back(&contender);
+
+	PrintReport(report);
+
+	if (!markdownPath.empty() && !WriteMarkdownReport(markdownPath, report))
+		fprintf(stderr, "Could not write '%s'\n", markdownPath.c_str());
+	if (!htmlPath.empty() && !WriteHtmlReport(htmlPath, report))
+		fprintf(stderr, "Could not write '%s'\n", htmlPath.c_str());
+
+	return report.Count(Verdict::Regressed) || report.Count(Verdict::Failed) ? 1 : 0;
+}
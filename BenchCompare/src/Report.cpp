@@ -0,0 +1,308 @@
+#include "Report.h"
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace DemoEngine::Bench
+{
+	size_t Report::Count(Verdict verdict) const
+	{
+		size_t count = 0;
+		for (const BenchmarkComparison& comparison : Comparisons)
+			count += comparison.Result == verdict ? 1 : 0;
+		return count;
+	}
+
+	static std::string FormatTime(double nanoseconds)
+	{
+		char text[32];
+		if (nanoseconds >= 1e9)
+			snprintf(text, sizeof(text), "%.3g s", nanoseconds * 1e-9);
+		else if (nanoseconds >= 1e6)
+			snprintf(text, sizeof(text), "%.3g ms", nanoseconds * 1e-6);
+		else if (nanoseconds >= 1e3)
+			snprintf(text, sizeof(text), "%.3g us", nanoseconds * 1e-3);
+		else
+			snprintf(text, sizeof(text), "%.3g ns", nanoseconds);
+		return text;
+	}
+
+	static std::string FormatPercent(double fraction, bool sign = true)
+	{
+		char text[32];
+		snprintf(text, sizeof(text), sign ? "%+.1f%%" : "%.1f%%", fraction * 100.0);
+		return text;
+	}
+
+	static std::string FormatInterval(const BenchmarkComparison& comparison)
+	{
+		if (!comparison.HasInterval)
+			return "n/a";
+		return "[" + FormatPercent(comparison.ChangeInterval.Low) + ", " + FormatPercent(comparison.ChangeInterval.High) + "]";
+	}
+
+	static bool HasTimes(const BenchmarkComparison& comparison)
+	{
+		return comparison.BaselineCount && comparison.ContenderCount;
+	}
+
+	// Median per run in History; NAN where the benchmark is missing or failed
+	static std::vector<double> GetTrend(const Report& report, const std::string& name)
+	{
+		std::vector<double> trend;
+		for (const BenchmarkRun* run : report.History)
+		{
+			const BenchmarkSamples* samples = run->Find(name);
+			trend.push_back(samples && samples->Error.empty() ? Median(samples->Get(report.UseCPUTime)) : NAN);
+		}
+		return trend;
+	}
+
+	static bool GetRange(const std::vector<double>& values, double& low, double& high)
+	{
+		low = INFINITY;
+		high = -INFINITY;
+		for (double value : values)
+		{
+			if (std::isnan(value))
+				continue;
+			low = std::min(low, value);
+			high = std::max(high, value);
+		}
+		return low <= high;
+	}
+
+	static std::string MakeSparkline(const std::vector<double>& values)
+	{
+		static const char* s_Blocks[] = { "\xE2\x96\x81", "\xE2\x96\x82", "\xE2\x96\x83", "\xE2\x96\x84", "\xE2\x96\x85", "\xE2\x96\x86", "\xE2\x96\x87", "\xE2\x96\x88" };
+
+		double low, high;
+		if (!GetRange(values, low, high))
+			return "";
+
+		std::string line;
+		for (double value : values)
+		{
+			if (std::isnan(value))
+			{
+				line += " ";
+				continue;
+			}
+			int level = high > low ? (int)std::lround((value - low) / (high - low) * 7.0) : 3;
+			line += s_Blocks[level];
+		}
+		return line;
+	}
+
+	static std::string EscapeHtml(const std::string& text)
+	{
+		std::string escaped;
+		for (char c : text)
+		{
+			switch (c)
+			{
+				case '<': escaped += "&lt;"; break;
+				case '>': escaped += "&gt;"; break;
+				case '&': escaped += "&amp;"; break;
+				case '"': escaped += "&quot;"; break;
+				default: escaped += c; break;
+			}
+		}
+		return escaped;
+	}
+
+	static std::string MakeChart(const Report& report, const std::vector<double>& values, Verdict verdict)
+	{
+		constexpr float width = 360.0f, height = 90.0f, left = 58.0f, right = 8.0f, top = 8.0f, bottom = 8.0f;
+
+		double low, high;
+		if (!GetRange(values, low, high))
+			return "";
+		if (high - low < high * 1e-6)
+		{
+			low *= 0.95;
+			high *= 1.05;
+		}
+
+		auto x = [&](size_t i) { return values.size() > 1 ? left + (width - left - right) * i / (values.size() - 1) : (left + width) * 0.5f; };
+		auto y = [&](double value) { return (float)(top + (height - top - bottom) * (1.0 - (value - low) / (high - low))); };
+
+		std::stringstream svg;
+		svg << "<svg width=\"" << width << "\" height=\"" << height << "\" viewBox=\"0 0 " << width << ' ' << height << "\">";
+		svg << "<line x1=\"" << left << "\" y1=\"" << top << "\" x2=\"" << left << "\" y2=\"" << height - bottom << "\" class=\"axis\"/>";
+		svg << "<text x=\"" << left - 4 << "\" y=\"" << top + 8 << "\" class=\"label\">" << FormatTime(high) << "</text>";
+		svg << "<text x=\"" << left - 4 << "\" y=\"" << height - bottom << "\" class=\"label\">" << FormatTime(low) << "</text>";
+
+		// Gaps where the benchmark is missing split the line
+		svg << "<path class=\"trend\" d=\"";
+		bool penDown = false;
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			if (std::isnan(values[i]))
+			{
+				penDown = false;
+				continue;
+			}
+			svg << (penDown ? " L" : " M") << x(i) << ' ' << y(values[i]);
+			penDown = true;
+		}
+		svg << "\"/>";
+
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			if (std::isnan(values[i]))
+				continue;
+
+			const BenchmarkRun* run = report.History[i];
+			const char* type = run == report.Contender ? (verdict == Verdict::Regressed ? "point regressed" : "point contender")
+				: run == report.Baseline ? "point baseline" : "point";
+			svg << "<circle cx=\"" << x(i) << "\" cy=\"" << y(values[i]) << "\" r=\"3\" class=\"" << type << "\">";
+			svg << "<title>" << EscapeHtml(run->GetLabel()) << ": " << FormatTime(values[i]) << "</title></circle>";
+		}
+
+		svg << "</svg>";
+		return svg.str();
+	}
+
+	void PrintReport(const Report& report)
+	{
+		printf("%-48s %12s %12s %9s %22s %7s  %s\n", "Benchmark", "Baseline", "Contender", "Change", "CI", "Noise", "Verdict");
+		printf("%s\n", std::string(124, '-').c_str());
+
+		for (const BenchmarkComparison& comparison : report.Comparisons)
+		{
+			if (!HasTimes(comparison))
+			{
+				printf("%-48s %12s %12s %9s %22s %7s  %s %s\n", comparison.Name.c_str(), "", "", "", "", "",
+					VerdictToString(comparison.Result), comparison.Error.c_str());
+				continue;
+			}
+
+			printf("%-48s %12s %12s %9s %22s %7s  %s %s\n", comparison.Name.c_str(),
+				FormatTime(comparison.BaselineMedian).c_str(), FormatTime(comparison.ContenderMedian).c_str(),
+				FormatPercent(comparison.Change).c_str(), FormatInterval(comparison).c_str(),
+				FormatPercent(std::max(comparison.BaselineNoise, comparison.ContenderNoise), false).c_str(),
+				VerdictToString(comparison.Result), comparison.Error.c_str());
+		}
+
+		printf("\n%zu regressed, %zu improved, %zu unsure, %zu failed, %zu unchanged\n",
+			report.Count(Verdict::Regressed), report.Count(Verdict::Improved), report.Count(Verdict::Unsure),
+			report.Count(Verdict::Failed), report.Count(Verdict::Same));
+	}
+
+	static bool OpenReport(const std::string& path, std::ofstream& out)
+	{
+		std::filesystem::path filePath(path);
+		if (filePath.has_parent_path())
+			std::filesystem::create_directories(filePath.parent_path());
+
+		out.open(path, std::ios::trunc);
+		return out.is_open();
+	}
+
+	bool WriteMarkdownReport(const std::string& path, const Report& report)
+	{
+		std::ofstream out;
+		if (!OpenReport(path, out))
+			return false;
+
+		out << "# Benchmark comparison\n\n";
+		out << "- Baseline: `" << report.Baseline->Path << "` (" << report.Baseline->GetLabel() << ")\n";
+		out << "- Contender: `" << report.Contender->Path << "` (" << report.Contender->GetLabel() << ")\n";
+		out << "- Metric: median " << (report.UseCPUTime ? "CPU" : "real") << " time, " << (int)std::lround(report.Confidence * 100.0)
+			<< "% bootstrap interval, noise as MAD over median\n";
+		out << "- History: " << report.History.size() << " runs\n\n";
+
+		out << "**" << report.Count(Verdict::Regressed) << " regressed**, " << report.Count(Verdict::Improved) << " improved, "
+			<< report.Count(Verdict::Unsure) << " unsure, " << report.Count(Verdict::Failed) << " failed, "
+			<< report.Count(Verdict::Same) << " unchanged\n\n";
+
+		out << "| Benchmark | Baseline | Contender | Change | CI | Noise | Threshold | Verdict | Trend |\n";
+		out << "|---|---:|---:|---:|---|---:|---:|---|---|\n";
+		for (const BenchmarkComparison& comparison : report.Comparisons)
+		{
+			out << "| `" << comparison.Name << "` | ";
+			if (HasTimes(comparison))
+			{
+				out << FormatTime(comparison.BaselineMedian) << " | " << FormatTime(comparison.ContenderMedian) << " | "
+					<< FormatPercent(comparison.Change) << " | " << FormatInterval(comparison) << " | "
+					<< FormatPercent(std::max(comparison.BaselineNoise, comparison.ContenderNoise), false) << " | "
+					<< FormatPercent(comparison.Threshold, false) << " | ";
+			}
+			else
+				out << " | | | | | | ";
+
+			std::string verdict = VerdictToString(comparison.Result);
+			if (comparison.Result == Verdict::Regressed || comparison.Result == Verdict::Failed)
+				verdict = "**" + verdict + "**";
+			if (!comparison.Error.empty())
+				verdict += " (" + comparison.Error + ")";
+
+			out << verdict << " | " << MakeSparkline(GetTrend(report, comparison.Name)) << " |\n";
+		}
+
+		return out.good();
+	}
+
+	bool WriteHtmlReport(const std::string& path, const Report& report)
+	{
+		std::ofstream out;
+		if (!OpenReport(path, out))
+			return false;
+
+		out << "<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>Benchmark comparison</title>\n<style>\n"
+			"body { font-family: sans-serif; margin: 24px; color: #222; }\n"
+			"table { border-collapse: collapse; }\n"
+			"th, td { padding: 4px 10px; border-bottom: 1px solid #ddd; text-align: right; vertical-align: middle; }\n"
+			"th:first-child, td:first-child { text-align: left; font-family: monospace; }\n"
+			"tr.regressed, tr.failed { background: #fde2e2; }\n"
+			"tr.improved { background: #e2f5e2; }\n"
+			"tr.unsure { background: #fff6d6; }\n"
+			".axis { stroke: #aaa; }\n"
+			".label { font-size: 10px; fill: #666; text-anchor: end; }\n"
+			".trend { fill: none; stroke: #4a7ebb; stroke-width: 1.5; }\n"
+			".point { fill: #4a7ebb; }\n"
+			".point.baseline { fill: #333; }\n"
+			".point.contender { fill: #2e9e4f; }\n"
+			".point.regressed { fill: #d33; }\n"
+			"</style></head><body>\n";
+
+		out << "<h1>Benchmark comparison</h1>\n<p>Baseline <code>" << EscapeHtml(report.Baseline->Path) << "</code> ("
+			<< EscapeHtml(report.Baseline->GetLabel()) << ")<br>Contender <code>" << EscapeHtml(report.Contender->Path) << "</code> ("
+			<< EscapeHtml(report.Contender->GetLabel()) << ")<br>Median " << (report.UseCPUTime ? "CPU" : "real") << " time, "
+			<< (int)std::lround(report.Confidence * 100.0) << "% bootstrap interval, noise as MAD over median, "
+			<< report.History.size() << " runs of history</p>\n";
+
+		out << "<p><b>" << report.Count(Verdict::Regressed) << " regressed</b>, " << report.Count(Verdict::Improved) << " improved, "
+			<< report.Count(Verdict::Unsure) << " unsure, " << report.Count(Verdict::Failed) << " failed, "
+			<< report.Count(Verdict::Same) << " unchanged</p>\n";
+
+		out << "<table>\n<tr><th>Benchmark</th><th>Baseline</th><th>Contender</th><th>Change</th><th>CI</th><th>Noise</th>"
+			"<th>Threshold</th><th>Verdict</th><th>History</th></tr>\n";
+		for (const BenchmarkComparison& comparison : report.Comparisons)
+		{
+			std::string verdict = VerdictToString(comparison.Result);
+			std::string rowClass = comparison.Result == Verdict::Regressed ? "regressed" : comparison.Result == Verdict::Failed ? "failed" : verdict;
+
+			out << "<tr class=\"" << rowClass << "\"><td>" << EscapeHtml(comparison.Name) << "</td>";
+			if (HasTimes(comparison))
+			{
+				out << "<td>" << FormatTime(comparison.BaselineMedian) << "</td><td>" << FormatTime(comparison.ContenderMedian) << "</td>"
+					<< "<td>" << FormatPercent(comparison.Change) << "</td><td>" << FormatInterval(comparison) << "</td>"
+					<< "<td>" << FormatPercent(std::max(comparison.BaselineNoise, comparison.ContenderNoise), false) << "</td>"
+					<< "<td>" << FormatPercent(comparison.Threshold, false) << "</td>";
+			}
+			else
+				out << "<td></td><td></td><td></td><td></td><td></td><td></td>";
+
+			if (!comparison.Error.empty())
+				verdict += " (" + comparison.Error + ")";
+			out << "<td>" << EscapeHtml(verdict) << "</td><td>" << MakeChart(report, GetTrend(report, comparison.Name), comparison.Result) << "</td></tr>\n";
+		}
+		out << "</table>\n</body></html>\n";
+
+		return out.good();
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "Comparison.h"
+
+namespace DemoEngine::Bench
+{
+	struct Report
+	{
+		const BenchmarkRun* Baseline = nullptr;
+		const BenchmarkRun* Contender = nullptr;
+		std::vector<BenchmarkComparison> Comparisons;
+		std::vector<const BenchmarkRun*> History; // Oldest first, baseline and contender included
+		bool UseCPUTime = false;
+		double Confidence = 0.95;
+
+		size_t Count(Verdict verdict) const;
+	};
+
+	void PrintReport(const Report& report);
+
+	// Both are self-contained (no scripts, fonts or stylesheets to fetch); the HTML
+	// draws each benchmark's history as an inline SVG chart, markdown as a sparkline
+	bool WriteMarkdownReport(const std::string& path, const Report& report);
+	bool WriteHtmlReport(const std::string& path, const Report& report);
+}
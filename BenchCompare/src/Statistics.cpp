@@ -0,0 +1,64 @@
+#include "Statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace DemoEngine::Bench
+{
+	double Median(std::vector<double> values)
+	{
+		if (values.empty())
+			return NAN;
+
+		size_t middle = values.size() / 2;
+		std::nth_element(values.begin(), values.begin() + middle, values.end());
+		if (values.size() % 2)
+			return values[middle];
+
+		double upper = values[middle];
+		double lower = *std::max_element(values.begin(), values.begin() + middle);
+		return (lower + upper) * 0.5;
+	}
+
+	double MedianAbsoluteDeviation(const std::vector<double>& values)
+	{
+		double median = Median(values);
+
+		std::vector<double> deviations;
+		deviations.reserve(values.size());
+		for (double value : values)
+			deviations.push_back(std::abs(value - median));
+
+		return 1.4826 * Median(std::move(deviations));
+	}
+
+	Interval BootstrapRelativeChange(const std::vector<double>& baseline, const std::vector<double>& contender,
+		double confidence, uint32_t resamples, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<size_t> pickBaseline(0, baseline.size() - 1);
+		std::uniform_int_distribution<size_t> pickContender(0, contender.size() - 1);
+
+		std::vector<double> changes, baselineSample(baseline.size()), contenderSample(contender.size());
+		changes.reserve(resamples);
+		for (uint32_t i = 0; i < resamples; i++)
+		{
+			for (double& value : baselineSample)
+				value = baseline[pickBaseline(random)];
+			for (double& value : contenderSample)
+				value = contender[pickContender(random)];
+
+			double baselineMedian = Median(baselineSample);
+			if (baselineMedian > 0.0)
+				changes.push_back(Median(contenderSample) / baselineMedian - 1.0);
+		}
+
+		if (changes.empty())
+			return { NAN, NAN };
+
+		std::sort(changes.begin(), changes.end());
+		double tail = (1.0 - confidence) * 0.5;
+		auto percentile = [&changes](double p) { return changes[std::min(changes.size() - 1, (size_t)(p * (changes.size() - 1) + 0.5))]; };
+		return { percentile(tail), percentile(1.0 - tail) };
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace DemoEngine::Bench
+{
+	double Median(std::vector<double> values);
+
+	// Median absolute deviation scaled by 1.4826, so it estimates the standard deviation
+	// of normal noise while ignoring the odd outlier repetition
+	double MedianAbsoluteDeviation(const std::vector<double>& values);
+
+	struct Interval
+	{
+		double Low = 0.0;
+		double High = 0.0;
+	};
+
+	// Percentile bootstrap of median(contender) / median(baseline) - 1. Seeded, so the
+	// same inputs always give the same interval. Needs two or more samples on each side.
+	Interval BootstrapRelativeChange(const std::vector<double>& baseline, const std::vector<double>& contender,
+		double confidence = 0.95, uint32_t resamples = 2000, uint32_t seed = 1);
+}
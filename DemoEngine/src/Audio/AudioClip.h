@@ -0,0 +1,16 @@
+#pragma once
+#include <soloud_wav.h>
+#include <string>
+
+namespace DemoEngine
+{
+	// Decoded sample data, shared by handle between copies of an AudioComponent
+	// so entering Play mode does not duplicate PCM buffers
+	struct AudioClip
+	{
+		SoLoud::Wav Wav;
+		std::string LoadedPath; // Path currently decoded into Wav, empty if nothing loaded
+
+		bool IsLoaded(const std::string& path) const { return !LoadedPath.empty() && LoadedPath == path; }
+	};
+}
@@ -1,33 +1,65 @@
 #include "DemoEngine_PCH.h"   
 #include "AudioEngine.h"
-#include <iostream>
+#include "Core/HeapTracker.h"
+#include <thread>
 
 namespace DemoEngine {
 
-    AudioEngine::AudioEngine() {}
+    struct AudioEngineData
+    {
+        // Static rather than owned by Init/Shutdown: clips still alive after Shutdown
+        // (e.g. in scenes torn down later) unregister from the engine when destroyed
+        SoLoud::Soloud Soloud;
 
-    AudioEngine::~AudioEngine() {
-        Shutdown();
-    }
+        std::thread InitThread;
+        bool Initialised = false;
+    };
+
+    static AudioEngineData s_Data;
 
     void AudioEngine::Init() {
-        m_Soloud.init();
-        std::cout << "[Audio] SoLoud initialized.\n";
+        CORE_ASSERT(!s_Data.Initialised, "AudioEngine already initialised");
+
+        s_Data.Initialised = true;
+        s_Data.InitThread = std::thread([]() {
+            Profiler::SetThreadName("Audio Init");
+            PROFILE_SCOPE("AudioEngine::Init");
+            MemoryTagScope memoryTag(MemoryTag::Audio);
+
+            SoLoud::result result = s_Data.Soloud.init(SoLoud::Soloud::CLIP_ROUNDOFF);
+            if (result != SoLoud::SO_NO_ERROR)
+                LOG_ERROR("[Audio] Could not open the audio device: {0}", s_Data.Soloud.getErrorString(result));
+            else
+                LOG_INFO("[Audio] SoLoud initialized ({0})", s_Data.Soloud.getBackendString());
+
+            s_Data.Soloud.setGlobalVolume(1.0f);
+        });
     }
 
     void AudioEngine::Shutdown() {
-        m_Soloud.deinit();
-        std::cout << "[Audio] SoLoud shut down.\n";
+        if (!s_Data.Initialised)
+            return;
+
+        if (s_Data.InitThread.joinable())
+            s_Data.InitThread.join();
+
+        s_Data.Soloud.deinit();
+        s_Data.Initialised = false;
+        LOG_INFO("[Audio] SoLoud shut down");
     }
 
-    void AudioEngine::PlaySound(const std::string& filepath) {
-        if (m_Wav.load(filepath.c_str()) != SoLoud::SO_NO_ERROR) {
-            std::cerr << "[Audio] Failed to load sound: " << filepath << "\n";
-            return;
-        }
+    bool AudioEngine::IsInitialised() {
+        return s_Data.Initialised;
+    }
+
+    SoLoud::Soloud& AudioEngine::Get() {
+        CORE_ASSERT(s_Data.Initialised, "AudioEngine not initialised");
 
-        m_Soloud.play(m_Wav);
-        std::cout << "[Audio] Playing sound: " << filepath << "\n";
+        if (s_Data.InitThread.joinable()) {
+            PROFILE_SCOPE("AudioEngine::WaitForDevice");
+            s_Data.InitThread.join();
+        }
+        return s_Data.Soloud;
     }
 
 }
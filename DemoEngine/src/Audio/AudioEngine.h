@@ -2,25 +2,24 @@
 
 #include <soloud.h>
 #include <soloud_wav.h>
-#include <string>
 
 namespace DemoEngine {
 
+    // Process-wide audio device. Opening the device can take hundreds of
+    // milliseconds, so Init starts it on a background thread and it stays open
+    // for the lifetime of the application instead of once per Play session.
     class AudioEngine
     {
     public:
-        AudioEngine();
-        ~AudioEngine();
+        // Returns immediately; the device opens in the background
+        static void Init();
+        // Closes the device; clips may outlive it
+        static void Shutdown();
 
-        void Init();
-        void Shutdown();
+        static bool IsInitialised();
 
-        void PlaySound(const std::string& filepath);
-
-    private:
-        SoLoud::Soloud m_Soloud;
-        SoLoud::Wav m_Wav;
+        // Waits for the device if it is still opening
+        static SoLoud::Soloud& Get();
     };
 
 }
-
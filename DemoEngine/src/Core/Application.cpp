@@ -4,26 +4,60 @@
 #include <GLFW/glfw3.h>
 
 #include "Input.h"
+#include "ThreadPool.h"
 #include "Renderer/2D/Renderer2D.h"
+#include "Renderer/RenderThread.h"
+#include "Audio/AudioEngine.h"
+#include "Scene/Scene.h"
+#include "Profiling/StartupTimeline.h"
+#include "Profiling/FlightRecorder.h"
+#include "FrameAllocator.h"
+#include "HeapTracker.h"
+#include "Utils/PlatformUtils.h"
 
 namespace DemoEngine
 {
 
 	// Macro to bind an event function to this instance of Application
-#define BIND_EVENT_FUNC(x) std::bind(&Application::x, this, std::placeholders::_1)
+#define BIND_EVENT_FUNC(x) [this](auto& e) { return x(e); }
 
 	// Static instance pointer for global access
 	Application* Application::s_Instance = nullptr;
 
+	// ImGui needs a few frames after input to settle hover states, popups and docking
+	static constexpr uint32_t s_FramesPerEvent = 3;
+
+	// Longest sleep when idle; a frame then runs anyway, picking up work nothing woke us for
+	static constexpr double s_IdleTimeout = 0.5;
+
 	// Constructor initializes the application with a window and required subsystems
 	Application::Application(const std::string& name)
 	{
 		s_Instance = this;
 
-		// Create the main window with a given name
-		m_Window = Window::Create(WindowProps(name));
-		// Set callback to handle events through the OnEvent function
-		m_Window->SetEventCallback(std::bind(&Application::OnEvent, this, std::placeholders::_1));
+		// Startup runs as a small task graph: the audio device opens on its own thread and
+		// file loads fan out to the workers, while the main thread brings up the window and GL
+
+		// Workers for scene systems and startup loads
+		ThreadPool::Init();
+
+		// Shared audio device, ready by the time a scene first plays
+		AudioEngine::Init();
+
+		// Before any scene creates a physics world
+		Scene::InitPhysicsAllocator();
+
+		{
+			PROFILE_SCOPE("Window::Create");
+
+			// Create the main window with a given name
+			m_Window = Window::Create(WindowProps(name));
+			// Set callback to handle events through the OnEvent function
+			m_Window->SetEventCallback(std::bind(&Application::OnEvent, this, std::placeholders::_1));
+		}
+
+		// Hand the graphics context to the render thread, if enabled
+		RenderThread::Init(m_Window->GetContext());
 
 		// Initialize input system
 		Input::Init();
@@ -32,6 +66,25 @@ namespace DemoEngine
 		// Initialize 2D renderer
 		Renderer2D::Init();
 
+		// Transient per-frame memory
+		FrameAllocator::Init();
+
+		// Frame stats written alongside the scopes when a hitch is dumped
+		FlightRecorder::Init();
+		FlightRecorder::AddCounter("Draw Calls", []() { return (double)Renderer2D::GetStats().DrawCalls; });
+		FlightRecorder::AddCounter("Quads", []() { return (double)Renderer2D::GetStats().QuadCount; });
+		FlightRecorder::AddCounter("Working Set (MB)", []() { return ProcessMemory::GetWorkingSet() / (1024.0 * 1024.0); });
+		FlightRecorder::AddCounter("Private Bytes (MB)", []() { return ProcessMemory::GetPrivateBytes() / (1024.0 * 1024.0); });
+		if (RenderThread::IsThreaded())
+		{
+			FlightRecorder::AddCounter("Render Thread (ms)", []() { return (double)RenderThread::GetStats().RenderTime; });
+			FlightRecorder::AddCounter("Render Wait (ms)", []() { return (double)RenderThread::GetStats().WaitTime; });
+		}
+		if (HeapTracker::IsEnabled())
+			FlightRecorder::AddCounter("Heap Allocations", []() { return (double)HeapTracker::GetLastFrameCounters().Allocations; });
+		FlightRecorder::AddCounter("Scene Memory (MB)", []() { return HeapTracker::GetTagStats(MemoryTag::Scene).LiveBytes / (1024.0 * 1024.0); });
+		FlightRecorder::AddCounter("Physics Memory (MB)", []() { return HeapTracker::GetTagStats(MemoryTag::Physics).LiveBytes / (1024.0 * 1024.0); });
+
 		// Create and add ImGui overlay
 		m_ImGuiLayer = new ImGuiLayer();
 		PushOverlay(m_ImGuiLayer);
@@ -40,7 +93,13 @@ namespace DemoEngine
 	// Destructor
 	Application::~Application()
 	{
-
+		// Everything after this, layers included, tears down on this thread
+		RenderThread::Shutdown();
+		AudioEngine::Shutdown();
+		FlightRecorder::Shutdown();
+		ThreadPool::Shutdown();
+		FrameAllocator::Shutdown();
+		Renderer2D::Shutdown();
 	}
 
 	// Marks the application as not running (to exit the main loop)
@@ -52,6 +111,11 @@ namespace DemoEngine
 	// Handles all events passed by the window system
 	void Application::OnEvent(Event& e)
 	{
+		// Input tracks every key/mouse event, even ones a layer ends up handling
+		Input::OnEvent(e);
+
+		RequestFrames(s_FramesPerEvent);
+
 		// Dispatch window close and resize events
 		EventDispatcher dispatcher(e);
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FUNC(OnWindowClose));
@@ -72,45 +136,91 @@ namespace DemoEngine
 	{
 		while (m_Running)
 		{
-			// Get current time and calculate the time step between frames
-			float time = (float)glfwGetTime(); // Platform::GetTime() 
-			Timestep timestep = time - m_LastFrameTime;
-			m_LastFrameTime = time;
+			// Minimised windows draw nothing either way, so they always sleep
+			if (m_Minimized || (m_OnDemandUpdates && m_RequestedFrames == 0))
+			{
+				WaitForEvents();
+				continue;
+			}
 
-			// Only update if the window is not minimized
-			if (!m_Minimized)
+			if (m_RequestedFrames > 0)
+				m_RequestedFrames--;
+
+			Timestep timestep;
 			{
-				// Update all layers
+				PROFILE_SCOPE("Frame");
+
+				// Time since the previous frame, measured in double precision
+				timestep = m_FrameClock.BeginFrame();
+
+				FrameAllocator::BeginFrame();
+
+				// Snapshot input gathered by the previous poll, before anything reads it
+				Input::Update();
+
+				// Only update if the window is not minimized
+				if (!m_Minimized)
 				{
-					for (Layer* layer : m_LayerStack) {
-						layer->OnUpdate(timestep);
+					// Update all layers
+					{
+						PROFILE_SCOPE("Layers::OnUpdate");
+						for (Layer* layer : m_LayerStack) {
+							PROFILE_SCOPE(layer->GetProfileName());
+							layer->OnUpdate(timestep);
+						}
 					}
-				}
 
-				// Start ImGui frame
-				m_ImGuiLayer->Begin();
-				{
-					// Render ImGui for each layer
-					for (Layer* layer : m_LayerStack)
+					// Start ImGui frame
+					PROFILE_SCOPE("ImGui");
+					m_ImGuiLayer->Begin();
 					{
-						layer->OnImGuiRender();
+						// Render ImGui for each layer
+						for (Layer* layer : m_LayerStack)
+						{
+							PROFILE_SCOPE(layer->GetProfileName());
+							layer->OnImGuiRender();
+						}
 					}
+					// End ImGui frame
+					m_ImGuiLayer->End();
 				}
-				// End ImGui frame
-				m_ImGuiLayer->End();
 
-				// Update input state (key presses, mouse, etc.)
-				Input::Update();
+				// Update the window (swap buffers, poll events, etc.)
+				PROFILE_SCOPE("Window::OnUpdate");
+				m_Window->OnUpdate();
+
+				// Let the render thread start on this frame while the next one is built
+				RenderThread::EndFrame();
+
+				// Hold the frame to the target rate, if one is set
+				m_FrameClock.EndFrame();
 			}
 
-			// Update the window (swap buffers, poll events, etc.)
-			m_Window->OnUpdate();
+			// Hand this frame's scopes to the active profiling session and the flight recorder
+			Profiler::Collect();
+			HeapTracker::EndFrame();
+			FlightRecorder::EndFrame(timestep);
+
+			if (!StartupTimeline::IsComplete())
+				StartupTimeline::OnFirstFrame();
 		}
 	}
 
+	void Application::WaitForEvents()
+	{
+		double start = FrameClock::Now();
+		m_Window->WaitEvents(s_IdleTimeout);
+
+		// Not every event goes through OnEvent (ImGui's own viewport windows, for one), so waking early counts as input
+		RequestFrames(FrameClock::Now() - start < s_IdleTimeout ? s_FramesPerEvent : 1);
+
+		m_FrameClock.SkipIdleTime();
+	}
+
 	// Adds a new layer to the layer stack
 	void Application::PushLayer(Layer* layer)
 	{
+		PROFILE_SCOPE(layer->GetProfileName());
 		m_LayerStack.PushLayer(layer);
 		layer->OnAttach(); // Call setup logic
 	}
@@ -118,6 +228,7 @@ namespace DemoEngine
 	// Adds a new overlay (rendered on top of everything else)
 	void Application::PushOverlay(Layer* layer)
 	{
+		PROFILE_SCOPE(layer->GetProfileName());
 		m_LayerStack.PushOverlay(layer);
 		layer->OnAttach(); // Call setup logic
 	}
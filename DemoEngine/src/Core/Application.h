@@ -3,6 +3,7 @@
 #include "Core.h"
 #include "Window.h"
 #include "Core/Timestep.h"
+#include "Core/FrameClock.h"
 #include "LayerStack.h"
 #include "ImGui/ImGuiLayer.h"
 #include "Events/Event.h"
@@ -27,6 +28,14 @@ namespace DemoEngine
 		void Close();
 
 		ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer;}
+		FrameClock& GetFrameClock() { return m_FrameClock; }
+
+		// When on, the loop sleeps in Window::WaitEvents until input arrives or a frame is
+		// requested, instead of redrawing an unchanged UI. Layers with ongoing work (a
+		// playing scene) call RequestFrames every frame to keep it running.
+		void SetOnDemandUpdates(bool enabled) { m_OnDemandUpdates = enabled; }
+		bool IsOnDemandUpdates() const { return m_OnDemandUpdates; }
+		void RequestFrames(uint32_t count = 1) { m_RequestedFrames = std::max(m_RequestedFrames, count); }
 
 		static Application& Get() { return *s_Instance; }
 	
@@ -34,13 +43,16 @@ namespace DemoEngine
 		void Run();
 		bool OnWindowClose(WindowCloseEvent& e);
 		bool OnWindowResize(WindowResizeEvent& e);
+		void WaitForEvents();
 
 	private:
 		std::unique_ptr<Window> m_Window; 
 		ImGuiLayer* m_ImGuiLayer;
 		bool m_Running = true;
 		bool m_Minimized = false;
-		float m_LastFrameTime = 0.0f;
+		bool m_OnDemandUpdates = false;
+		uint32_t m_RequestedFrames = 0; // Frames still to run before the loop may sleep
+		FrameClock m_FrameClock;
 		LayerStack m_LayerStack;
 
 	private:
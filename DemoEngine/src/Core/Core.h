@@ -2,10 +2,11 @@
 
 #include <memory>
 
-#define BIND_EVENT_FN(fn) std::bind(&fn, this, std::placeholders::_1)
+#define BIND_EVENT_FN(fn) [this](auto&&... args) -> decltype(auto) { return this->fn(std::forward<decltype(args)>(args)...); }
 
 //This is created so we can verify something and if it's not verified then we must break/end the application #define CORE_ASSERT(x, ...) { if(!(x)) { LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } 
-#define CORE_ASSERT(x, ...) { if(!(x)) {LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak();}}
+// Logged synchronously: a message queued for the logging thread would not be written before the break
+#define CORE_ASSERT(x, ...) { if(!(x)) {::DemoEngine::Log::GetSyncLogger()->error("Assertion Failed: {0}", __VA_ARGS__); __debugbreak();}}
 
 namespace DemoEngine {
 
@@ -1,21 +1,65 @@
 #pragma once
 #include <Core/Core.h>
+#include "Scene/ReplayRunner.h"
+#include "Scene/SceneGenerator.h"
+#include "Renderer/RenderThread.h"
+#include "Profiling/StartupTimeline.h"
 
 //This will create the demo engine application for us 
 
 extern DemoEngine::Application* DemoEngine::CreateApplication();
 
-int main(int arc, char** argv) {
+int main(int argc, char** argv) {
 
 	DemoEngine::Log::Init();
+	DemoEngine::Profiler::Init();
 
 	printf("Demo Engine\n");
 
+	// Headless replay of a recorded session, e.g. for benchmarking
+	DemoEngine::ReplayOptions replayOptions;
+	if (DemoEngine::ParseReplayOptions(argc, argv, replayOptions))
+	{
+		int result = DemoEngine::RunReplay(replayOptions);
+		DemoEngine::Profiler::Shutdown();
+		DemoEngine::Log::Shutdown();
+		return result;
+	}
+
+	// Writes a procedural stress scene and exits, see SceneGenerator.h
+	DemoEngine::SceneGeneratorOptions generatorOptions;
+	if (DemoEngine::ParseSceneGeneratorOptions(argc, argv, generatorOptions))
+	{
+		int result = DemoEngine::RunSceneGenerator(generatorOptions);
+		DemoEngine::Profiler::Shutdown();
+		DemoEngine::Log::Shutdown();
+		return result;
+	}
+	else if (!generatorOptions.OutputPath.empty())
+	{
+		// Asked for a scene but the options were rejected; do not fall through to the editor
+		DemoEngine::Profiler::Shutdown();
+		DemoEngine::Log::Shutdown();
+		return 1;
+	}
+
+	for (int i = 1; i < argc; i++)
+	{
+		// Opt-in while the render thread matures
+		if (std::string(argv[i]) == "--render-thread")
+			DemoEngine::RenderThread::SetEnabled(true);
+		else if (std::string(argv[i]) == "--startup-trace")
+			DemoEngine::StartupTimeline::SetWriteTrace(true);
+	}
+
 	auto app = DemoEngine::CreateApplication();
 
 	app->Run();
 
 	delete app;
+
+	DemoEngine::Profiler::Shutdown();
+	DemoEngine::Log::Shutdown();
 }
 
 extern "C" {
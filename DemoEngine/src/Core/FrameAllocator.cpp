@@ -0,0 +1,117 @@
+#include "DemoEngine_PCH.h"
+#include "FrameAllocator.h"
+
+namespace DemoEngine
+{
+	LinearArena::LinearArena(size_t capacity)
+		: m_Memory(std::make_unique<uint8_t[]>(capacity)), m_Capacity(capacity)
+	{
+	}
+
+	void* LinearArena::Allocate(size_t size, size_t alignment)
+	{
+		uintptr_t base = (uintptr_t)m_Memory.get();
+		uintptr_t aligned = (base + m_Offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		size_t offset = aligned - base;
+
+		if (offset + size <= m_Capacity)
+		{
+			m_Offset = offset + size;
+			m_Peak = std::max(m_Peak, GetUsed());
+			return (void*)aligned;
+		}
+
+		// Spill to the heap; Reset folds the spilled size into the next block
+		auto& spill = m_Spilled.emplace_back(Spill{ std::make_unique<uint8_t[]>(size + alignment), size + alignment });
+		m_SpilledBytes += spill.Size;
+		m_SpillPeak = std::max(m_SpillPeak, m_SpilledBytes);
+		m_Peak = std::max(m_Peak, GetUsed());
+
+		uintptr_t blockBase = (uintptr_t)spill.Memory.get();
+		return (void*)((blockBase + alignment - 1) & ~(uintptr_t)(alignment - 1));
+	}
+
+	void LinearArena::Reset()
+	{
+		if (m_SpillPeak > 0)
+		{
+			m_Capacity += m_SpillPeak + m_SpillPeak / 2;
+			m_Memory = std::make_unique<uint8_t[]>(m_Capacity);
+			m_Spilled.clear();
+			m_SpilledBytes = 0;
+			m_SpillPeak = 0;
+		}
+		m_Offset = 0;
+	}
+
+	void LinearArena::Rewind(const ArenaMarker& marker)
+	{
+		// Only the outermost scope may replace the block; inner ones would free what it still uses
+		if (marker.Offset == 0 && marker.SpillCount == 0)
+		{
+			Reset();
+			return;
+		}
+
+		while (m_Spilled.size() > marker.SpillCount)
+		{
+			m_SpilledBytes -= m_Spilled.back().Size;
+			m_Spilled.pop_back();
+		}
+		m_Offset = marker.Offset;
+	}
+
+	struct FrameAllocatorData
+	{
+		std::unique_ptr<LinearArena> Arenas[2];
+		uint32_t Current = 0;
+	};
+
+	static FrameAllocatorData s_Data;
+
+	void FrameAllocator::Init(size_t capacity)
+	{
+		s_Data.Arenas[0] = std::make_unique<LinearArena>(capacity);
+		s_Data.Arenas[1] = std::make_unique<LinearArena>(capacity);
+		s_Data.Current = 0;
+	}
+
+	void FrameAllocator::Shutdown()
+	{
+		s_Data.Arenas[0].reset();
+		s_Data.Arenas[1].reset();
+	}
+
+	void FrameAllocator::BeginFrame()
+	{
+		if (!s_Data.Arenas[0])
+			Init();
+
+		s_Data.Current ^= 1;
+		s_Data.Arenas[s_Data.Current]->Reset();
+	}
+
+	LinearArena& FrameAllocator::Get()
+	{
+		if (!s_Data.Arenas[0])
+			Init();
+
+		return *s_Data.Arenas[s_Data.Current];
+	}
+
+	static LinearArena& GetScratchArena()
+	{
+		static thread_local LinearArena t_Scratch(256 * 1024);
+		return t_Scratch;
+	}
+
+	ScratchScope::ScratchScope()
+		: m_Arena(&GetScratchArena()), m_Marker(m_Arena->GetMarker())
+	{
+	}
+
+	ScratchScope::~ScratchScope()
+	{
+		m_Arena->Rewind(m_Marker);
+	}
+}
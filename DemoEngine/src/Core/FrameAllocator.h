@@ -0,0 +1,124 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace DemoEngine
+{
+	// Position in a LinearArena: the block offset and how many heap spills precede it
+	struct ArenaMarker
+	{
+		size_t Offset = 0;
+		size_t SpillCount = 0;
+	};
+
+	// Bump allocator over one block. Nothing is freed individually; Reset rewinds the
+	// whole arena. Requests that do not fit fall back to the heap until the next Reset,
+	// which then grows the block so the same load fits without spilling.
+	class LinearArena
+	{
+	public:
+		explicit LinearArena(size_t capacity = 64 * 1024);
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		T* Allocate(size_t count) { return static_cast<T*>(Allocate(count * sizeof(T), alignof(T))); }
+
+		void Reset();
+
+		// Rewinding to a marker frees everything allocated after it, spills included, and
+		// nothing before it (see ScratchScope). Rewinding to the start is a Reset.
+		ArenaMarker GetMarker() const { return { m_Offset, m_Spilled.size() }; }
+		void Rewind(const ArenaMarker& marker);
+
+		size_t GetUsed() const { return m_Offset + m_SpilledBytes; }
+		size_t GetCapacity() const { return m_Capacity; }
+		size_t GetPeak() const { return m_Peak; }
+
+	private:
+		std::unique_ptr<uint8_t[]> m_Memory;
+		size_t m_Capacity = 0;
+		size_t m_Offset = 0;
+		size_t m_Peak = 0;
+
+		struct Spill
+		{
+			std::unique_ptr<uint8_t[]> Memory;
+			size_t Size;
+		};
+		std::vector<Spill> m_Spilled;
+		size_t m_SpilledBytes = 0;
+		size_t m_SpillPeak = 0; // Most spilled at once since the last Reset, which grows the block by it
+	};
+
+	// STL allocator drawing from a LinearArena; deallocate is a no-op
+	template<typename T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+		ArenaAllocator(LinearArena& arena) : m_Arena(&arena) {}
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) : m_Arena(other.GetArena()) {}
+
+		T* allocate(size_t count) { return m_Arena->Allocate<T>(count); }
+		void deallocate(T*, size_t) {}
+
+		LinearArena* GetArena() const { return m_Arena; }
+
+		template<typename U>
+		bool operator==(const ArenaAllocator<U>& other) const { return m_Arena == other.GetArena(); }
+		template<typename U>
+		bool operator!=(const ArenaAllocator<U>& other) const { return m_Arena != other.GetArena(); }
+
+	private:
+		LinearArena* m_Arena;
+	};
+
+	template<typename T>
+	using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+	using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+	// Double-buffered per-frame arena for main-thread transients. Memory handed out
+	// during frame N stays valid until the start of frame N + 2, so data can be
+	// produced in one frame and consumed in the next.
+	class FrameAllocator
+	{
+	public:
+		static void Init(size_t capacity = 1024 * 1024);
+		static void Shutdown();
+
+		// Call at the start of every frame; flips the buffers and rewinds the new current one
+		static void BeginFrame();
+
+		static LinearArena& Get();
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) { return Get().Allocate(size, alignment); }
+	};
+
+	// Rewinds the calling thread's scratch arena on destruction. Use for temporaries
+	// that die before the function returns, on any thread:
+	//   ScratchScope scratch;
+	//   ArenaVector<int> values(scratch.GetArena());
+	class ScratchScope
+	{
+	public:
+		ScratchScope();
+		~ScratchScope();
+
+		ScratchScope(const ScratchScope&) = delete;
+		ScratchScope& operator=(const ScratchScope&) = delete;
+
+		LinearArena& GetArena() { return *m_Arena; }
+
+	private:
+		LinearArena* m_Arena;
+		ArenaMarker m_Marker;
+	};
+}
@@ -0,0 +1,107 @@
+#include "DemoEngine_PCH.h"
+#include "FrameClock.h"
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+	// Default Windows timer resolution is ~15.6 ms, far too coarse for a limiter
+	#include <Windows.h>
+	#include <timeapi.h>
+	#pragma comment(lib, "winmm.lib")
+#endif
+
+namespace DemoEngine
+{
+	static const std::chrono::steady_clock::time_point s_ClockStart = std::chrono::steady_clock::now();
+
+	// Weight of the newest frame in SmoothedFrameTime
+	static constexpr double s_SmoothingWeight = 0.1;
+
+	double FrameStats::GetPercentile(double fraction) const
+	{
+		uint64_t target = (uint64_t)(fraction * (double)FrameCount);
+		uint64_t count = 0;
+		for (uint32_t i = 0; i < HistogramBuckets; i++)
+		{
+			count += Histogram[i];
+			if (count > target)
+				return (i + 1) * HistogramBucketWidth;
+		}
+		return MaxFrameTime;
+	}
+
+	FrameClock::FrameClock()
+	{
+	#ifdef _WIN32
+		timeBeginPeriod(1);
+	#endif
+		m_FrameStart = Now();
+	}
+
+	FrameClock::~FrameClock()
+	{
+	#ifdef _WIN32
+		timeEndPeriod(1);
+	#endif
+	}
+
+	double FrameClock::Now()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - s_ClockStart).count();
+	}
+
+	Timestep FrameClock::BeginFrame()
+	{
+		double now = Now();
+		double delta = now - m_FrameStart;
+		m_FrameStart = now;
+
+		double milliseconds = delta * 1000.0;
+		m_Stats.FrameTime = milliseconds;
+		m_Stats.SmoothedFrameTime = m_Stats.FrameCount == 0 ? milliseconds
+			: m_Stats.SmoothedFrameTime + (milliseconds - m_Stats.SmoothedFrameTime) * s_SmoothingWeight;
+		m_Stats.MinFrameTime = m_Stats.FrameCount == 0 ? milliseconds : std::min(m_Stats.MinFrameTime, milliseconds);
+		m_Stats.MaxFrameTime = std::max(m_Stats.MaxFrameTime, milliseconds);
+
+		uint32_t bucket = (uint32_t)std::min(milliseconds / FrameStats::HistogramBucketWidth, (double)(FrameStats::HistogramBuckets - 1));
+		m_Stats.Histogram[bucket]++;
+		m_Stats.FrameCount++;
+
+		return Timestep((float)(m_Smoothing ? m_Stats.SmoothedFrameTime / 1000.0 : delta));
+	}
+
+	void FrameClock::EndFrame()
+	{
+		if (m_TargetFPS <= 0.0f)
+			return;
+
+		PROFILE_SCOPE("FrameClock::Wait");
+
+		double target = m_FrameStart + 1.0 / m_TargetFPS;
+
+		// Sleep for the bulk of the wait, then spin the last stretch for precision
+		double sleepUntil = target - m_SpinMargin;
+		double now = Now();
+		if (now < sleepUntil)
+		{
+			std::this_thread::sleep_for(std::chrono::duration<double>(sleepUntil - now));
+
+			// Overshooting the sleep means the margin is too small; creep back down otherwise
+			double overshoot = Now() - sleepUntil;
+			m_SpinMargin = std::clamp(m_SpinMargin + (overshoot * 1.5 - m_SpinMargin) * 0.1, 0.0005, 0.004);
+		}
+
+		while (Now() < target)
+			std::this_thread::yield();
+	}
+
+	void FrameClock::SkipIdleTime()
+	{
+		m_FrameStart = Now() - m_Stats.SmoothedFrameTime / 1000.0;
+	}
+
+	void FrameClock::ResetStats()
+	{
+		m_Stats = FrameStats();
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Core/Timestep.h"
+#include <array>
+#include <cstdint>
+
+namespace DemoEngine
+{
+	struct FrameStats
+	{
+		static constexpr uint32_t HistogramBuckets = 40;
+		static constexpr double HistogramBucketWidth = 1.0; // ms; the last bucket is open-ended
+
+		double FrameTime = 0.0; // ms, last frame
+		double SmoothedFrameTime = 0.0; // ms, exponential moving average
+		double MinFrameTime = 0.0; // ms, since ResetStats
+		double MaxFrameTime = 0.0;
+		uint64_t FrameCount = 0;
+		std::array<uint32_t, HistogramBuckets> Histogram = {};
+
+		float GetFPS() const { return SmoothedFrameTime > 0.0 ? (float)(1000.0 / SmoothedFrameTime) : 0.0f; }
+		// Upper edge (ms) of the bucket holding the given fraction of frames, e.g. 0.99
+		double GetPercentile(double fraction) const;
+	};
+
+	// Monotonic double-precision frame clock with an optional frame limiter. Absolute
+	// time never goes through float, so precision holds after days of uptime.
+	class FrameClock
+	{
+	public:
+		FrameClock();
+		~FrameClock();
+
+		// Seconds on the monotonic clock, relative to process start
+		static double Now();
+
+		// Starts a frame; returns the time since the previous one (smoothed if enabled)
+		Timestep BeginFrame();
+		// Waits out the rest of the frame when a target frame rate is set
+		void EndFrame();
+		// Call after the loop slept on input; the next frame then gets an ordinary timestep
+		void SkipIdleTime();
+
+		// 0 = unlimited. Independent of VSync, so it also caps frames while VSync is off.
+		void SetTargetFPS(float fps) { m_TargetFPS = fps; }
+		float GetTargetFPS() const { return m_TargetFPS; }
+
+		// Hands layers the averaged frame time instead of the raw one, hiding jitter
+		void SetSmoothing(bool smoothing) { m_Smoothing = smoothing; }
+		bool IsSmoothing() const { return m_Smoothing; }
+
+		const FrameStats& GetStats() const { return m_Stats; }
+		void ResetStats();
+
+	private:
+		double m_FrameStart = 0.0;
+		float m_TargetFPS = 0.0f;
+		bool m_Smoothing = false;
+
+		// How early to stop sleeping and start spinning, learnt from sleep overshoot
+		double m_SpinMargin = 0.002;
+
+		FrameStats m_Stats;
+	};
+}
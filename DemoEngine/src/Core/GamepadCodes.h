@@ -0,0 +1,44 @@
+#pragma once
+namespace DemoEngine
+{
+	using GamepadButtonCode = uint16_t;
+	using GamepadAxisCode = uint16_t;
+
+	namespace Gamepad
+	{
+		enum : GamepadButtonCode
+		{
+			// From glfw3.h (Xbox layout)
+			A = 0,
+			B = 1,
+			X = 2,
+			Y = 3,
+			LeftBumper = 4,
+			RightBumper = 5,
+			Back = 6,
+			Start = 7,
+			Guide = 8,
+			LeftThumb = 9,
+			RightThumb = 10,
+			DPadUp = 11,
+			DPadRight = 12,
+			DPadDown = 13,
+			DPadLeft = 14,
+			ButtonLast = DPadLeft
+		};
+	}
+
+	namespace GamepadAxis
+	{
+		enum : GamepadAxisCode
+		{
+			LeftX = 0,
+			LeftY = 1, // Down is positive
+			RightX = 2,
+			RightY = 3,
+			LeftTrigger = 4,
+			RightTrigger = 5,
+			AxisLast = RightTrigger
+		};
+	}
+}
@@ -0,0 +1,211 @@
+#include "DemoEngine_PCH.h"
+#include "HeapTracker.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+
+namespace DemoEngine
+{
+	const char* MemoryTagToString(MemoryTag tag)
+	{
+		switch (tag)
+		{
+		case MemoryTag::General: return "General";
+		case MemoryTag::Renderer: return "Renderer";
+		case MemoryTag::Scene: return "Scene";
+		case MemoryTag::Physics: return "Physics";
+		case MemoryTag::Audio: return "Audio";
+		case MemoryTag::Serialisation: return "Serialisation";
+		case MemoryTag::Networking: return "Networking";
+		case MemoryTag::UI: return "UI";
+		default: return "Unknown";
+		}
+	}
+
+	// Sits right before every tracked allocation
+	struct AllocationHeader
+	{
+		void* Block; // What malloc returned
+		uint64_t SizeAndTag; // Tag in the top byte
+	};
+	static_assert(sizeof(AllocationHeader) == 16, "Header must keep default new alignment");
+
+	static constexpr size_t s_MallocAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+	struct TagCounters
+	{
+		std::atomic<uint64_t> LiveBytes = 0;
+		std::atomic<uint64_t> PeakBytes = 0;
+		std::atomic<uint64_t> Allocations = 0;
+		std::atomic<uint64_t> AllocatedBytes = 0;
+	};
+
+	static TagCounters s_Tags[(size_t)MemoryTag::Count];
+
+	static thread_local uint64_t t_Allocations = 0;
+	static thread_local uint64_t t_Bytes = 0;
+	static thread_local MemoryTag t_Tag = MemoryTag::General;
+
+	static std::atomic<uint64_t> s_TotalAllocations = 0;
+	static std::atomic<uint64_t> s_TotalBytes = 0;
+
+	static HeapCounters s_FrameStart;
+	static HeapCounters s_LastFrame;
+
+	void* HeapTracker::Allocate(size_t size, size_t alignment, MemoryTag tag)
+	{
+		// malloc already satisfies the default alignment, anything stricter needs slack
+		size_t slack = alignment > s_MallocAlignment ? alignment - 1 : 0;
+		uint8_t* block = (uint8_t*)std::malloc(size + sizeof(AllocationHeader) + slack);
+		if (!block)
+			return nullptr;
+
+		uintptr_t user = (uintptr_t)block + sizeof(AllocationHeader);
+		if (slack)
+			user = (user + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+		AllocationHeader* header = (AllocationHeader*)user - 1;
+		header->Block = block;
+		header->SizeAndTag = (uint64_t)size | ((uint64_t)tag << 56);
+
+		t_Allocations++;
+		t_Bytes += size;
+		s_TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+		s_TotalBytes.fetch_add(size, std::memory_order_relaxed);
+
+		TagCounters& counters = s_Tags[(size_t)tag];
+		counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+		counters.AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+		uint64_t live = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		uint64_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+		{
+		}
+
+		return (void*)user;
+	}
+
+	void* HeapTracker::Allocate(size_t size, size_t alignment)
+	{
+		return Allocate(size, alignment, t_Tag);
+	}
+
+	void HeapTracker::Free(void* memory)
+	{
+		if (!memory)
+			return;
+
+		AllocationHeader* header = (AllocationHeader*)memory - 1;
+		uint64_t size = header->SizeAndTag & ((1ull << 56) - 1);
+		size_t tag = (size_t)(header->SizeAndTag >> 56);
+		s_Tags[tag].LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+
+		std::free(header->Block);
+	}
+
+	HeapCounters HeapTracker::GetThreadCounters()
+	{
+		return { t_Allocations, t_Bytes };
+	}
+
+	HeapCounters HeapTracker::GetTotalCounters()
+	{
+		return { s_TotalAllocations.load(std::memory_order_relaxed), s_TotalBytes.load(std::memory_order_relaxed) };
+	}
+
+	MemoryTagStats HeapTracker::GetTagStats(MemoryTag tag)
+	{
+		const TagCounters& counters = s_Tags[(size_t)tag];
+		return {
+			counters.LiveBytes.load(std::memory_order_relaxed),
+			counters.PeakBytes.load(std::memory_order_relaxed),
+			counters.Allocations.load(std::memory_order_relaxed),
+			counters.AllocatedBytes.load(std::memory_order_relaxed)
+		};
+	}
+
+	void HeapTracker::EndFrame()
+	{
+		HeapCounters now = GetTotalCounters();
+		s_LastFrame = { now.Allocations - s_FrameStart.Allocations, now.Bytes - s_FrameStart.Bytes };
+		s_FrameStart = now;
+	}
+
+	HeapCounters HeapTracker::GetLastFrameCounters()
+	{
+		return s_LastFrame;
+	}
+
+	MemoryTag HeapTracker::GetThreadTag()
+	{
+		return t_Tag;
+	}
+
+	void HeapTracker::SetThreadTag(MemoryTag tag)
+	{
+		t_Tag = tag;
+	}
+
+	bool HeapTracker::WriteReport(const std::string& path)
+	{
+		std::filesystem::path filePath(path);
+		if (filePath.has_parent_path())
+			std::filesystem::create_directories(filePath.parent_path());
+
+		std::ofstream stream(filePath, std::ios::trunc);
+		if (!stream)
+		{
+			LOG_ERROR("Could not open memory report '{0}'", path);
+			return false;
+		}
+
+		stream << "tag,live_bytes,peak_bytes,allocations,allocated_bytes\n";
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			MemoryTagStats stats = GetTagStats((MemoryTag)i);
+			stream << MemoryTagToString((MemoryTag)i) << ',' << stats.LiveBytes << ',' << stats.PeakBytes
+				<< ',' << stats.Allocations << ',' << stats.AllocatedBytes << '\n';
+		}
+
+		LOG_INFO("Memory report written to '{0}'", path);
+		return (bool)stream;
+	}
+}
+
+#if DEMOENGINE_TRACK_HEAP
+
+// The nothrow forms forward to these by default; over-aligned new keeps the CRT's
+void* operator new(size_t size)
+{
+	if (void* memory = DemoEngine::HeapTracker::Allocate(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	DemoEngine::HeapTracker::Free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	DemoEngine::HeapTracker::Free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	DemoEngine::HeapTracker::Free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	DemoEngine::HeapTracker::Free(memory);
+}
+
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+#include "Profiling/Profiler.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+
+// Counting replacements for global operator new/delete; on wherever profiling is
+#ifndef DEMOENGINE_TRACK_HEAP
+	#define DEMOENGINE_TRACK_HEAP DEMOENGINE_PROFILE
+#endif
+
+namespace DemoEngine
+{
+	// Subsystem an allocation is charged to. Allocator hooks (entt, Box2D, ENet, ImGui)
+	// tag their own memory; anything else takes the calling thread's MemoryTagScope.
+	enum class MemoryTag : uint8_t
+	{
+		General = 0,
+		Renderer,
+		Scene,
+		Physics,
+		Audio,
+		Serialisation,
+		Networking,
+		UI,
+		Count
+	};
+
+	const char* MemoryTagToString(MemoryTag tag);
+
+	struct HeapCounters
+	{
+		uint64_t Allocations = 0;
+		uint64_t Bytes = 0;
+	};
+
+	struct MemoryTagStats
+	{
+		uint64_t LiveBytes = 0;
+		uint64_t PeakBytes = 0;
+		uint64_t Allocations = 0; // Running totals, diff them for a rate
+		uint64_t AllocatedBytes = 0;
+	};
+
+	// Tracks heap allocations per thread, per tag and in total, so steady-state frames
+	// can be checked for allocations that should come from an arena (see FrameAllocator)
+	// and memory can be attributed to the subsystem that owns it.
+	class HeapTracker
+	{
+	public:
+		static constexpr bool IsEnabled() { return DEMOENGINE_TRACK_HEAP != 0; }
+
+		// Tracked allocation, used by operator new and the third-party allocator hooks
+		static void* Allocate(size_t size, size_t alignment, MemoryTag tag);
+		static void* Allocate(size_t size, size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+		static void Free(void* memory);
+
+		// Running totals for the calling thread, cheap enough to diff around a scope
+		static HeapCounters GetThreadCounters();
+		static HeapCounters GetTotalCounters();
+		static MemoryTagStats GetTagStats(MemoryTag tag);
+
+		// Call once per frame; GetLastFrameCounters then covers the frame that just ended
+		static void EndFrame();
+		static HeapCounters GetLastFrameCounters();
+
+		static MemoryTag GetThreadTag();
+		static void SetThreadTag(MemoryTag tag);
+
+		// One CSV row per tag, for diffing between runs
+		static bool WriteReport(const std::string& path);
+	};
+
+	// Charges allocations made by this thread to tag until the scope ends
+	class MemoryTagScope
+	{
+	public:
+		MemoryTagScope(MemoryTag tag) : m_Previous(HeapTracker::GetThreadTag()) { HeapTracker::SetThreadTag(tag); }
+		~MemoryTagScope() { HeapTracker::SetThreadTag(m_Previous); }
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+	private:
+		MemoryTag m_Previous;
+	};
+
+	// STL allocator charging everything to a fixed tag, e.g. the scene registry's pools
+	template<typename T, MemoryTag Tag>
+	class TaggedAllocator
+	{
+	public:
+		using value_type = T;
+
+		template<typename U>
+		struct rebind { using other = TaggedAllocator<U, Tag>; };
+
+		TaggedAllocator() = default;
+		template<typename U>
+		TaggedAllocator(const TaggedAllocator<U, Tag>&) {}
+
+		T* allocate(size_t count)
+		{
+			// Containers expect an allocator to throw rather than return null
+			void* memory = HeapTracker::Allocate(count * sizeof(T), std::max(alignof(T), (size_t)__STDCPP_DEFAULT_NEW_ALIGNMENT__), Tag);
+			if (!memory)
+				throw std::bad_alloc();
+			return static_cast<T*>(memory);
+		}
+		void deallocate(T* memory, size_t) { HeapTracker::Free(memory); }
+
+		template<typename U>
+		bool operator==(const TaggedAllocator<U, Tag>&) const { return true; }
+		template<typename U>
+		bool operator!=(const TaggedAllocator<U, Tag>&) const { return false; }
+	};
+}
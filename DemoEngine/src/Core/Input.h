@@ -3,20 +3,80 @@
 #include "Core.h"
 #include "KeyCodes.h"
 #include "MouseCodes.h"
+#include "GamepadCodes.h"
 #include "Events/Event.h"
+#include <bitset>
 
 namespace DemoEngine
 {
+	// Everything the engine knows about input for one frame. Captured once by
+	// Input::Update, so queries are bit tests and the whole thing is cheap to copy.
+	struct InputSnapshot
+	{
+		std::bitset<Key::Menu + 1> Keys;
+		std::bitset<Mouse::ButtonLast + 1> MouseButtons;
+		float MouseX = 0.0f, MouseY = 0.0f;
+		float ScrollX = 0.0f, ScrollY = 0.0f; // Accumulated over the frame
+
+		bool GamepadConnected = false;
+		std::bitset<Gamepad::ButtonLast + 1> GamepadButtons;
+		std::array<float, GamepadAxis::AxisLast + 1> GamepadAxes = {};
+	};
+
+	// Handle returned by Input::GetAction
+	using InputAction = uint32_t;
+
 	class Input
 	{
 	public:
+		static constexpr uint32_t MaxActions = 64;
+		static constexpr InputAction InvalidAction = MaxActions;
+
 		static void Init();
 		static void SetEventCallback(const EventCallbackFn& callback); 
+
+		// Feeds key/mouse/focus events into the live state; called by Application before layers see them
+		static void OnEvent(Event& e);
+		// Takes this frame's snapshot; call once per frame before anything reads input
 		static void Update();
+		// Replaces this frame's snapshot with a recorded one (see InputReplay)
+		static void InjectSnapshot(const InputSnapshot& snapshot);
+
+		// Held this frame
 		static bool IsKeyPressed(KeyCode key);
 		static bool IsMouseButtonPressed(MouseCode button);
+		static bool IsGamepadButtonPressed(GamepadButtonCode button);
+
+		// Edges between the previous and the current snapshot
+		static bool IsKeyJustPressed(KeyCode key);
+		static bool IsKeyJustReleased(KeyCode key);
+		static bool IsMouseButtonJustPressed(MouseCode button);
+		static bool IsMouseButtonJustReleased(MouseCode button);
+
+		static float GetGamepadAxis(GamepadAxisCode axis);
 		static std::pair<float, float> GetMousePosition();
 		static float GetMouseX();
 		static float GetMouseY();
+
+		static const InputSnapshot& GetSnapshot();
+		static const InputSnapshot& GetPreviousSnapshot();
+
+		// Actions: named inputs with any number of bindings, resolved once per frame by Update.
+		// Creating and binding is main-thread only; lookups and queries are read-only, so
+		// systems on worker threads can use them. Look the handle up once and keep it.
+		static InputAction CreateAction(const std::string& name);
+		// InvalidAction if it was never created; queries on it report nothing held
+		static InputAction GetAction(const std::string& name);
+		static void BindKey(InputAction action, KeyCode key);
+		static void BindMouseButton(InputAction action, MouseCode button);
+		static void BindGamepadButton(InputAction action, GamepadButtonCode button);
+		// direction selects which half of the axis drives the action (+1 or -1)
+		static void BindGamepadAxis(InputAction action, GamepadAxisCode axis, float direction);
+
+		static bool IsActionHeld(InputAction action);
+		static bool IsActionPressed(InputAction action);
+		static bool IsActionReleased(InputAction action);
+		// 0..1; analog for axis bindings, 0 or 1 otherwise
+		static float GetActionValue(InputAction action);
 	};
 }
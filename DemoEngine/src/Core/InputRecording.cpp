@@ -0,0 +1,266 @@
+#include "DemoEngine_PCH.h"
+#include "InputRecording.h"
+#include <cstring>
+
+namespace DemoEngine
+{
+	static constexpr char s_Magic[4] = { 'D', 'E', 'R', 'C' };
+	static constexpr uint32_t s_Version = 2; // 2: embedded scene
+
+	enum FrameFlags : uint8_t
+	{
+		FrameFlags_InputChanged = 1 << 0
+	};
+
+	template<typename T>
+	static void Write(std::ostream& stream, const T& value)
+	{
+		stream.write((const char*)&value, sizeof(T));
+	}
+
+	template<typename T>
+	static bool Read(std::istream& stream, T& value)
+	{
+		return (bool)stream.read((char*)&value, sizeof(T));
+	}
+
+	// std::bitset has no raw access, so pack it into 64-bit words
+	template<size_t N>
+	static void WriteBits(std::ostream& stream, const std::bitset<N>& bits)
+	{
+		for (size_t word = 0; word < (N + 63) / 64; word++)
+		{
+			uint64_t value = 0;
+			for (size_t bit = 0; bit < 64 && word * 64 + bit < N; bit++)
+				value |= (uint64_t)bits.test(word * 64 + bit) << bit;
+			Write(stream, value);
+		}
+	}
+
+	template<size_t N>
+	static bool ReadBits(std::istream& stream, std::bitset<N>& bits)
+	{
+		for (size_t word = 0; word < (N + 63) / 64; word++)
+		{
+			uint64_t value;
+			if (!Read(stream, value))
+				return false;
+			for (size_t bit = 0; bit < 64 && word * 64 + bit < N; bit++)
+				bits.set(word * 64 + bit, (value >> bit) & 1);
+		}
+		return true;
+	}
+
+	static void WriteSnapshot(std::ostream& stream, const InputSnapshot& snapshot)
+	{
+		WriteBits(stream, snapshot.Keys);
+		WriteBits(stream, snapshot.MouseButtons);
+		Write(stream, snapshot.MouseX);
+		Write(stream, snapshot.MouseY);
+		Write(stream, snapshot.ScrollX);
+		Write(stream, snapshot.ScrollY);
+		Write(stream, (uint8_t)snapshot.GamepadConnected);
+		WriteBits(stream, snapshot.GamepadButtons);
+		Write(stream, snapshot.GamepadAxes);
+	}
+
+	static bool ReadSnapshot(std::istream& stream, InputSnapshot& snapshot)
+	{
+		uint8_t gamepadConnected = 0;
+		bool ok = ReadBits(stream, snapshot.Keys)
+			&& ReadBits(stream, snapshot.MouseButtons)
+			&& Read(stream, snapshot.MouseX)
+			&& Read(stream, snapshot.MouseY)
+			&& Read(stream, snapshot.ScrollX)
+			&& Read(stream, snapshot.ScrollY)
+			&& Read(stream, gamepadConnected)
+			&& ReadBits(stream, snapshot.GamepadButtons)
+			&& Read(stream, snapshot.GamepadAxes);
+		snapshot.GamepadConnected = gamepadConnected != 0;
+		return ok;
+	}
+
+	static bool SnapshotsEqual(const InputSnapshot& a, const InputSnapshot& b)
+	{
+		return a.Keys == b.Keys && a.MouseButtons == b.MouseButtons
+			&& a.MouseX == b.MouseX && a.MouseY == b.MouseY
+			&& a.ScrollX == b.ScrollX && a.ScrollY == b.ScrollY
+			&& a.GamepadConnected == b.GamepadConnected && a.GamepadButtons == b.GamepadButtons
+			&& a.GamepadAxes == b.GamepadAxes;
+	}
+
+	struct RecorderData
+	{
+		std::ofstream Stream;
+		bool FrameOpen = false;
+		InputSnapshot LastSnapshot;
+		uint32_t FrameCount = 0;
+
+		// The open frame is written once it is complete
+		Timestep FrameTimestep;
+		InputSnapshot FrameSnapshot;
+		std::vector<RecordedNetworkEvent> FrameNetworkEvents;
+	};
+
+	static RecorderData s_Recorder;
+
+	static void FlushFrame()
+	{
+		if (!s_Recorder.FrameOpen)
+			return;
+
+		std::ofstream& stream = s_Recorder.Stream;
+
+		// The first frame always stores its snapshot
+		bool inputChanged = s_Recorder.FrameCount == 0 || !SnapshotsEqual(s_Recorder.FrameSnapshot, s_Recorder.LastSnapshot);
+
+		Write(stream, s_Recorder.FrameTimestep.GetSeconds());
+		Write(stream, (uint8_t)(inputChanged ? FrameFlags_InputChanged : 0));
+		if (inputChanged)
+			WriteSnapshot(stream, s_Recorder.FrameSnapshot);
+
+		Write(stream, (uint16_t)s_Recorder.FrameNetworkEvents.size());
+		for (const auto& event : s_Recorder.FrameNetworkEvents)
+		{
+			Write(stream, event.EventType);
+			Write(stream, (uint32_t)event.Data.size());
+			stream.write((const char*)event.Data.data(), event.Data.size());
+		}
+
+		s_Recorder.LastSnapshot = s_Recorder.FrameSnapshot;
+		s_Recorder.FrameNetworkEvents.clear();
+		s_Recorder.FrameOpen = false;
+		s_Recorder.FrameCount++;
+	}
+
+	bool InputRecorder::StartRecording(const std::filesystem::path& path, const std::string& scenePath, const std::vector<uint8_t>& scene)
+	{
+		StopRecording();
+
+		if (path.has_parent_path())
+			std::filesystem::create_directories(path.parent_path());
+
+		s_Recorder.Stream.open(path, std::ios::binary | std::ios::trunc);
+		if (!s_Recorder.Stream)
+		{
+			LOG_ERROR("Could not open input recording '{0}'", path.string());
+			return false;
+		}
+
+		std::ofstream& stream = s_Recorder.Stream;
+		stream.write(s_Magic, sizeof(s_Magic));
+		Write(stream, s_Version);
+		Write(stream, (uint32_t)scenePath.size());
+		stream.write(scenePath.data(), scenePath.size());
+		Write(stream, (uint32_t)scene.size());
+		stream.write((const char*)scene.data(), scene.size());
+
+		s_Recorder.FrameCount = 0;
+		s_Recorder.FrameOpen = false;
+		s_Recorder.FrameNetworkEvents.clear();
+
+		LOG_INFO("Recording input to '{0}'", path.string());
+		return true;
+	}
+
+	void InputRecorder::StopRecording()
+	{
+		if (!IsRecording())
+			return;
+
+		FlushFrame();
+		s_Recorder.Stream.close();
+		LOG_INFO("Input recording stopped after {0} frames", s_Recorder.FrameCount);
+	}
+
+	bool InputRecorder::IsRecording()
+	{
+		return s_Recorder.Stream.is_open();
+	}
+
+	void InputRecorder::BeginFrame(Timestep ts)
+	{
+		if (!IsRecording())
+			return;
+
+		FlushFrame();
+
+		s_Recorder.FrameOpen = true;
+		s_Recorder.FrameTimestep = ts;
+		s_Recorder.FrameSnapshot = Input::GetSnapshot();
+	}
+
+	void InputRecorder::RecordNetworkEvent(RecordedNetworkEvent::Type type, const void* data, size_t size)
+	{
+		if (!IsRecording() || !s_Recorder.FrameOpen)
+			return;
+
+		RecordedNetworkEvent& event = s_Recorder.FrameNetworkEvents.emplace_back();
+		event.EventType = type;
+		event.Data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+	}
+
+	bool InputReplay::Open(const std::filesystem::path& path)
+	{
+		m_Stream.open(path, std::ios::binary);
+		if (!m_Stream)
+		{
+			LOG_ERROR("Could not open input recording '{0}'", path.string());
+			return false;
+		}
+
+		char magic[4];
+		uint32_t version = 0, scenePathLength = 0;
+		if (!m_Stream.read(magic, sizeof(magic)) || memcmp(magic, s_Magic, sizeof(magic)) != 0
+			|| !Read(m_Stream, version) || version != s_Version
+			|| !Read(m_Stream, scenePathLength))
+		{
+			LOG_ERROR("'{0}' is not a supported input recording", path.string());
+			return false;
+		}
+
+		m_ScenePath.resize(scenePathLength);
+		uint32_t sceneSize = 0;
+		if (!m_Stream.read(m_ScenePath.data(), scenePathLength) || !Read(m_Stream, sceneSize))
+		{
+			LOG_ERROR("Input recording '{0}' is truncated", path.string());
+			return false;
+		}
+
+		m_Scene.resize(sceneSize);
+		m_Stream.read((char*)m_Scene.data(), sceneSize);
+		m_FramesRead = 0;
+		return (bool)m_Stream;
+	}
+
+	bool InputReplay::NextFrame()
+	{
+		float seconds;
+		uint8_t flags;
+		if (!Read(m_Stream, seconds) || !Read(m_Stream, flags))
+			return false;
+
+		m_Timestep = Timestep(seconds);
+		if ((flags & FrameFlags_InputChanged) && !ReadSnapshot(m_Stream, m_Snapshot))
+			return false;
+
+		uint16_t eventCount;
+		if (!Read(m_Stream, eventCount))
+			return false;
+
+		m_NetworkEvents.resize(eventCount);
+		for (auto& event : m_NetworkEvents)
+		{
+			uint32_t size;
+			if (!Read(m_Stream, event.EventType) || !Read(m_Stream, size))
+				return false;
+
+			event.Data.resize(size);
+			if (!m_Stream.read((char*)event.Data.data(), size))
+				return false;
+		}
+
+		m_FramesRead++;
+		return true;
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Core/Input.h"
+#include "Core/Timestep.h"
+#include <filesystem>
+#include <fstream>
+
+namespace DemoEngine
+{
+	// Network traffic that reached the scene during a recorded frame
+	struct RecordedNetworkEvent
+	{
+		enum class Type : uint8_t { Connect = 1, Disconnect = 2, Receive = 3 };
+
+		Type EventType;
+		std::vector<uint8_t> Data; // Packet payload for Receive
+	};
+
+	// Writes the frame delta, input snapshot and network events of every runtime
+	// frame to a compact binary file. Unchanged snapshots are stored as one flag byte.
+	// The scene the recording starts from is embedded in the header (binary scene
+	// encoding), so unsaved edits and later changes to the file don't break replays.
+	class InputRecorder
+	{
+	public:
+		// scenePath is informational; scene is what replays load
+		static bool StartRecording(const std::filesystem::path& path, const std::string& scenePath, const std::vector<uint8_t>& scene);
+		static void StopRecording();
+		static bool IsRecording();
+
+		// Starts a new frame with the current Input snapshot; call right before Scene::OnUpdateRuntime
+		static void BeginFrame(Timestep ts);
+		static void RecordNetworkEvent(RecordedNetworkEvent::Type type, const void* data = nullptr, size_t size = 0);
+	};
+
+	// Reads a file written by InputRecorder, one frame at a time
+	class InputReplay
+	{
+	public:
+		bool Open(const std::filesystem::path& path);
+
+		// Advances to the next frame; false at the end of the recording
+		bool NextFrame();
+
+		const std::string& GetScenePath() const { return m_ScenePath; }
+		// Binary scene the recording started from
+		const std::vector<uint8_t>& GetScene() const { return m_Scene; }
+		uint32_t GetFramesRead() const { return m_FramesRead; }
+
+		Timestep GetTimestep() const { return m_Timestep; }
+		const InputSnapshot& GetSnapshot() const { return m_Snapshot; }
+		const std::vector<RecordedNetworkEvent>& GetNetworkEvents() const { return m_NetworkEvents; }
+
+	private:
+		std::ifstream m_Stream;
+		std::string m_ScenePath;
+		std::vector<uint8_t> m_Scene;
+		uint32_t m_FramesRead = 0;
+
+		Timestep m_Timestep;
+		InputSnapshot m_Snapshot;
+		std::vector<RecordedNetworkEvent> m_NetworkEvents;
+	};
+}
@@ -4,7 +4,7 @@
 namespace DemoEngine
 {
 	Layer::Layer(const std::string& debugName)
-		: m_DebugName(debugName)
+		: m_DebugName(debugName), m_ProfileName(Profiler::InternName(debugName))
 	{
 
 	}
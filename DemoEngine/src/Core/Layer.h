@@ -19,8 +19,11 @@ namespace DemoEngine
 		virtual void OnEvent(Event& event) {};
 
 		inline const std::string& GetName() const { return m_DebugName; }
+		// Interned, so it can name profiler scopes that outlive the layer
+		inline const char* GetProfileName() const { return m_ProfileName; }
 	
 	private:
 		std::string m_DebugName;
+		const char* m_ProfileName;
 	};
 }
\ No newline at end of file
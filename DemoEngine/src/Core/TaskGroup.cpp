@@ -0,0 +1,29 @@
+#include "DemoEngine_PCH.h"
+#include "TaskGroup.h"
+#include "ThreadPool.h"
+
+namespace DemoEngine
+{
+	void TaskGroup::Run(std::function<void()> job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Pending++;
+		}
+
+		ThreadPool::Submit([this, job = std::move(job)]()
+		{
+			job();
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (--m_Pending == 0)
+				m_Finished.notify_all();
+		});
+	}
+
+	void TaskGroup::Wait()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Finished.wait(lock, [this] { return m_Pending == 0; });
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+namespace DemoEngine
+{
+	// Fork/join helper over the ThreadPool for one-off work outside the system
+	// scheduler, e.g. loading files in parallel during startup:
+	//   TaskGroup group;
+	//   group.Run([&]() { a = Load("a"); });
+	//   group.Run([&]() { b = Load("b"); });
+	//   group.Wait();
+	class TaskGroup
+	{
+	public:
+		TaskGroup() = default;
+		~TaskGroup() { Wait(); }
+
+		TaskGroup(const TaskGroup&) = delete;
+		TaskGroup& operator=(const TaskGroup&) = delete;
+
+		void Run(std::function<void()> job);
+		// Blocks until every job passed to Run has finished
+		void Wait();
+
+	private:
+		std::mutex m_Mutex;
+		std::condition_variable m_Finished;
+		uint32_t m_Pending = 0;
+	};
+}
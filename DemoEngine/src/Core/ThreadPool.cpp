@@ -0,0 +1,98 @@
+#include "DemoEngine_PCH.h"
+#include "ThreadPool.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace DemoEngine
+{
+	struct ThreadPoolData
+	{
+		std::vector<std::thread> Workers;
+		std::deque<std::function<void()>> Jobs;
+		std::mutex Mutex;
+		std::condition_variable JobAvailable;
+		bool Stopping = false;
+	};
+
+	static ThreadPoolData s_Data;
+	static thread_local int t_WorkerIndex = -1;
+
+	static void WorkerLoop(int index)
+	{
+		t_WorkerIndex = index;
+		Profiler::SetThreadName(("Worker " + std::to_string(index)).c_str());
+
+		while (true)
+		{
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(s_Data.Mutex);
+				s_Data.JobAvailable.wait(lock, [] { return s_Data.Stopping || !s_Data.Jobs.empty(); });
+
+				if (s_Data.Jobs.empty())
+					return;
+
+				job = std::move(s_Data.Jobs.front());
+				s_Data.Jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+
+	void ThreadPool::Init(uint32_t workerCount)
+	{
+		CORE_ASSERT(s_Data.Workers.empty(), "ThreadPool already initialised");
+
+		if (workerCount == 0)
+			workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+		s_Data.Stopping = false;
+		for (uint32_t i = 0; i < workerCount; i++)
+			s_Data.Workers.emplace_back(WorkerLoop, (int)i);
+
+		LOG_INFO("ThreadPool started with {0} workers", workerCount);
+	}
+
+	void ThreadPool::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			s_Data.Stopping = true;
+		}
+		s_Data.JobAvailable.notify_all();
+
+		// Workers drain the queue before exiting
+		for (auto& worker : s_Data.Workers)
+			worker.join();
+		s_Data.Workers.clear();
+	}
+
+	void ThreadPool::Submit(std::function<void()> job)
+	{
+		// Without workers jobs simply run on the caller
+		if (s_Data.Workers.empty())
+		{
+			job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			s_Data.Jobs.push_back(std::move(job));
+		}
+		s_Data.JobAvailable.notify_one();
+	}
+
+	uint32_t ThreadPool::GetWorkerCount()
+	{
+		return (uint32_t)s_Data.Workers.size();
+	}
+
+	int ThreadPool::GetCurrentWorkerIndex()
+	{
+		return t_WorkerIndex;
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <functional>
+
+namespace DemoEngine
+{
+	// Fixed set of worker threads fed from a single job queue
+	class ThreadPool
+	{
+	public:
+		// 0 picks one worker per hardware thread, minus the main thread
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static void Submit(std::function<void()> job);
+
+		static uint32_t GetWorkerCount();
+		// Index of the calling worker, or -1 on any other thread
+		static int GetCurrentWorkerIndex();
+	};
+}
@@ -2,6 +2,7 @@
 #include "DemoEngine_PCH.h"
 #include "Core/Core.h"
 #include "Events/Event.h"
+#include "Renderer/GraphicsContext.h"
 
 namespace DemoEngine
 {
@@ -26,6 +27,8 @@ namespace DemoEngine
 		virtual ~Window() {}
 
 		virtual void OnUpdate() = 0;
+		// Blocks until an event arrives or timeout seconds pass, dispatching any events
+		virtual void WaitEvents(double timeout) = 0;
 
 		virtual uint32_t GetWidth() const = 0; 
 		virtual uint32_t GetHeight() const = 0;
@@ -35,6 +38,7 @@ namespace DemoEngine
 		virtual bool IsVSync() const = 0;
 
 		virtual void* GetNativeWindow() const = 0;
+		virtual GraphicsContext& GetContext() const = 0;
 
 		static std::unique_ptr<Window> Create(const WindowProps& props = WindowProps());
 	
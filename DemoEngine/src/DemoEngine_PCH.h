@@ -11,6 +11,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include "Logging/Log.h"
+#include "Profiling/Profiler.h"
 
 class DemoEngine_PCH
 {
@@ -0,0 +1,376 @@
+#include "DemoEngine_PCH.h"
+#include "EditHistory.h"
+#include "Scene/Entity.h"
+#include "Scene/SceneSerialiser.h"
+#include "Core/FrameClock.h"
+#include <cstring>
+
+namespace DemoEngine
+{
+	// Unchanged runs shorter than a patch header are cheaper to store than to split on
+	static constexpr uint32_t s_PatchMergeGap = 16;
+
+	// Commits this close together that change the same bytes merge into one step
+	static constexpr double s_CoalesceWindow = 1.0; // Seconds
+
+	size_t EditHistory::Step::GetMemoryUsage() const
+	{
+		return sizeof(Step) + Entities.capacity() * sizeof(EntityDelta) + Patches.capacity() * sizeof(Patch) + Bytes.capacity();
+	}
+
+	// FNV-1a
+	static uint64_t HashBytes(const uint8_t* data, size_t size)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (size_t i = 0; i < size; i++)
+			hash = (hash ^ data[i]) * 1099511628211ull;
+		return hash;
+	}
+
+	EditHistory::~EditHistory()
+	{
+		SetContext(nullptr);
+	}
+
+	void EditHistory::SetContext(const Ref<Scene>& scene)
+	{
+		if (m_Scene)
+		{
+			SceneRegistry& registry = m_Scene->m_Registry;
+			ForEachComponent(AllComponents{}, [this, &registry](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				registry.on_construct<T>().disconnect(this);
+				registry.on_update<T>().disconnect(this);
+				registry.on_destroy<T>().disconnect(this);
+			});
+		}
+
+		m_Scene = scene;
+		m_Steps.clear();
+		m_Next = 0;
+		m_MemoryUsage = 0;
+		m_SnapshotValid = false;
+		if (!m_Scene)
+			return;
+
+		SceneRegistry& registry = m_Scene->m_Registry;
+		ForEachComponent(AllComponents{}, [this, &registry](auto componentType)
+		{
+			using T = typename decltype(componentType)::Type;
+			registry.on_construct<T>().template connect<&EditHistory::OnSceneChanged>(*this);
+			registry.on_update<T>().template connect<&EditHistory::OnSceneChanged>(*this);
+			registry.on_destroy<T>().template connect<&EditHistory::OnSceneChanged>(*this);
+		});
+	}
+
+	void EditHistory::Capture(const std::vector<entt::entity>& entities)
+	{
+		// Anything changed outside an edit (a paste, a script, a shortcut) would otherwise end up in the next step
+		if (!m_Scene || (m_SnapshotValid && !m_SceneChanged && entities == m_Snapshot.Entities))
+			return;
+
+		PROFILE_FUNCTION();
+
+		TakeSnapshot(entities, m_Snapshot);
+		m_SnapshotValid = true;
+		m_SceneChanged = false;
+	}
+
+	void EditHistory::Commit()
+	{
+		if (!m_Scene || !m_SnapshotValid)
+			return;
+
+		PROFILE_FUNCTION();
+
+		Snapshot after;
+		TakeSnapshot(m_Snapshot.Entities, after);
+
+		Step step;
+		uint32_t beforeStart = 0, afterStart = 0;
+		for (size_t i = 0; i < m_Snapshot.Entities.size(); i++)
+		{
+			const uint8_t* before = m_Snapshot.Bytes.data() + beforeStart;
+			const uint8_t* changed = after.Bytes.data() + afterStart;
+			uint32_t beforeSize = m_Snapshot.Offsets[i] - beforeStart;
+			uint32_t afterSize = after.Offsets[i] - afterStart;
+			beforeStart = m_Snapshot.Offsets[i];
+			afterStart = after.Offsets[i];
+
+			// Entities destroyed during the edit have nothing left to restore
+			uint64_t id = m_Snapshot.IDs[i];
+			if (id == 0 || id != after.IDs[i])
+				continue;
+
+			if (beforeSize == afterSize && std::memcmp(before, changed, beforeSize) == 0)
+				continue;
+
+			uint32_t firstPatch = (uint32_t)step.Patches.size();
+			Diff(before, beforeSize, changed, afterSize, step);
+			step.Entities.push_back({ id, beforeSize, afterSize, HashBytes(before, beforeSize), HashBytes(changed, afterSize), firstPatch, (uint32_t)step.Patches.size() - firstPatch });
+		}
+
+		// Every change since Capture is in the step
+		m_Snapshot = std::move(after);
+		m_SceneChanged = false;
+		if (step.Entities.empty())
+			return;
+
+		step.Time = FrameClock::Now();
+		if (!Coalesce(step))
+			Push(std::move(step));
+	}
+
+	bool EditHistory::Undo()
+	{
+		if (!CanUndo())
+			return false;
+
+		PROFILE_FUNCTION();
+		if (!Apply(m_Steps[m_Next - 1], true))
+			return false;
+
+		m_Next--;
+		return true;
+	}
+
+	bool EditHistory::Redo()
+	{
+		if (!CanRedo())
+			return false;
+
+		PROFILE_FUNCTION();
+		if (!Apply(m_Steps[m_Next], false))
+			return false;
+
+		m_Next++;
+		return true;
+	}
+
+	void EditHistory::SetMemoryBudget(size_t bytes)
+	{
+		m_MemoryBudget = bytes;
+		Trim();
+	}
+
+	void EditHistory::OnSceneChanged(SceneRegistry&, entt::entity)
+	{
+		m_SceneChanged = true;
+	}
+
+	void EditHistory::TakeSnapshot(const std::vector<entt::entity>& entities, Snapshot& snapshot) const
+	{
+		snapshot.Entities = entities;
+		snapshot.IDs.clear();
+		snapshot.Offsets.clear();
+		snapshot.Bytes.clear();
+
+		for (entt::entity entityID : entities)
+		{
+			if (m_Scene->IsEntityValid(entityID))
+			{
+				Entity entity = { entityID, m_Scene.get() };
+				snapshot.IDs.push_back(entity.GetUUID());
+				SceneSerialiser::SerialiseEntityBinary(entity, snapshot.Bytes);
+			}
+			else
+				snapshot.IDs.push_back(0);
+
+			snapshot.Offsets.push_back((uint32_t)snapshot.Bytes.size());
+		}
+	}
+
+	void EditHistory::Diff(const uint8_t* before, uint32_t beforeSize, const uint8_t* after, uint32_t afterSize, Step& step)
+	{
+		auto addPatch = [&](uint32_t offset, uint32_t removed, uint32_t added)
+		{
+			step.Patches.push_back({ offset, removed, added, (uint32_t)step.Bytes.size() });
+			step.Bytes.insert(step.Bytes.end(), before + offset, before + offset + removed);
+			step.Bytes.insert(step.Bytes.end(), after + offset, after + offset + added);
+		};
+
+		// A resized component (a renamed tag, an added one) shifts everything after it
+		if (beforeSize != afterSize)
+		{
+			uint32_t shorter = std::min(beforeSize, afterSize);
+			uint32_t prefix = 0;
+			while (prefix < shorter && before[prefix] == after[prefix])
+				prefix++;
+
+			uint32_t suffix = 0;
+			while (suffix < shorter - prefix && before[beforeSize - 1 - suffix] == after[afterSize - 1 - suffix])
+				suffix++;
+
+			addPatch(prefix, beforeSize - prefix - suffix, afterSize - prefix - suffix);
+			return;
+		}
+
+		uint32_t offset = 0;
+		while (offset < beforeSize)
+		{
+			if (before[offset] == after[offset])
+			{
+				offset++;
+				continue;
+			}
+
+			uint32_t end = offset + 1;
+			for (uint32_t i = end; i < beforeSize && i - end <= s_PatchMergeGap; i++)
+			{
+				if (before[i] != after[i])
+					end = i + 1;
+			}
+
+			addPatch(offset, end - offset, end - offset);
+			offset = end;
+		}
+	}
+
+	bool EditHistory::Apply(const Step& step, bool undo)
+	{
+		// Every entity is checked and rebuilt before any is touched, so a step applies whole or not at all
+		std::vector<Entity> targets;
+		std::vector<size_t> ends; // Into m_Scratch, one past each rebuilt encoding
+		targets.reserve(step.Entities.size());
+		ends.reserve(step.Entities.size());
+		m_Scratch.clear();
+
+		std::vector<uint8_t> current;
+		for (const EntityDelta& delta : step.Entities)
+		{
+			Entity entity = m_Scene->GetEntityByUUID(delta.Entity);
+			current.clear();
+			if (entity)
+				SceneSerialiser::SerialiseEntityBinary(entity, current);
+
+			// Deleted since, or changed by something the history never saw
+			uint32_t expectedSize = undo ? delta.AfterSize : delta.BeforeSize;
+			uint64_t expectedHash = undo ? delta.AfterHash : delta.BeforeHash;
+			if (!entity || current.size() != expectedSize || HashBytes(current.data(), current.size()) != expectedHash)
+			{
+				LOG_WARN("Edit history: entity {0} changed outside the history, nothing was {1}", delta.Entity, undo ? "undone" : "redone");
+				return false;
+			}
+
+			size_t start = m_Scratch.size();
+			uint32_t position = 0;
+			for (uint32_t i = 0; i < delta.PatchCount; i++)
+			{
+				const Patch& patch = step.Patches[delta.FirstPatch + i];
+				m_Scratch.insert(m_Scratch.end(), current.begin() + position, current.begin() + patch.Offset);
+
+				const uint8_t* bytes = step.Bytes.data() + patch.Data + (undo ? 0 : patch.BeforeSize);
+				m_Scratch.insert(m_Scratch.end(), bytes, bytes + (undo ? patch.BeforeSize : patch.AfterSize));
+				position = patch.Offset + (undo ? patch.AfterSize : patch.BeforeSize);
+			}
+			m_Scratch.insert(m_Scratch.end(), current.begin() + position, current.end());
+
+			if (HashBytes(m_Scratch.data() + start, m_Scratch.size() - start) != (undo ? delta.BeforeHash : delta.AfterHash))
+			{
+				LOG_ERROR("Edit history: step for entity {0} is corrupt, nothing was {1}", delta.Entity, undo ? "undone" : "redone");
+				return false;
+			}
+
+			targets.push_back(entity);
+			ends.push_back(m_Scratch.size());
+		}
+
+		bool applied = true;
+		size_t start = 0;
+		for (size_t i = 0; i < targets.size(); i++)
+		{
+			applied &= SceneSerialiser::DeserialiseEntityBinary(targets[i], m_Scratch.data() + start, ends[i] - start);
+			start = ends[i];
+		}
+
+		// Whatever was captured may be what just changed
+		m_SnapshotValid = false;
+		return applied;
+	}
+
+	bool EditHistory::Coalesce(const Step& step)
+	{
+		// Only onto the newest step, and only when the bytes changed are the same ones
+		if (m_Next == 0 || m_Next != m_Steps.size())
+			return false;
+
+		Step& last = m_Steps.back();
+		if (step.Time - last.Time > s_CoalesceWindow || step.Entities.size() != last.Entities.size() || step.Patches.size() != last.Patches.size())
+			return false;
+
+		for (size_t i = 0; i < step.Entities.size(); i++)
+		{
+			const EntityDelta& a = last.Entities[i];
+			const EntityDelta& b = step.Entities[i];
+			if (a.Entity != b.Entity || a.AfterSize != b.BeforeSize || a.AfterHash != b.BeforeHash || b.BeforeSize != b.AfterSize || a.FirstPatch != b.FirstPatch || a.PatchCount != b.PatchCount)
+				return false;
+		}
+
+		for (size_t i = 0; i < step.Patches.size(); i++)
+		{
+			const Patch& a = last.Patches[i];
+			const Patch& b = step.Patches[i];
+			if (a.Offset != b.Offset || a.AfterSize != b.BeforeSize || b.BeforeSize != b.AfterSize)
+				return false;
+		}
+
+		// Keep the oldest before bytes and take the newest after bytes
+		bool unchanged = true;
+		for (size_t i = 0; i < step.Patches.size(); i++)
+		{
+			const Patch& a = last.Patches[i];
+			const Patch& b = step.Patches[i];
+			uint8_t* merged = last.Bytes.data() + a.Data + a.BeforeSize;
+			std::memcpy(merged, step.Bytes.data() + b.Data + b.BeforeSize, b.AfterSize);
+			unchanged &= a.BeforeSize == a.AfterSize && std::memcmp(last.Bytes.data() + a.Data, merged, a.AfterSize) == 0;
+		}
+		for (size_t i = 0; i < step.Entities.size(); i++)
+			last.Entities[i].AfterHash = step.Entities[i].AfterHash;
+		last.Time = step.Time;
+
+		// Dragged back to where it started
+		if (unchanged)
+		{
+			m_MemoryUsage -= last.GetMemoryUsage();
+			m_Steps.pop_back();
+			m_Next--;
+		}
+		return true;
+	}
+
+	void EditHistory::Push(Step&& step)
+	{
+		// A new edit ends whatever could have been redone
+		while (m_Steps.size() > m_Next)
+		{
+			m_MemoryUsage -= m_Steps.back().GetMemoryUsage();
+			m_Steps.pop_back();
+		}
+
+		m_Steps.push_back(std::move(step));
+		m_MemoryUsage += m_Steps.back().GetMemoryUsage();
+		m_Next = m_Steps.size();
+		Trim();
+	}
+
+	void EditHistory::Trim()
+	{
+		// The newest step stays even over budget, so the last edit can always be undone
+		while (m_MemoryUsage > m_MemoryBudget && m_Steps.size() > 1)
+		{
+			if (m_Next > 0)
+			{
+				m_MemoryUsage -= m_Steps.front().GetMemoryUsage();
+				m_Steps.pop_front();
+				m_Next--;
+			}
+			else
+			{
+				// Everything is undone; the furthest redo is the least likely to be wanted
+				m_MemoryUsage -= m_Steps.back().GetMemoryUsage();
+				m_Steps.pop_back();
+			}
+		}
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "Scene/Scene.h"
+#include <deque>
+
+namespace DemoEngine
+{
+	// Undo history for component edits in the editor scene. A step keeps only the bytes that
+	// changed in each edited entity's binary encoding (SceneSerialiser::SerialiseEntityBinary),
+	// so undo and redo cost the size of the edit, not the size of the scene.
+	//
+	// The editor captures the selection before widgets or the gizmo can touch it and commits
+	// when the interaction ends, which makes a whole drag one step.
+	class EditHistory
+	{
+	public:
+		~EditHistory();
+
+		void SetContext(const Ref<Scene>& scene);
+		const Ref<Scene>& GetContext() const { return m_Scene; }
+
+		// Snapshots the entities an edit may change. Free when they are already the captured ones
+		// and nothing in the scene has changed since.
+		void Capture(const std::vector<entt::entity>& entities);
+		// Records what changed in the captured entities since Capture, then captures them again
+		void Commit();
+
+		bool Undo();
+		bool Redo();
+		bool CanUndo() const { return m_Next > 0; }
+		bool CanRedo() const { return m_Next < m_Steps.size(); }
+
+		// Oldest steps are dropped once the history holds more than this
+		void SetMemoryBudget(size_t bytes);
+		size_t GetMemoryBudget() const { return m_MemoryBudget; }
+		size_t GetMemoryUsage() const { return m_MemoryUsage; }
+		size_t GetStepCount() const { return m_Steps.size(); }
+
+	private:
+		// Offset is the same in both versions: equal-sized entities get one patch per changed run,
+		// resized ones a single patch between the common prefix and suffix
+		struct Patch
+		{
+			uint32_t Offset;
+			uint32_t BeforeSize, AfterSize;
+			uint32_t Data; // Into Step::Bytes; the before bytes, then the after bytes
+		};
+
+		struct EntityDelta
+		{
+			uint64_t Entity; // UUID, which survives the entity handle being recycled
+			uint32_t BeforeSize, AfterSize; // Of the whole encoding
+			uint64_t BeforeHash, AfterHash; // Of the whole encoding, to refuse entities changed outside the history
+			uint32_t FirstPatch, PatchCount;
+		};
+
+		struct Step
+		{
+			std::vector<EntityDelta> Entities;
+			std::vector<Patch> Patches;
+			std::vector<uint8_t> Bytes;
+			double Time = 0.0; // Of the last commit merged into it
+
+			size_t GetMemoryUsage() const;
+		};
+
+		struct Snapshot
+		{
+			std::vector<entt::entity> Entities;
+			std::vector<uint64_t> IDs; // UUIDs; 0 where the entity was not valid
+			std::vector<uint32_t> Offsets; // Into Bytes, one past the end per entity
+			std::vector<uint8_t> Bytes;
+		};
+
+		void OnSceneChanged(SceneRegistry&, entt::entity);
+
+		void TakeSnapshot(const std::vector<entt::entity>& entities, Snapshot& snapshot) const;
+		static void Diff(const uint8_t* before, uint32_t beforeSize, const uint8_t* after, uint32_t afterSize, Step& step);
+
+		bool Apply(const Step& step, bool undo);
+		bool Coalesce(const Step& step);
+		void Push(Step&& step);
+		void Trim();
+
+	private:
+		Ref<Scene> m_Scene;
+
+		std::deque<Step> m_Steps;
+		size_t m_Next = 0; // Steps before this are applied; the rest can be redone
+		size_t m_MemoryUsage = 0;
+		size_t m_MemoryBudget = 64 * 1024 * 1024;
+
+		Snapshot m_Snapshot;
+		bool m_SnapshotValid = false;
+		bool m_SceneChanged = false; // Since the snapshot was taken
+		std::vector<uint8_t> m_Scratch;
+	};
+}
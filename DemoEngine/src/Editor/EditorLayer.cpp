@@ -6,6 +6,9 @@
 
 #include "Utils/PlatformUtils.h"
 #include "Scene/SceneSerialiser.h"
+#include "Core/InputRecording.h"
+#include "Profiling/FlightRecorder.h"
+#include "Renderer/RenderThread.h"
 
 namespace DemoEngine
 {
@@ -26,23 +29,29 @@ namespace DemoEngine
 		framebufferSpec.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::RED_INTEGER, FramebufferTextureFormat::Depth };
 		framebufferSpec.Width = 1280;
 		framebufferSpec.Height = 720;
-		m_Framebuffer = Framebuffer::Create(framebufferSpec);
+		RenderThread::Submit([this, framebufferSpec]() { m_Framebuffer = Framebuffer::Create(framebufferSpec); });
 
 		// Initialize scenes
 		m_EditorScene = CreateRef<Scene>();
 		m_ActiveScene = m_EditorScene;
 		m_SceneHierarchyPanel.SetContext(m_ActiveScene);
+		m_SystemProfilerPanel.SetContext(m_ActiveScene);
 
 		// Load shaders
 		m_ShaderLibrary = CreateRef<ShaderLibrary>();
-		m_ShaderLibrary->Load("FlatColour", "assets/shaders/FlatColourShader.glsl");
+		RenderThread::Submit([this]() { m_ShaderLibrary->Load("FlatColour", "assets/shaders/FlatColourShader.glsl"); });
 
+		// The framebuffer is used straight away, so wait for the render thread to create it
+		RenderThread::WaitIdle();
 
+		// An idle editor sleeps instead of redrawing the same frame
+		Application::Get().SetOnDemandUpdates(true);
 	}
 
 	void EditorLayer::OnDetach()
 	{
-
+		TrackScene(nullptr);
+		m_History.SetContext(nullptr);
 	}
 
 	// Frame update logic
@@ -54,33 +63,41 @@ namespace DemoEngine
 			m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f && //zero sized framebuffer is invalid 
 			(spec.Width != m_ViewportSize.x || spec.Height != m_ViewportSize.y))
 		{
-			m_Framebuffer->Resize((uint32_t)m_ViewportSize.x, (uint32_t)m_ViewportSize.y);
+			// Synchronous, as the viewport image and specification are read on this thread
+			RenderThread::Submit([framebuffer = m_Framebuffer, width = (uint32_t)m_ViewportSize.x, height = (uint32_t)m_ViewportSize.y]()
+			{
+				framebuffer->Resize(width, height);
+			});
+			RenderThread::WaitIdle();
 			m_EditorCamera.OnResize(m_ViewportSize.x, m_ViewportSize.y);
 			m_EditorCamera.SetViewportSize(m_ViewportSize.x, m_ViewportSize.y);
 			m_ActiveScene->OnViewportResize((uint32_t)m_ViewportSize.x, (uint32_t)m_ViewportSize.y);
+			m_ViewportDirty = true;
 		}
 
-		Renderer2D::ResetStats();
-
-		m_Framebuffer->Bind();
+		if (m_TrackedScene != m_EditorScene)
+			TrackScene(m_EditorScene);
 
-		Renderer2D::SetClearColor({ 0.2f, 0.2f, 0.2f, 1.0f });
-		Renderer2D::Clear();
-
-		m_Framebuffer->ClearAttachment(1, -1);
-
-		// Scene state management
-		switch (m_SceneState)
+		if (m_SceneState == SceneState::Edit)
 		{
-		case SceneState::Edit:
 			m_EditorCamera.OnUpdate(ts);
-			m_ActiveScene->OnUpdateEditor(ts, m_EditorCamera);
-			break;
-		case SceneState::Play:
-			m_ActiveScene->OnUpdateRuntime(ts);
-			break;
+
+			glm::mat4 viewProjection = m_EditorCamera.GetViewProjection();
+			if (viewProjection != m_RenderedViewProjection)
+			{
+				m_RenderedViewProjection = viewProjection;
+				m_ViewportDirty = true;
+			}
+		}
+		else
+		{
+			// The simulation runs with or without input
+			Application::Get().RequestFrames();
 		}
 
+		// Unchanged edit frames keep the previous image, and picking reads from it
+		bool redraw = m_ViewportDirty || m_SceneState != SceneState::Edit || !Application::Get().IsOnDemandUpdates();
+
 		// Entity picking logic
 		auto [mx, my] = ImGui::GetMousePos();
 		mx -= m_ViewportBounds[0].x;
@@ -90,14 +107,72 @@ namespace DemoEngine
 
 		int mouseX = (int)mx;
 		int mouseY = (int)my;
-		if (mouseX >= 0 && mouseY >= 0 && mouseX < (int)m_ViewportSize.x && mouseY < (int)m_ViewportSize.y)
+		bool mouseInViewport = mouseX >= 0 && mouseY >= 0 && mouseX < (int)m_ViewportSize.x && mouseY < (int)m_ViewportSize.y;
+		bool pick = mouseInViewport && (redraw || m_PickedPixel != glm::ivec2(mouseX, mouseY));
+
+		// Edit mode picks against the spatial index, so only play mode needs the ID buffer read back
+		bool readPixel = pick && m_SceneState != SceneState::Edit;
+		if (pick && !readPixel)
 		{
-			int pixelData = m_Framebuffer->ReadPixel(1, mouseX, mouseY);
-			m_HoveredEntity = pixelData == -1 ? Entity() : Entity((entt::entity)pixelData, m_ActiveScene.get());
+			glm::vec3 origin, direction;
+			m_EditorCamera.GetRay({ mouseX + 0.5f, mouseY + 0.5f }, origin, direction);
+			SpatialRayHit hit = m_ActiveScene->GetSpatialIndex().RayCast(origin, direction, 1000.0f, SpatialCategory_Drawable);
+			m_HoveredPixel = hit ? (int)hit.Entity : -1;
+			m_PickedPixel = { mouseX, mouseY };
+		}
+
+		if (redraw || readPixel)
+		{
+			RenderThread::Submit([framebuffer = m_Framebuffer]() { framebuffer->Bind(); });
+
+			if (redraw)
+			{
+				Renderer2D::ResetStats();
 
+				Renderer2D::SetClearColor({ 0.2f, 0.2f, 0.2f, 1.0f });
+				Renderer2D::Clear();
+
+				RenderThread::Submit([framebuffer = m_Framebuffer]() { framebuffer->ClearAttachment(1, -1); });
+
+				// Scene state management
+				switch (m_SceneState)
+				{
+				case SceneState::Edit:
+					m_ActiveScene->OnUpdateEditor(ts, m_EditorCamera);
+					break;
+				case SceneState::Play:
+					InputRecorder::BeginFrame(ts);
+					m_ActiveScene->OnUpdateRuntime(ts);
+					break;
+				}
+
+				m_ViewportDirty = false;
+			}
+
+			if (readPixel)
+			{
+				// With a render thread the read lands a frame later rather than stalling the pipeline
+				// The job only touches its own framebuffer reference and the readback slot, never the layer
+				RenderThread::Submit([framebuffer = m_Framebuffer, readback = &m_ReadbackPixel, mouseX, mouseY]()
+				{
+					readback->store(framebuffer->ReadPixel(1, mouseX, mouseY));
+				});
+				m_PickedPixel = { mouseX, mouseY };
+			}
+
+			RenderThread::Submit([framebuffer = m_Framebuffer]() { framebuffer->Unbind(); });
 		}
 
-		m_Framebuffer->Unbind();
+		// Play mode hovers whatever the render thread read back last; edit mode set it from the ray cast
+		if (m_SceneState != SceneState::Edit)
+			m_HoveredPixel = m_ReadbackPixel.load();
+
+		if (mouseInViewport)
+		{
+			int pixelData = m_HoveredPixel;
+			bool hovered = pixelData != -1 && m_ActiveScene->IsEntityValid((entt::entity)pixelData);
+			m_HoveredEntity = hovered ? Entity((entt::entity)pixelData, m_ActiveScene.get()) : Entity();
+		}
 
 		auto stats = Renderer2D::GetStats();
 		//LOG_INFO("Draw Calls: {0}", stats.DrawCalls);
@@ -112,6 +187,13 @@ namespace DemoEngine
 		static bool dockspaceOpen = true;
 		ImGuiLibrary::CreateDockspace(dockspaceOpen, "Dockspace Demo");
 
+		// Snapshot the selection before any panel or the gizmo can change it; the edit is
+		// committed when the interaction ends, so a whole drag becomes one undo step
+		if (m_History.GetContext() != m_EditorScene)
+			m_History.SetContext(m_EditorScene);
+		if (m_SceneState == SceneState::Edit && !m_WasInteracting)
+			m_History.Capture(m_SceneHierarchyPanel.GetSelection());
+
 		if (ImGui::BeginMenuBar())
 		{
 			if (ImGui::BeginMenu("File"))
@@ -136,6 +218,15 @@ namespace DemoEngine
 					SaveSceneAs();
 				}
 
+				ImGui::Separator();
+
+				if (ImGui::MenuItem("Generate Stress Scene..."))
+				{
+					m_SceneGeneratorPanel.Open();
+				}
+
+				ImGui::Separator();
+
 				if (ImGui::MenuItem("Exit", "Ctrl+Q"))
 				{
 					dockspaceOpen = false; 
@@ -144,10 +235,30 @@ namespace DemoEngine
 
 				ImGui::EndMenu();
 			}
+
+			if (ImGui::BeginMenu("Edit"))
+			{
+				bool editing = m_SceneState == SceneState::Edit;
+				if (ImGui::MenuItem("Undo", "Ctrl+Z", false, editing && m_History.CanUndo()))
+				{
+					OnUndo();
+				}
+
+				if (ImGui::MenuItem("Redo", "Ctrl+Y", false, editing && m_History.CanRedo()))
+				{
+					OnRedo();
+				}
+
+				ImGui::EndMenu();
+			}
 			ImGui::EndMenuBar();
 		}
 
 		m_SceneHierarchyPanel.OnImGuiRender();
+		m_SystemProfilerPanel.OnImGuiRender();
+		m_MemoryPanel.OnImGuiRender();
+		if (m_SceneGeneratorPanel.OnImGuiRender())
+			GenerateScene(m_SceneGeneratorPanel.GetSettings());
 
 
 		//Creating new viewport
@@ -220,6 +331,46 @@ namespace DemoEngine
 			m_ActiveScene->SetShowColliders(showColliders);
 		}
 
+		bool logCollisions = m_ActiveScene->GetCollisionEvents().IsLoggingEnabled();
+		if (ImGui::Checkbox("Log Collisions", &logCollisions))
+		{
+			m_ActiveScene->GetCollisionEvents().SetLoggingEnabled(logCollisions);
+		}
+
+		// Trace format follows the extension, see Profiler::EndSession
+		if (!Profiler::IsSessionActive())
+		{
+			if (ImGui::Button("Start Trace (.json)"))
+				BeginTraceCapture(".json");
+			ImGui::SameLine();
+			if (ImGui::Button("Start Trace (.pftrace)"))
+				BeginTraceCapture(".pftrace");
+		}
+		else if (ImGui::Button("Stop Trace"))
+		{
+			Profiler::EndSession(m_TracePath);
+		}
+
+		bool flightRecorder = FlightRecorder::IsEnabled();
+		if (ImGui::Checkbox("Flight Recorder", &flightRecorder))
+			FlightRecorder::SetEnabled(flightRecorder);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Dumps the last seconds of profiling to Hitches/ when a frame is over budget (%u so far)", FlightRecorder::GetHitchCount());
+
+		if (flightRecorder)
+		{
+			float multiplier = FlightRecorder::GetBudgetMultiplier();
+			float minimum = FlightRecorder::GetBudgetMinimum();
+			bool changed = ImGui::DragFloat("Hitch Budget (x avg)", &multiplier, 0.05f, 1.1f, 10.0f, "%.2f");
+			changed |= ImGui::DragFloat("Hitch Minimum (ms)", &minimum, 0.5f, 1.0f, 1000.0f, "%.1f");
+			if (changed)
+				FlightRecorder::SetBudget(multiplier, minimum);
+		}
+
+		ImGui::Checkbox("Record Input", &m_RecordInput);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Saves play sessions to Recordings/ for replay with --replay");
+
 		bool shouldConnect = m_ActiveScene->m_ShouldConnectToServer;
 		if (ImGui::Checkbox("Connect to ENet Server", &shouldConnect))
 		{
@@ -232,6 +383,53 @@ namespace DemoEngine
 			}
 		}
 
+		ImGui::Separator();
+
+		Window& window = Application::Get().GetWindow();
+		FrameClock& frameClock = Application::Get().GetFrameClock();
+
+		bool vsync = window.IsVSync();
+		if (ImGui::Checkbox("VSync", &vsync))
+			window.SetVSync(vsync);
+		ImGui::SameLine();
+		bool smoothing = frameClock.IsSmoothing();
+		if (ImGui::Checkbox("Smooth Timestep", &smoothing))
+			frameClock.SetSmoothing(smoothing);
+
+		bool onDemand = Application::Get().IsOnDemandUpdates();
+		if (ImGui::Checkbox("Update On Demand", &onDemand))
+			Application::Get().SetOnDemandUpdates(onDemand);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Sleeps while idle and only redraws the viewport when the scene or camera changes.\nTurn off to measure steady-state frame times.");
+
+		int undoBudget = (int)(m_History.GetMemoryBudget() / (1024 * 1024));
+		if (ImGui::DragInt("Undo Budget (MB)", &undoBudget, 1.0f, 1, 4096))
+			m_History.SetMemoryBudget((size_t)std::max(undoBudget, 1) * 1024 * 1024);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("%zu undo steps using %.1f KB", m_History.GetStepCount(), m_History.GetMemoryUsage() / 1024.0);
+
+		float targetFPS = frameClock.GetTargetFPS();
+		if (ImGui::DragFloat("Target FPS", &targetFPS, 1.0f, 0.0f, 1000.0f, targetFPS > 0.0f ? "%.0f" : "Unlimited"))
+			frameClock.SetTargetFPS(std::max(targetFPS, 0.0f));
+
+		const FrameStats& frameStats = frameClock.GetStats();
+		ImGui::Text("Frame: %.2f ms (%.1f FPS)", frameStats.SmoothedFrameTime, frameStats.GetFPS());
+		ImGui::Text("Min/Max: %.2f / %.2f ms  p99: < %.0f ms", frameStats.MinFrameTime, frameStats.MaxFrameTime, frameStats.GetPercentile(0.99));
+
+		std::array<float, FrameStats::HistogramBuckets> histogram;
+		for (uint32_t i = 0; i < FrameStats::HistogramBuckets; i++)
+			histogram[i] = (float)frameStats.Histogram[i];
+		ImGui::PlotHistogram("##FrameHistogram", histogram.data(), (int)histogram.size(), 0, "Frame time (1 ms buckets)", 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+		if (ImGui::Button("Reset Frame Stats"))
+			frameClock.ResetStats();
+
+		if (RenderThread::IsThreaded())
+		{
+			RenderThreadStats renderStats = RenderThread::GetStats();
+			ImGui::Text("Render thread: %.2f ms, %u commands", renderStats.RenderTime, renderStats.CommandCount);
+			ImGui::Text("Main thread waited: %.2f ms", renderStats.WaitTime);
+		}
+
 
 		ImGui::End();
 
@@ -255,6 +453,28 @@ namespace DemoEngine
 		if (m_SceneState == SceneState::Edit)
 			OnOverlayRender();
 
+		if (m_MarqueeActive)
+		{
+			auto [x, y] = ImGui::GetMousePos();
+			glm::vec2 marqueeEnd = { x, y };
+
+			ImDrawList* drawList = ImGui::GetWindowDrawList();
+			ImVec2 min = { std::min(m_MarqueeStart.x, x), std::min(m_MarqueeStart.y, y) };
+			ImVec2 max = { std::max(m_MarqueeStart.x, x), std::max(m_MarqueeStart.y, y) };
+			drawList->AddRectFilled(min, max, IM_COL32(70, 130, 220, 40));
+			drawList->AddRect(min, max, IM_COL32(70, 130, 220, 200));
+
+			if (!ImGui::IsMouseDown(ImGuiMouseButton_Left))
+			{
+				m_MarqueeActive = false;
+
+				// Anything shorter was a click, which already set the selection
+				glm::vec2 drag = glm::abs(marqueeEnd - m_MarqueeStart);
+				if (drag.x > 4.0f || drag.y > 4.0f)
+					SelectInMarquee(m_MarqueeStart, marqueeEnd, ImGui::GetIO().KeyCtrl);
+			}
+		}
+
 		//Gizmos
 		Entity selectedEntity = m_SceneHierarchyPanel.GetSelectedEntity();
 		if (selectedEntity && m_GizmoType != -1)
@@ -291,17 +511,31 @@ namespace DemoEngine
 				glm::vec3 translation, rotation, scale;
 				Math::DecomposeTransform(transform, translation, rotation, scale);
 
-				entityTransform.Translation = translation;
-				entityTransform.Scale = scale;
+				selectedEntity.PatchComponent<TransformComponent>([&](TransformComponent& entityTransform)
+				{
+					entityTransform.Translation = translation;
+					entityTransform.Scale = scale;
 
-				glm::vec3 deltaRotation = rotation - entityTransform.Rotation;
-				entityTransform.Rotation += deltaRotation;
+					glm::vec3 deltaRotation = rotation - entityTransform.Rotation;
+					entityTransform.Rotation += deltaRotation;
+				});
 			}
 		}
 
 		ImGui::End();
 		ImGui::PopStyleVar();
 
+		// Widgets and the gizmo write straight into components, which the registry never sees
+		bool interacting = ImGui::IsAnyItemActive() || ImGuizmo::IsUsing();
+		if (interacting || m_WasInteracting)
+		{
+			m_ViewportDirty = true;
+			Application::Get().RequestFrames();
+		}
+		if (m_SceneState == SceneState::Edit && m_WasInteracting && !interacting)
+			m_History.Commit();
+		m_WasInteracting = interacting;
+
 		//End dockspace
 		ImGui::End();
 
@@ -318,6 +552,40 @@ namespace DemoEngine
 	}
 
 
+	void EditorLayer::TrackScene(const Ref<Scene>& scene)
+	{
+		if (m_TrackedScene)
+		{
+			SceneRegistry& registry = m_TrackedScene->m_Registry;
+			ForEachComponent(AllComponents{}, [this, &registry](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				registry.on_construct<T>().disconnect(this);
+				registry.on_update<T>().disconnect(this);
+				registry.on_destroy<T>().disconnect(this);
+			});
+		}
+
+		m_TrackedScene = scene;
+		m_ViewportDirty = true;
+		if (!m_TrackedScene)
+			return;
+
+		SceneRegistry& registry = m_TrackedScene->m_Registry;
+		ForEachComponent(AllComponents{}, [this, &registry](auto componentType)
+		{
+			using T = typename decltype(componentType)::Type;
+			registry.on_construct<T>().template connect<&EditorLayer::OnSceneChanged>(*this);
+			registry.on_update<T>().template connect<&EditorLayer::OnSceneChanged>(*this);
+			registry.on_destroy<T>().template connect<&EditorLayer::OnSceneChanged>(*this);
+		});
+	}
+
+	void EditorLayer::OnSceneChanged(SceneRegistry&, entt::entity)
+	{
+		m_ViewportDirty = true;
+	}
+
 	// Processes events sent to this layer
 	void EditorLayer::OnEvent(Event& e)
 	{
@@ -335,7 +603,19 @@ namespace DemoEngine
 		{
 			if (m_ViewportHovered && !ImGuizmo::IsOver() && !Input::IsKeyPressed(Key::LeftAlt))
 			{
-				m_SceneHierarchyPanel.SetSelectedEntity(m_HoveredEntity);
+				bool additive = Input::IsKeyPressed(Key::LeftControl);
+				if (additive && m_HoveredEntity)
+					m_SceneHierarchyPanel.ToggleSelected(m_HoveredEntity);
+				else if (!additive)
+					m_SceneHierarchyPanel.SetSelectedEntity(m_HoveredEntity);
+
+				// Dragging from empty space draws a selection rectangle
+				if (!m_HoveredEntity && m_SceneState == SceneState::Edit)
+				{
+					auto [x, y] = ImGui::GetMousePos();
+					m_MarqueeStart = { x, y };
+					m_MarqueeActive = true;
+				}
 			}
 		}
 
@@ -388,6 +668,22 @@ namespace DemoEngine
 			break;
 		}
 
+		// Mid-drag, the edit in progress is not in the history yet
+		case Key::Z:
+		{
+			if (control && shift && !m_WasInteracting)
+				OnRedo();
+			if (control && !shift && !m_WasInteracting)
+				OnUndo();
+			break;
+		}
+		case Key::Y:
+		{
+			if (control && !m_WasInteracting)
+				OnRedo();
+			break;
+		}
+
 		//Gizmo shortcuts
 		case Key::Q:
 			if (m_ViewportHovered)
@@ -420,13 +716,14 @@ namespace DemoEngine
 		m_ActiveScene = m_EditorScene;
 		m_ActiveScene->OnViewportResize((uint32_t)m_ViewportSize.x, (uint32_t)m_ViewportSize.y);
 		m_SceneHierarchyPanel.SetContext(m_ActiveScene);
+		m_SystemProfilerPanel.SetContext(m_ActiveScene);
 		m_EditorSceneFilePath.clear();
 	}
 
 	// Open a scene via file dialog
 	void EditorLayer::OpenScene()
 	{
-		std::string path = FileDialogs::OpenFile("DemoEngine Scene (*.demoengine)\0*.demoengine\0");
+		std::string path = FileDialogs::OpenFile("DemoEngine Scene (*.demoengine;*.demoenginebin)\0*.demoengine;*.demoenginebin\0");
 		if (!path.empty())
 		{
 			OpenScene(path);
@@ -441,7 +738,7 @@ namespace DemoEngine
 			OnSceneStop();
 		}
 
-		if (path.extension().string() != ".demoengine")
+		if (!SceneSerialiser::IsScenePath(path.string()))
 		{
 			LOG_WARN("Could not load {0} - not a scene file", path.filename().string());
 			return;
@@ -456,6 +753,7 @@ namespace DemoEngine
 			m_EditorScene = newScene;
 			m_EditorScene->OnViewportResize((uint32_t)m_ViewportSize.x, (uint32_t)m_ViewportSize.y);
 			m_SceneHierarchyPanel.SetContext(m_EditorScene);
+			m_SystemProfilerPanel.SetContext(m_EditorScene);
 		}
 
 		m_ActiveScene = m_EditorScene;
@@ -478,7 +776,7 @@ namespace DemoEngine
 	void EditorLayer::SaveSceneAs()
 	{
 		//std::string path = PlatformUtils::ShowFileOpen();
-		std::string path = FileDialogs::SaveFile("DemoEngine Scene (*.demoengine)\0*.demoengine\0");
+		std::string path = FileDialogs::SaveFile("DemoEngine Scene (*.demoengine)\0*.demoengine\0DemoEngine Binary Scene (*.demoenginebin)\0*.demoenginebin\0");
 		if (!path.empty())
 		{
 			SerialiseScene(m_EditorScene, path);
@@ -486,6 +784,18 @@ namespace DemoEngine
 		m_EditorSceneFilePath = path;
 	}
 
+	// Replace the editor scene with a procedural one; it has no file until saved
+	void EditorLayer::GenerateScene(const SceneGeneratorSettings& settings)
+	{
+		if (m_SceneState != SceneState::Edit)
+		{
+			OnSceneStop();
+		}
+
+		NewScene();
+		SceneGenerator::Generate(m_EditorScene, settings);
+	}
+
 	// Handles actual serialization logic
 	void EditorLayer::SerialiseScene(Ref<Scene> scene, const std::filesystem::path& path)
 	{
@@ -494,6 +804,14 @@ namespace DemoEngine
 	}
 	
 
+	void EditorLayer::BeginTraceCapture(const std::string& extension)
+	{
+		std::string name = "Trace_" + LocalTime::Format();
+
+		m_TracePath = "Profiles/" + name + extension;
+		Profiler::BeginSession(name);
+	}
+
 	// Starts runtime playback
 	void EditorLayer::OnScenePlay()
 	{
@@ -505,8 +823,19 @@ namespace DemoEngine
 
 		m_RuntimeScene->OnRuntimeStart();
 
+		if (m_RecordInput)
+		{
+			// The scene as played, which may be unsaved or differ from the file
+			std::vector<uint8_t> scene;
+			SceneSerialiser(m_EditorScene).SerialiseBinary(scene);
+
+			std::string sceneName = m_EditorSceneFilePath.empty() ? "Untitled" : m_EditorSceneFilePath.stem().string();
+			InputRecorder::StartRecording(std::filesystem::path("Recordings") / (sceneName + ".derec"), m_EditorSceneFilePath.string(), scene);
+		}
+
 		m_ActiveScene = m_RuntimeScene;
 		m_SceneHierarchyPanel.SetContext(m_ActiveScene);
+		m_SystemProfilerPanel.SetContext(m_ActiveScene);
 	}
 
 	// Stops runtime playback
@@ -514,12 +843,15 @@ namespace DemoEngine
 	{
 		m_SceneState = SceneState::Edit;
 
+		InputRecorder::StopRecording();
 		m_RuntimeScene->OnRuntimeStop();
 		//Unload runtime scene, i.e. delete it 
 		m_RuntimeScene = nullptr;
 
 		m_ActiveScene = m_EditorScene;
 		m_SceneHierarchyPanel.SetContext(m_ActiveScene);
+		m_SystemProfilerPanel.SetContext(m_ActiveScene);
+		m_ViewportDirty = true; // Still showing the runtime scene
 
 		m_EditorScene->m_ShouldConnectToServer = false;
 	}
@@ -546,10 +878,116 @@ namespace DemoEngine
 			LOG_WARN("Entity Deletion permitted in Edit Mode ONLY");
 			return;
 		}
-		if (m_SceneHierarchyPanel.GetSelectedEntity())
+
+		std::vector<entt::entity> selection = m_SceneHierarchyPanel.GetSelection();
+		m_SceneHierarchyPanel.SetSelectedEntity({}); //Must clear to avoid a crash
+		for (entt::entity entity : selection)
 		{
-			m_EditorScene->DestroyEntity(m_SceneHierarchyPanel.GetSelectedEntity());
-			m_SceneHierarchyPanel.SetSelectedEntity({}); //Must clear to avoid a crash
+			if (m_EditorScene->IsEntityValid(entity))
+				m_EditorScene->DestroyEntity({ entity, m_EditorScene.get() });
 		}
 	}
+
+	void EditorLayer::OnUndo()
+	{
+		if (m_SceneState != SceneState::Edit)
+		{
+			LOG_WARN("Undo permitted in Edit Mode ONLY");
+			return;
+		}
+
+		m_History.Undo();
+	}
+
+	void EditorLayer::OnRedo()
+	{
+		if (m_SceneState != SceneState::Edit)
+		{
+			LOG_WARN("Redo permitted in Edit Mode ONLY");
+			return;
+		}
+
+		m_History.Redo();
+	}
+
+	void EditorLayer::SelectInMarquee(const glm::vec2& start, const glm::vec2& end, bool additive)
+	{
+		PROFILE_FUNCTION();
+
+		// Screen positions to viewport pixels from the bottom-left, as the camera expects
+		auto toViewport = [this](const glm::vec2& screen)
+		{
+			return glm::vec2(screen.x - m_ViewportBounds[0].x, m_ViewportSize.y - (screen.y - m_ViewportBounds[0].y));
+		};
+		glm::vec2 rectMin = glm::min(toViewport(start), toViewport(end));
+		glm::vec2 rectMax = glm::max(toViewport(start), toViewport(end));
+
+		SpatialIndex& index = m_ActiveScene->GetSpatialIndex();
+		float minZ, maxZ;
+		index.GetDepthRange(minZ, maxZ);
+
+		// Everything that can be inside the rectangle lies where its corner rays cross the scene's depth range
+		glm::vec2 queryMin = glm::vec2(FLT_MAX);
+		glm::vec2 queryMax = glm::vec2(-FLT_MAX);
+		bool bounded = true;
+		glm::vec2 corners[4] = { rectMin, { rectMax.x, rectMin.y }, rectMax, { rectMin.x, rectMax.y } };
+		for (const glm::vec2& corner : corners)
+		{
+			glm::vec3 origin, direction;
+			m_EditorCamera.GetRay(corner, origin, direction);
+			for (float z : { minZ, maxZ })
+			{
+				float t = std::abs(direction.z) > 1e-6f ? (z - origin.z) / direction.z : -1.0f;
+				if (t < 0.0f)
+				{
+					bounded = false;
+					continue;
+				}
+
+				glm::vec2 point = glm::vec2(origin + direction * t);
+				queryMin = glm::min(queryMin, point);
+				queryMax = glm::max(queryMax, point);
+			}
+		}
+		if (!bounded)
+		{
+			queryMin = glm::vec2(-FLT_MAX);
+			queryMax = glm::vec2(FLT_MAX);
+		}
+
+		std::vector<entt::entity> candidates;
+		index.QueryRect(queryMin, queryMax, candidates, SpatialCategory_Drawable);
+
+		std::vector<entt::entity> selection;
+		if (additive)
+			selection = m_SceneHierarchyPanel.GetSelection();
+
+		// The query is conservative; keep what overlaps the rectangle on screen
+		for (entt::entity entity : candidates)
+		{
+			glm::vec2 min, max;
+			index.GetBounds(entity, min, max);
+			float z = Entity(entity, m_ActiveScene.get()).GetComponent<TransformComponent>().Translation.z;
+
+			glm::vec2 screenMin = glm::vec2(FLT_MAX);
+			glm::vec2 screenMax = glm::vec2(-FLT_MAX);
+			bool visible = true;
+			for (const glm::vec2& corner : { min, glm::vec2(max.x, min.y), max, glm::vec2(min.x, max.y) })
+			{
+				glm::vec2 screen;
+				if (!m_EditorCamera.WorldToViewport({ corner, z }, screen))
+				{
+					visible = false;
+					break;
+				}
+				screenMin = glm::min(screenMin, screen);
+				screenMax = glm::max(screenMax, screen);
+			}
+
+			if (visible && screenMin.x <= rectMax.x && screenMax.x >= rectMin.x && screenMin.y <= rectMax.y && screenMax.y >= rectMin.y)
+				selection.push_back(entity);
+		}
+
+		m_SceneHierarchyPanel.SetSelection(std::move(selection));
+	}
 }
\ No newline at end of file
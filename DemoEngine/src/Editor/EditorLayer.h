@@ -2,6 +2,11 @@
 #include "DemoEngine.h"
 #include "Renderer/Camera/EditorCamera.h"
 #include "Editor/Panels/SceneHierarchyPanel.h"
+#include "Editor/Panels/SystemProfilerPanel.h"
+#include "Editor/Panels/MemoryPanel.h"
+#include "Editor/Panels/SceneGeneratorPanel.h"
+#include "Editor/EditHistory.h"
+#include <atomic>
 #include <filesystem>
 
 namespace DemoEngine
@@ -21,6 +26,7 @@ namespace DemoEngine
 		void OnEvent(Event& e) override;
 
 		bool m_DisplayColliders = true;
+		bool m_RecordInput = false; // Record play sessions for headless replay
 
 	//private:
 		//bool OnWindowResize(WindowResizeEvent& e);
@@ -34,6 +40,7 @@ namespace DemoEngine
 		void OpenScene(const std::filesystem::path& path);
 		void SaveScene();
 		void SaveSceneAs();
+		void GenerateScene(const SceneGeneratorSettings& settings);
 		void SerialiseScene(Ref<Scene> scene, const std::filesystem::path& path);
 
 		void OnScenePlay();
@@ -42,8 +49,20 @@ namespace DemoEngine
 		void OnDuplicateEntity();
 		void OnDeleteEntity();
 
+		void OnUndo();
+		void OnRedo();
+
 		void OnOverlayRender();
 
+		// Selects every drawable whose on-screen bounds overlap the rectangle between two screen positions
+		void SelectInMarquee(const glm::vec2& start, const glm::vec2& end, bool additive);
+
+		// Marks the viewport dirty on any component added, patched or removed in scene
+		void TrackScene(const Ref<Scene>& scene);
+		void OnSceneChanged(SceneRegistry&, entt::entity);
+
+		void BeginTraceCapture(const std::string& extension);
+
 	private:
 		EditorCamera m_EditorCamera;
 		Ref<Framebuffer> m_Framebuffer;
@@ -57,14 +76,33 @@ namespace DemoEngine
 
 		int m_GizmoType = -1;
 
+		std::string m_TracePath; // Written when the running trace capture stops
+
 		bool m_ViewportFocused = false;
 		bool m_ViewportHovered = false;
 		glm::vec2 m_ViewportSize = { 0.0f,0.0f };
 		glm::vec2 m_ViewportBounds[2];
 
 		Entity m_HoveredEntity;
+		int m_HoveredPixel = -1; // Entity ID under the mouse
+		std::atomic<int> m_ReadbackPixel = -1; // Last ID buffer read, written by the render thread
+		glm::ivec2 m_PickedPixel = { -1, -1 }; // Where m_HoveredPixel was last read
+
+		bool m_MarqueeActive = false;
+		glm::vec2 m_MarqueeStart = { 0.0f, 0.0f }; // Screen position
+
+		// With on-demand updates, edit mode only redraws the viewport when this is set
+		bool m_ViewportDirty = true;
+		bool m_WasInteracting = false; // A widget or the gizmo was active last frame
+		glm::mat4 m_RenderedViewProjection = glm::mat4(0.0f);
+		Ref<Scene> m_TrackedScene;
 
 		SceneHierarchyPanel m_SceneHierarchyPanel;
+		SystemProfilerPanel m_SystemProfilerPanel;
+		MemoryPanel m_MemoryPanel;
+		SceneGeneratorPanel m_SceneGeneratorPanel;
+
+		EditHistory m_History; // Component edits in the editor scene
 
 
 		enum class SceneState
@@ -0,0 +1,291 @@
+#include "DemoEngine_PCH.h"
+#include "HierarchyIndex.h"
+#include "Scene/Components.h"
+#include <cctype>
+
+namespace DemoEngine
+{
+	static std::string ToLower(const std::string& text)
+	{
+		std::string lower(text);
+		for (char& c : lower)
+			c = (char)std::tolower((unsigned char)c);
+		return lower;
+	}
+
+	// Distinct byte trigrams of text, sorted
+	static void GetTrigrams(const std::string& text, std::vector<uint32_t>& trigrams)
+	{
+		trigrams.clear();
+		for (size_t i = 0; i + 3 <= text.size(); i++)
+			trigrams.push_back((uint32_t)(uint8_t)text[i] << 16 | (uint32_t)(uint8_t)text[i + 1] << 8 | (uint8_t)text[i + 2]);
+
+		std::sort(trigrams.begin(), trigrams.end());
+		trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+	}
+
+	static size_t CountTrigrams(const std::string& text)
+	{
+		std::vector<uint32_t> trigrams;
+		GetTrigrams(text, trigrams);
+		return trigrams.size();
+	}
+
+	HierarchyIndex::~HierarchyIndex()
+	{
+		Disconnect();
+	}
+
+	void HierarchyIndex::SetContext(const Ref<Scene>& scene)
+	{
+		PROFILE_FUNCTION();
+
+		Disconnect();
+		Clear();
+
+		m_Scene = scene;
+		if (!m_Scene)
+			return;
+
+		Connect();
+
+		// Packed storage iterates newest first; walk it backwards for creation order
+		const ScenePool& tags = m_Scene->m_Registry.storage<TagComponent>();
+		m_Pending.assign(tags.rbegin(), tags.rend());
+		m_Order.reserve(tags.size());
+		m_MatchesDirty = true;
+		Update();
+	}
+
+	void HierarchyIndex::SetFilter(const std::string& filter)
+	{
+		std::string lower = ToLower(filter);
+		if (lower == m_Filter)
+			return;
+
+		m_Filter = std::move(lower);
+		m_MatchesDirty = true;
+	}
+
+	void HierarchyIndex::Update()
+	{
+		PROFILE_FUNCTION();
+
+		for (entt::entity entity : m_Pending)
+			Index(entity);
+		m_Pending.clear();
+
+		if (m_Removed > 0)
+			Compact();
+
+		if (m_StalePostings > std::max<size_t>(m_LivePostings, 4096))
+			RebuildTrigrams();
+
+		if (m_MatchesDirty)
+			RefreshMatches();
+	}
+
+	size_t HierarchyIndex::FindRow(entt::entity entity) const
+	{
+		uint32_t index = ToIndex(entity);
+		if (index >= m_Position.size() || m_Position[index] == npos || m_Order[m_Position[index]] != entity)
+			return npos;
+
+		if (m_Filter.empty())
+			return m_Position[index];
+
+		// Matches are kept in creation order too
+		auto it = std::lower_bound(m_Matches.begin(), m_Matches.end(), entity, [this](entt::entity a, entt::entity b)
+		{
+			return m_Position[ToIndex(a)] < m_Position[ToIndex(b)];
+		});
+		return it != m_Matches.end() && *it == entity ? (size_t)(it - m_Matches.begin()) : npos;
+	}
+
+	void HierarchyIndex::OnTagChanged(SceneRegistry&, entt::entity entity)
+	{
+		m_Pending.push_back(entity);
+	}
+
+	void HierarchyIndex::OnTagDestroyed(SceneRegistry&, entt::entity entity)
+	{
+		uint32_t index = ToIndex(entity);
+		if (index >= m_Position.size() || m_Position[index] == npos)
+			return;
+
+		m_Order[m_Position[index]] = entt::null;
+		m_Position[index] = npos;
+		m_Removed++;
+
+		size_t postings = CountTrigrams(m_Names[index]);
+		m_LivePostings -= postings;
+		m_StalePostings += postings;
+		m_Names[index].clear();
+
+		m_MatchesDirty |= !m_Filter.empty();
+	}
+
+	void HierarchyIndex::Connect()
+	{
+		auto& registry = m_Scene->m_Registry;
+		registry.on_construct<TagComponent>().connect<&HierarchyIndex::OnTagChanged>(*this);
+		registry.on_update<TagComponent>().connect<&HierarchyIndex::OnTagChanged>(*this);
+		registry.on_destroy<TagComponent>().connect<&HierarchyIndex::OnTagDestroyed>(*this);
+	}
+
+	void HierarchyIndex::Disconnect()
+	{
+		if (!m_Scene)
+			return;
+
+		auto& registry = m_Scene->m_Registry;
+		registry.on_construct<TagComponent>().disconnect(this);
+		registry.on_update<TagComponent>().disconnect(this);
+		registry.on_destroy<TagComponent>().disconnect(this);
+	}
+
+	void HierarchyIndex::Clear()
+	{
+		m_Scene = nullptr;
+		m_Order.clear();
+		m_Position.clear();
+		m_Names.clear();
+		m_Pending.clear();
+		m_Removed = 0;
+		m_Trigrams.clear();
+		m_LivePostings = 0;
+		m_StalePostings = 0;
+		m_Matches.clear();
+		m_MatchesDirty = !m_Filter.empty();
+	}
+
+	void HierarchyIndex::Index(entt::entity entity)
+	{
+		auto& registry = m_Scene->m_Registry;
+		if (!registry.valid(entity) || !registry.all_of<TagComponent>(entity))
+			return;
+
+		uint32_t index = ToIndex(entity);
+		if (index >= m_Position.size())
+		{
+			m_Position.resize(index + 1, npos);
+			m_Names.resize(index + 1);
+		}
+
+		std::string name = ToLower(registry.get<TagComponent>(entity).Tag);
+		if (m_Position[index] == npos)
+		{
+			m_Position[index] = m_Order.size();
+			m_Order.push_back(entity);
+			AddTrigrams(entity, name);
+			m_Names[index] = std::move(name);
+
+			// New entities go last, so a match can be appended without a full refresh
+			if (!m_Filter.empty() && !m_MatchesDirty && Matches(entity))
+				m_Matches.push_back(entity);
+		}
+		else if (name != m_Names[index])
+		{
+			size_t postings = CountTrigrams(m_Names[index]);
+			m_LivePostings -= postings;
+			m_StalePostings += postings;
+
+			AddTrigrams(entity, name);
+			m_Names[index] = std::move(name);
+			m_MatchesDirty |= !m_Filter.empty();
+		}
+	}
+
+	void HierarchyIndex::Compact()
+	{
+		size_t count = 0;
+		for (entt::entity entity : m_Order)
+		{
+			if (entity == entt::null)
+				continue;
+
+			m_Position[ToIndex(entity)] = count;
+			m_Order[count++] = entity;
+		}
+		m_Order.resize(count);
+		m_Removed = 0;
+	}
+
+	void HierarchyIndex::AddTrigrams(entt::entity entity, const std::string& name)
+	{
+		std::vector<uint32_t> trigrams;
+		GetTrigrams(name, trigrams);
+		for (uint32_t trigram : trigrams)
+			m_Trigrams[trigram].push_back(entity);
+		m_LivePostings += trigrams.size();
+	}
+
+	void HierarchyIndex::RebuildTrigrams()
+	{
+		PROFILE_FUNCTION();
+
+		m_Trigrams.clear();
+		m_LivePostings = 0;
+		m_StalePostings = 0;
+		for (entt::entity entity : m_Order)
+		{
+			if (entity != entt::null)
+				AddTrigrams(entity, m_Names[ToIndex(entity)]);
+		}
+	}
+
+	void HierarchyIndex::RefreshMatches()
+	{
+		PROFILE_FUNCTION();
+
+		m_Matches.clear();
+		m_MatchesDirty = false;
+		if (m_Filter.empty())
+			return;
+
+		if (m_Filter.size() < 3)
+		{
+			// Too short for a trigram; the cached names are still cheaper than the registry
+			for (entt::entity entity : m_Order)
+			{
+				if (entity != entt::null && m_Names[ToIndex(entity)].find(m_Filter) != std::string::npos)
+					m_Matches.push_back(entity);
+			}
+			return;
+		}
+
+		// Every match contains all of the filter's trigrams, so the rarest one bounds the candidates
+		std::vector<uint32_t> trigrams;
+		GetTrigrams(m_Filter, trigrams);
+
+		const std::vector<entt::entity>* candidates = nullptr;
+		for (uint32_t trigram : trigrams)
+		{
+			auto it = m_Trigrams.find(trigram);
+			if (it == m_Trigrams.end())
+				return;
+			if (!candidates || it->second.size() < candidates->size())
+				candidates = &it->second;
+		}
+
+		for (entt::entity entity : *candidates)
+		{
+			if (Matches(entity))
+				m_Matches.push_back(entity);
+		}
+
+		// Renamed entities can be listed more than once
+		std::sort(m_Matches.begin(), m_Matches.end(), [this](entt::entity a, entt::entity b)
+		{
+			return m_Position[ToIndex(a)] < m_Position[ToIndex(b)];
+		});
+		m_Matches.erase(std::unique(m_Matches.begin(), m_Matches.end()), m_Matches.end());
+	}
+
+	bool HierarchyIndex::Matches(entt::entity entity) const
+	{
+		uint32_t index = ToIndex(entity);
+		return index < m_Position.size() && m_Position[index] != npos && m_Order[m_Position[index]] == entity
+			&& m_Names[index].find(m_Filter) != std::string::npos;
+	}
+}
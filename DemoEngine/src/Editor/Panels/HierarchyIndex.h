@@ -0,0 +1,77 @@
+#pragma once
+#include "Core/Core.h"
+#include "Scene/Scene.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace DemoEngine
+{
+	// Row list behind the scene hierarchy. Keeps every tagged entity in creation order
+	// and a trigram index over lower-cased tags, both updated from registry signals
+	// instead of walking the registry each frame. Tags are read in Update, so names
+	// assigned after AddComponent<TagComponent> are picked up in the same frame.
+	// Renames must go through Entity::PatchComponent<TagComponent> to be seen.
+	class HierarchyIndex
+	{
+	public:
+		static constexpr size_t npos = ~(size_t)0;
+
+		HierarchyIndex() = default;
+		~HierarchyIndex();
+
+		HierarchyIndex(const HierarchyIndex&) = delete;
+		HierarchyIndex& operator=(const HierarchyIndex&) = delete;
+
+		// Rebuilds the index and moves the signal connections to scene
+		void SetContext(const Ref<Scene>& scene);
+
+		// Case-insensitive substring filter; empty shows every entity
+		void SetFilter(const std::string& filter);
+		const std::string& GetFilter() const { return m_Filter; }
+
+		// Applies the changes recorded since the last call. Call once per frame before GetRows.
+		void Update();
+
+		// Entities to display, in creation order. Entries destroyed since Update are entt::null.
+		const std::vector<entt::entity>& GetRows() const { return m_Filter.empty() ? m_Order : m_Matches; }
+		size_t FindRow(entt::entity entity) const; // npos if filtered out
+		size_t GetEntityCount() const { return m_Order.size() - m_Removed; }
+
+	private:
+		void OnTagChanged(SceneRegistry&, entt::entity entity);
+		void OnTagDestroyed(SceneRegistry&, entt::entity entity);
+
+		void Connect();
+		void Disconnect();
+		void Clear();
+
+		void Index(entt::entity entity);
+		void Compact();
+		void AddTrigrams(entt::entity entity, const std::string& name);
+		void RebuildTrigrams();
+		void RefreshMatches();
+		bool Matches(entt::entity entity) const;
+
+		static uint32_t ToIndex(entt::entity entity) { return entt::to_entity(entity); }
+
+	private:
+		Ref<Scene> m_Scene;
+
+		std::vector<entt::entity> m_Order; // entt::null where destroyed, until Compact
+		std::vector<size_t> m_Position; // By entity index: slot in m_Order, or npos
+		std::vector<std::string> m_Names; // By entity index: lower-cased tag
+		std::vector<entt::entity> m_Pending; // Constructed or renamed since Update
+		size_t m_Removed = 0;
+
+		// Postings are never erased; stale ones fail the substring check and are
+		// dropped when they outnumber the live ones
+		std::unordered_map<uint32_t, std::vector<entt::entity>> m_Trigrams;
+		size_t m_LivePostings = 0;
+		size_t m_StalePostings = 0;
+
+		std::string m_Filter; // Lower-cased
+		std::vector<entt::entity> m_Matches;
+		bool m_MatchesDirty = false;
+	};
+}
@@ -3,6 +3,7 @@
 #include "ImGui/ImGuiLibrary.h"
 #include <imgui/imgui.h>
 #include "Scene/Components.h"
+#include "Scene/ComponentRegistry.h"
 #include <glm/gtc/type_ptr.hpp>
 #include "Utils/PlatformUtils.h"
 
@@ -21,17 +22,12 @@ namespace DemoEngine
 		// If the popup is open, show the available components
 		if (ImGui::BeginPopup("AddComponent"))
 		{
-			DrawAddComponentMenuItem<SpriteRendererComponent>(entity, "Sprite Renderer");
-			DrawAddComponentMenuItem<CircleRendererComponent>(entity, "Circle Renderer");
-			DrawAddComponentMenuItem<CameraComponent>(entity, "Camera");
-
-			DrawAddComponentMenuItem<Rigidbody2DComponent>(entity, "Rigidbody 2D");
-			DrawAddComponentMenuItem<BoxCollider2DComponent>(entity, "Box Collider 2D");
-			DrawAddComponentMenuItem<CircleCollider2DComponent>(entity, "Circle Collider 2D");
-
-			DrawAddComponentMenuItem<AudioComponent>(entity, "Audio Component");
-
-			DrawAddComponentMenuItem<PlayerControllerComponent>(entity, "Player Controller"); // Custom player controller
+			ForEachComponent(AllComponents{}, [&](auto componentType)
+				{
+					using T = typename decltype(componentType)::Type;
+					if constexpr (HasComponentFlag<T>(ComponentFlags_Addable))
+						DrawAddComponentMenuItem<T>(entity, ComponentTraits<T>::DisplayName);
+				});
 
 			ImGui::EndPopup();
 		}
@@ -50,197 +46,197 @@ namespace DemoEngine
 		}
 	}
 
-	// Draws the UI to inspect and edit all components of an entity
-	void InspectorPanel::DrawComponents(Entity entity)
+	// Transform Component UI
+	static void DrawComponentProperties(Entity entity, TransformComponent& component)
 	{
-		// Edit tag (name) of the entity
-		if (entity.HasComponent<TagComponent>())
+		bool changed = ImGuiLibrary::DrawVec3Control("Translation", component.Translation);
+		glm::vec3 rotation = glm::degrees(component.Rotation);
+		if (ImGuiLibrary::DrawVec3Control("Rotation", rotation))
 		{
-			auto& tag = entity.GetComponent<TagComponent>().Tag;
-			char buffer[256];
-			memset(buffer, 0, sizeof(buffer));
-			strcpy_s(buffer, sizeof(buffer), tag.c_str());
-			if (ImGui::InputText("##Tag", buffer, sizeof(buffer)))
-			{
-				tag = std::string(buffer);
-			}
+			component.Rotation = glm::radians(rotation);
+			changed = true;
 		}
+		changed |= ImGuiLibrary::DrawVec3Control("Scale", component.Scale, 1.0f);
 
-		// Transform Component UI
-		ImGuiLibrary::DrawComponent<TransformComponent>("Transform", entity, [](auto& component)
-			{
-				ImGuiLibrary::DrawVec3Control("Translation", component.Translation);
-				glm::vec3 rotation = glm::degrees(component.Rotation);
-				ImGuiLibrary::DrawVec3Control("Rotation", rotation);
-				component.Rotation = glm::radians(rotation);
-				ImGuiLibrary::DrawVec3Control("Scale", component.Scale, 1.0f);
-			});
+		// The spatial index only sees patched transforms
+		if (changed)
+			entity.PatchComponent<TransformComponent>([](TransformComponent&) {});
+	}
 
-		// Camera Component UI
-		ImGuiLibrary::DrawComponent<CameraComponent>("Camera", entity, [](auto& component)
-			{
-				auto& camera = component.camera;
+	// Camera Component UI
+	static void DrawComponentProperties(Entity, CameraComponent& component)
+	{
+		auto& camera = component.camera;
 
-				const char* projectionStringTypes[] = { "Orthographic", "Perspective" };
-				const char* currentProjectionString = projectionStringTypes[(int)camera.GetProjectionType()];
+		const char* projectionStringTypes[] = { "Orthographic", "Perspective" };
+		const char* currentProjectionString = projectionStringTypes[(int)camera.GetProjectionType()];
 
-				if (ImGui::BeginCombo("Camera Type", currentProjectionString))
+		if (ImGui::BeginCombo("Camera Type", currentProjectionString))
+		{
+			for (int i = 0; i < 2; i++)
+			{
+				bool isSelected = currentProjectionString == projectionStringTypes[i];
+				if (ImGui::Selectable(projectionStringTypes[i], isSelected))
 				{
-					for (int i = 0; i < 2; i++)
-					{
-						bool isSelected = currentProjectionString == projectionStringTypes[i];
-						if (ImGui::Selectable(projectionStringTypes[i], isSelected))
-						{
-							currentProjectionString = projectionStringTypes[i];
-							camera.SetProjectionType((ProjectionType)i);
-						}
-						if (isSelected) {
-							ImGui::SetItemDefaultFocus();
-						}
-					}
-					ImGui::EndCombo();
+					currentProjectionString = projectionStringTypes[i];
+					camera.SetProjectionType((ProjectionType)i);
+				}
+				if (isSelected) {
+					ImGui::SetItemDefaultFocus();
 				}
+			}
+			ImGui::EndCombo();
+		}
 
-				// Orthographic settings
-				if (camera.GetProjectionType() == ProjectionType::Orthographic)
-				{
-					float orthoSize = camera.GetOrthographicSize();
-					if (ImGui::DragFloat("Size", &orthoSize, 0.1f)) {
-						camera.SetOrthographicSize(orthoSize);
-					}
+		// Orthographic settings
+		if (camera.GetProjectionType() == ProjectionType::Orthographic)
+		{
+			float orthoSize = camera.GetOrthographicSize();
+			if (ImGui::DragFloat("Size", &orthoSize, 0.1f)) {
+				camera.SetOrthographicSize(orthoSize);
+			}
 
-					float orthoNear = camera.GetOrthographicNear();
-					if (ImGui::DragFloat("Near", &orthoNear, 0.1f))
-						camera.SetOrthographicNear(orthoNear);
+			float orthoNear = camera.GetOrthographicNear();
+			if (ImGui::DragFloat("Near", &orthoNear, 0.1f))
+				camera.SetOrthographicNear(orthoNear);
 
-					float orthoFar = camera.GetOrthographicFar();
-					if (ImGui::DragFloat("Far", &orthoFar, 0.1f))
-						camera.SetOrthographicFar(orthoFar);
+			float orthoFar = camera.GetOrthographicFar();
+			if (ImGui::DragFloat("Far", &orthoFar, 0.1f))
+				camera.SetOrthographicFar(orthoFar);
 
-					ImGui::Checkbox("Fixed Aspect Ratio", &component.FixedAspectRatio);
-				}
+			ImGui::Checkbox("Fixed Aspect Ratio", &component.FixedAspectRatio);
+		}
 
-				// Perspective settings
-				if (camera.GetProjectionType() == ProjectionType::Perspective)
-				{
-					float perspectiveFov = glm::degrees(camera.GetPerspectiveFOV());
-					if (ImGui::DragFloat("FOV", &perspectiveFov, 0.1f))
-						camera.SetPerspectiveFOV(glm::radians(perspectiveFov));
+		// Perspective settings
+		if (camera.GetProjectionType() == ProjectionType::Perspective)
+		{
+			float perspectiveFov = glm::degrees(camera.GetPerspectiveFOV());
+			if (ImGui::DragFloat("FOV", &perspectiveFov, 0.1f))
+				camera.SetPerspectiveFOV(glm::radians(perspectiveFov));
 
-					float perspectiveNear = camera.GetPerspectiveNear();
-					if (ImGui::DragFloat("Near", &perspectiveNear, 0.1f))
-						camera.SetPerspectiveNear(perspectiveNear);
+			float perspectiveNear = camera.GetPerspectiveNear();
+			if (ImGui::DragFloat("Near", &perspectiveNear, 0.1f))
+				camera.SetPerspectiveNear(perspectiveNear);
 
-					float perspectiveFar = camera.GetPerspectiveFar();
-					if (ImGui::DragFloat("Far", &perspectiveFar, 0.1f))
-						camera.SetPerspectiveFar(perspectiveFar);
-				}
-			});
+			float perspectiveFar = camera.GetPerspectiveFar();
+			if (ImGui::DragFloat("Far", &perspectiveFar, 0.1f))
+				camera.SetPerspectiveFar(perspectiveFar);
+		}
+	}
 
-		// Sprite Renderer UI
-		ImGuiLibrary::DrawComponent<SpriteRendererComponent>("Sprite Renderer", entity, [](auto& component)
-			{
-				ImGui::ColorEdit4("Colour", glm::value_ptr(component.Colour));
-			});
+	// Rigidbody 2D UI
+	static void DrawComponentProperties(Entity entity, Rigidbody2DComponent& component)
+	{
+		const char* bodyTypeStrings[] = { "Static", "Kinematic", "Dynamic" };
+		int currentBodyType = static_cast<int>(component.BodyType);
+		if (ImGui::Combo("Body Type", &currentBodyType, bodyTypeStrings, IM_ARRAYSIZE(bodyTypeStrings)))
+		{
+			component.BodyType = static_cast<b2BodyType>(currentBodyType);
+		}
 
-		// Circle Renderer UI
-		ImGuiLibrary::DrawComponent<CircleRendererComponent>("Circle Renderer", entity, [](auto& component)
-			{
-				ImGui::ColorEdit4("Colour", glm::value_ptr(component.Color));
-				ImGui::DragFloat("Thickness", &component.Thickness, 0.01f, 0.0f, 1.0f);
-				ImGui::DragFloat("Fade", &component.Fade, 0.00025f, 0.0f, 1.0f);
-			});
+		ImGui::Checkbox("Fixed Rotation", &component.FixedRotation);
+		ImGui::DragFloat("Mass", &component.Mass.mass, 0.01f, 0.0f, 100.0f, "%.3f");
+		ImGui::DragFloat2("Mass Center", reinterpret_cast<float*>(&component.Mass.center), 0.1f, -100.0f, 100.0f);
+		ImGui::DragFloat("Rotational Inertia", &component.Mass.rotationalInertia, 0.1f, 0.0f, 500.0f, "%.3f");
 
-		// Rigidbody 2D UI
-		ImGuiLibrary::DrawComponent<Rigidbody2DComponent>("Rigidbody 2D", entity, [&](auto& component)
-			{
-				const char* bodyTypeStrings[] = { "Static", "Kinematic", "Dynamic" };
-				int currentBodyType = static_cast<int>(component.BodyType);
-				if (ImGui::Combo("Body Type", &currentBodyType, bodyTypeStrings, IM_ARRAYSIZE(bodyTypeStrings)))
-				{
-					component.BodyType = static_cast<b2BodyType>(currentBodyType);
-				}
+		ImGui::Checkbox("Affected by Gravity", &component.AffectedbyGravity); // Gravity affected
 
-				ImGui::Checkbox("Fixed Rotation", &component.FixedRotation);
-				ImGui::DragFloat("Mass", &component.Mass.mass, 0.01f, 0.0f, 100.0f, "%.3f");
-				ImGui::DragFloat2("Mass Center", reinterpret_cast<float*>(&component.Mass.center), 0.1f, -100.0f, 100.0f);
-				ImGui::DragFloat("Rotational Inertia", &component.Mass.rotationalInertia, 0.1f, 0.0f, 500.0f, "%.3f");
+		if (ImGui::Button("Reset##Rigidbody"))
+			component = Rigidbody2DComponent();
 
-				ImGui::Checkbox("Affected by Gravity", &component.AffectedbyGravity); // Gravity affected
+		ImGui::SameLine();
+		if (ImGui::Button("Remove##Rigidbody"))
+			entity.RemoveComponent<Rigidbody2DComponent>();
+	}
 
-				if (ImGui::Button("Reset##Rigidbody"))
-					component = Rigidbody2DComponent();
+	// Audio Component UI
+	static void DrawComponentProperties(Entity, AudioComponent& component)
+	{
+		ImGui::Text("Audio File");
+		ImGui::SameLine();
 
-				ImGui::SameLine();
-				if (ImGui::Button("Remove##Rigidbody"))
-					entity.RemoveComponent<Rigidbody2DComponent>();
-			});
+		float fullWidth = ImGui::GetContentRegionAvail().x;
+		float buttonWidth = 30.0f;
+		float inputWidth = fullWidth - buttonWidth - 10.0f;
 
-		// Box Collider 2D UI
-		ImGuiLibrary::DrawComponent<BoxCollider2DComponent>("Box Collider 2D", entity, [](auto& component)
-			{
-				ImGuiLibrary::DrawVec2Control("Offset", component.Offset);
-				ImGuiLibrary::DrawVec2Control("Half Size", component.HalfSize);
+		ImGui::PushItemWidth(inputWidth);
 
-				ImGui::DragFloat("Density", &component.Density, 0.05f, 0.0f, 10.0f);
-				ImGui::DragFloat("Friction", &component.Friction, 0.05f, 0.0f, 1.0f);
-				ImGui::DragFloat("Restitution", &component.Restitution, 0.05f, 0.0f, 1.0f);
+		char buffer[256];
+		memset(buffer, 0, sizeof(buffer));
+		strcpy_s(buffer, sizeof(buffer), component.FilePath.c_str());
 
-				if (ImGui::Button("Reset to Defaults"))
-					component = BoxCollider2DComponent();
-			});
+		if (ImGui::InputText("##AudioFile", buffer, sizeof(buffer)))
+			component.FilePath = buffer;
 
-		// Circle Collider 2D UI
-		ImGuiLibrary::DrawComponent<CircleCollider2DComponent>("Circle Collider 2D", entity, [](auto& component)
-			{
-				ImGuiLibrary::DrawVec2Control("Offset", component.Offset);
-				ImGui::DragFloat("Radius", &component.Radius, 0.05f, 0.0f, 10.0f);
+		ImGui::PopItemWidth();
+		ImGui::SameLine();
 
-				ImGui::DragFloat("Density", &component.Density, 0.05f, 0.0f, 10.0f);
-				ImGui::DragFloat("Friction", &component.Friction, 0.05f, 0.0f, 1.0f);
-				ImGui::DragFloat("Restitution", &component.Restitution, 0.05f, 0.0f, 1.0f);
+		if (ImGui::Button("File", ImVec2(buttonWidth, 0)))
+		{
+			std::string path = FileDialogs::OpenFile("Audio Files (*.wav *.mp3)\0*.wav;*.mp3\0");
+			if (!path.empty())
+				component.FilePath = path;
+		}
 
-				if (ImGui::Button("Reset to Defaults"))
-					component = CircleCollider2DComponent();
-			});
+		ImGui::Checkbox("Loop", &component.Loop);
+		ImGui::Checkbox("Play On Start", &component.PlayOnStart);
+		ImGui::Checkbox("Play On Collision", &component.PlayOnCollision);
+	}
 
-		// Audio Component UI
-		ImGuiLibrary::DrawComponent<AudioComponent>("Audio Component", entity, [](AudioComponent& component)
+	// Every other inspected component: one widget per COMPONENT_LIST field
+	template<typename T>
+	static void DrawComponentProperties(Entity, T& component)
+	{
+		static_assert(HasComponentFields<T>(), "Give the component fields in COMPONENT_LIST or a DrawComponentProperties overload");
+		ForEachField<T>([&](const auto& field)
 			{
-				ImGui::Text("Audio File");
-				ImGui::SameLine();
-
-				float fullWidth = ImGui::GetContentRegionAvail().x;
-				float buttonWidth = 30.0f;
-				float inputWidth = fullWidth - buttonWidth - 10.0f;
-
-				ImGui::PushItemWidth(inputWidth);
-
-				char buffer[256];
-				memset(buffer, 0, sizeof(buffer));
-				strcpy_s(buffer, sizeof(buffer), component.FilePath.c_str());
+				using Member = typename std::decay_t<decltype(field)>::Type;
+				Member& value = component.*field.Pointer;
+				if constexpr (std::is_same_v<Member, float>)
+					ImGui::DragFloat(field.Label, &value, field.Speed, field.Min, field.Max);
+				else if constexpr (std::is_same_v<Member, bool>)
+					ImGui::Checkbox(field.Label, &value);
+				else if constexpr (std::is_same_v<Member, glm::vec2>)
+					ImGuiLibrary::DrawVec2Control(field.Label, value);
+				else if constexpr (std::is_same_v<Member, glm::vec3>)
+					ImGuiLibrary::DrawVec3Control(field.Label, value);
+				else if constexpr (std::is_same_v<Member, glm::vec4>)
+					ImGui::ColorEdit4(field.Label, glm::value_ptr(value));
+				else
+					static_assert(!sizeof(Member), "No inspector widget for this field type; add one or a DrawComponentProperties overload");
+			});
 
-				if (ImGui::InputText("##AudioFile", buffer, sizeof(buffer)))
-					component.FilePath = buffer;
+		if (ImGui::Button("Reset to Defaults"))
+			component = T();
+	}
 
-				ImGui::PopItemWidth();
-				ImGui::SameLine();
+	// Draws the UI to inspect and edit all components of an entity
+	void InspectorPanel::DrawComponents(Entity entity)
+	{
+		// Edit tag (name) of the entity
+		if (entity.HasComponent<TagComponent>())
+		{
+			auto& tag = entity.GetComponent<TagComponent>().Tag;
+			char buffer[256];
+			memset(buffer, 0, sizeof(buffer));
+			strcpy_s(buffer, sizeof(buffer), tag.c_str());
+			if (ImGui::InputText("##Tag", buffer, sizeof(buffer)))
+			{
+				// Patched so the hierarchy's name index sees the rename
+				entity.PatchComponent<TagComponent>([&buffer](TagComponent& component) { component.Tag = buffer; });
+			}
+		}
 
-				if (ImGui::Button("File", ImVec2(buttonWidth, 0)))
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (HasComponentFlag<T>(ComponentFlags_Inspected))
 				{
-					std::string path = FileDialogs::OpenFile("Audio Files (*.wav *.mp3)\0*.wav;*.mp3\0");
-					if (!path.empty())
-						component.FilePath = path;
+					ImGuiLibrary::DrawComponent<T>(ComponentTraits<T>::DisplayName, entity, [&](T& component)
+						{
+							DrawComponentProperties(entity, component);
+						});
 				}
-
-				ImGui::Checkbox("Loop", &component.Loop);
-				ImGui::Checkbox("Play On Start", &component.PlayOnStart);
-			});
-
-		// Player Controller Component UI
-		ImGuiLibrary::DrawComponent<PlayerControllerComponent>("Player Controller", entity, [](auto& component)
-			{
-				ImGui::DragFloat("Move Force", &component.MoveForce, 0.1f, 0.0f, 1000.0f);
 			});
 	}
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "DemoEngine_PCH.h"
+#include "MemoryPanel.h"
+#include <imgui/imgui.h>
+#include "Core/FrameClock.h"
+#include "Utils/PlatformUtils.h"
+
+namespace DemoEngine
+{
+	static std::string FormatBytes(double bytes)
+	{
+		char text[32];
+		if (bytes >= 1024.0 * 1024.0)
+			snprintf(text, sizeof(text), "%.2f MB", bytes / (1024.0 * 1024.0));
+		else if (bytes >= 1024.0)
+			snprintf(text, sizeof(text), "%.1f KB", bytes / 1024.0);
+		else
+			snprintf(text, sizeof(text), "%.0f B", bytes);
+		return text;
+	}
+
+	void MemoryPanel::UpdateRates()
+	{
+		double now = FrameClock::Now();
+		double elapsed = now - m_RateStartTime;
+		if (elapsed < 1.0)
+			return;
+
+		for (size_t i = 0; i < s_TagCount; i++)
+		{
+			MemoryTagStats stats = HeapTracker::GetTagStats((MemoryTag)i);
+			m_AllocationsPerSecond[i] = (float)((stats.Allocations - m_RateStart[i].Allocations) / elapsed);
+			m_BytesPerSecond[i] = (float)((stats.AllocatedBytes - m_RateStart[i].AllocatedBytes) / elapsed);
+			m_RateStart[i] = stats;
+		}
+		m_RateStartTime = now;
+	}
+
+	void MemoryPanel::OnImGuiRender()
+	{
+		ImGui::Begin("Memory");
+
+		UpdateRates();
+
+		if (!HeapTracker::IsEnabled())
+			ImGui::TextDisabled("operator new tracking is compiled out; only hooked libraries are shown");
+
+		if (ImGui::Button("Export CSV"))
+		{
+			HeapTracker::WriteReport("Profiles/Memory_" + LocalTime::Format() + ".csv");
+		}
+
+		ImGui::SameLine();
+		ImGui::Text("%llu heap allocations last frame", (unsigned long long)HeapTracker::GetLastFrameCounters().Allocations);
+
+		if (ImGui::BeginTable("MemoryTags", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable))
+		{
+			ImGui::TableSetupColumn("Tag");
+			ImGui::TableSetupColumn("Live", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+			ImGui::TableSetupColumn("Peak", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+			ImGui::TableSetupColumn("Allocs/s", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+			ImGui::TableSetupColumn("Bytes/s", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+			ImGui::TableHeadersRow();
+
+			uint64_t totalLive = 0;
+			for (size_t i = 0; i < s_TagCount; i++)
+			{
+				MemoryTagStats stats = HeapTracker::GetTagStats((MemoryTag)i);
+				totalLive += stats.LiveBytes;
+
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(MemoryTagToString((MemoryTag)i));
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(FormatBytes((double)stats.LiveBytes).c_str());
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(FormatBytes((double)stats.PeakBytes).c_str());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.0f", m_AllocationsPerSecond[i]);
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(FormatBytes(m_BytesPerSecond[i]).c_str());
+			}
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted("Total");
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(FormatBytes((double)totalLive).c_str());
+
+			ImGui::EndTable();
+		}
+
+		ImGui::End();
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Core/HeapTracker.h"
+#include <array>
+
+namespace DemoEngine
+{
+	// Live/peak bytes and allocation rate per MemoryTag, with a CSV export for diffing runs
+	class MemoryPanel
+	{
+	public:
+		MemoryPanel() = default;
+
+		void OnImGuiRender();
+
+	private:
+		void UpdateRates();
+
+	private:
+		static constexpr size_t s_TagCount = (size_t)MemoryTag::Count;
+
+		// Rates are recomputed about once a second from the running totals
+		std::array<MemoryTagStats, s_TagCount> m_RateStart = {};
+		std::array<float, s_TagCount> m_AllocationsPerSecond = {};
+		std::array<float, s_TagCount> m_BytesPerSecond = {};
+		double m_RateStartTime = 0.0;
+	};
+}
@@ -0,0 +1,51 @@
+#include "DemoEngine_PCH.h"
+#include "SceneGeneratorPanel.h"
+#include "Scene/SceneSerialiser.h"
+#include <imgui/imgui.h>
+
+namespace DemoEngine
+{
+	bool SceneGeneratorPanel::OnImGuiRender()
+	{
+		if (!m_Open)
+			return false;
+
+		bool generate = false;
+		if (ImGui::Begin("Scene Generator", &m_Open))
+		{
+			int entityCount = (int)m_Settings.EntityCount;
+			if (ImGui::SliderInt("Entities", &entityCount, 1000, 1000000, "%d", ImGuiSliderFlags_Logarithmic))
+				m_Settings.EntityCount = (uint32_t)std::max(1, entityCount);
+
+			ImGui::SeparatorText("Mix (relative weights)");
+			SceneGeneratorMix& mix = m_Settings.Mix;
+			ImGui::DragFloat("Sprites", &mix.Sprites, 0.1f, 0.0f, 1000.0f);
+			ImGui::DragFloat("Circles", &mix.Circles, 0.1f, 0.0f, 1000.0f);
+			ImGui::DragFloat("Boxes", &mix.Boxes, 0.1f, 0.0f, 1000.0f);
+			ImGui::DragFloat("Balls", &mix.Balls, 0.1f, 0.0f, 1000.0f);
+			ImGui::DragFloat("Audio Sources", &mix.AudioSources, 0.01f, 0.0f, 1000.0f);
+			ImGui::DragFloat("Players", &mix.Players, 0.01f, 0.0f, 1000.0f);
+
+			ImGui::SeparatorText("Layout");
+			ImGui::SliderFloat("Static Bodies", &m_Settings.StaticFraction, 0.0f, 1.0f);
+			ImGui::DragFloat("Spacing", &m_Settings.Spacing, 0.05f, 1.0f, 10.0f);
+
+			int seed = (int)m_Settings.Seed;
+			if (ImGui::InputInt("Seed", &seed))
+				m_Settings.Seed = (uint32_t)seed;
+
+			char clipPath[256];
+			strncpy(clipPath, m_Settings.AudioClipPath.c_str(), sizeof(clipPath) - 1);
+			clipPath[sizeof(clipPath) - 1] = '\0';
+			if (ImGui::InputText("Audio Clip", clipPath, sizeof(clipPath)))
+				m_Settings.AudioClipPath = clipPath;
+
+			ImGui::Separator();
+			ImGui::TextDisabled("Replaces the editor scene. Save as %s for large scenes.", SceneSerialiser::BinaryExtension);
+			generate = ImGui::Button("Generate");
+		}
+		ImGui::End();
+
+		return generate;
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "Scene/SceneGenerator.h"
+
+namespace DemoEngine
+{
+	// Settings window for SceneGenerator, opened from File > Generate Stress Scene
+	class SceneGeneratorPanel
+	{
+	public:
+		SceneGeneratorPanel() = default;
+
+		void Open() { m_Open = true; }
+
+		// True on the frame Generate is pressed
+		bool OnImGuiRender();
+
+		const SceneGeneratorSettings& GetSettings() const { return m_Settings; }
+
+	private:
+		SceneGeneratorSettings m_Settings;
+		bool m_Open = false;
+	};
+}
@@ -16,6 +16,8 @@ namespace DemoEngine
 	{
 		m_Context = context;
 		m_SelectionContext = {};
+		m_Selection.clear();
+		m_Index.SetContext(context);
 	}
 
 	void SceneHierarchyPanel::OnImGuiRender()
@@ -23,18 +25,47 @@ namespace DemoEngine
 		ImGui::Begin("Scene Hierarchy");
 		if (m_Context)
 		{
-			auto view = m_Context->m_Registry.view<entt::entity>(); 
-			for (auto entityID : view)
+			ImGui::SetNextItemWidth(-FLT_MIN);
+			if (ImGui::InputTextWithHint("##Filter", "Filter", m_Filter, sizeof(m_Filter)))
+				m_Index.SetFilter(m_Filter);
+
+			m_Index.Update();
+			const std::vector<entt::entity>& rows = m_Index.GetRows();
+			if (m_Filter[0])
+				ImGui::TextDisabled("%zu of %zu entities", rows.size(), m_Index.GetEntityCount());
+
+			// The filter stays put while the list scrolls
+			ImGui::BeginChild("##Entities");
+
+			size_t scrollRow = HierarchyIndex::npos;
+			if (m_ScrollToSelection && m_SelectionContext)
+				scrollRow = m_Index.FindRow(m_SelectionContext);
+			m_ScrollToSelection = false;
+
+			// Rows are one line each, so the clipper can skip everything off-screen
+			ImGuiListClipper clipper;
+			clipper.Begin((int)rows.size());
+			if (scrollRow != HierarchyIndex::npos)
+				clipper.IncludeItemByIndex((int)scrollRow);
+
+			while (clipper.Step())
 			{
-				Entity entity{ entityID, m_Context.get() };
-				DrawEntityNode(entity);
-			}			
+				for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+				{
+					DrawEntityNode({ rows[row], m_Context.get() });
+					if ((size_t)row == scrollRow)
+						ImGui::SetScrollHereY();
+				}
+			}
+
 			if (ImGui::IsMouseDown(0) && ImGui::IsWindowHovered())
 			{
 				m_SelectionContext = {};
+				m_Selection.clear();
 			}
 
 			RightClickMenu();
+			ImGui::EndChild();
 		}
 
 		ImGui::End();
@@ -52,20 +83,62 @@ namespace DemoEngine
 	void SceneHierarchyPanel::SetSelectedEntity(Entity entity)
 	{
 		m_SelectionContext = entity;
+		m_Selection.clear();
+		if (entity)
+			m_Selection.push_back(entity);
+		m_ScrollToSelection = true;
+	}
+
+	void SceneHierarchyPanel::SetSelection(std::vector<entt::entity> selection)
+	{
+		std::sort(selection.begin(), selection.end());
+		selection.erase(std::unique(selection.begin(), selection.end()), selection.end());
+		m_Selection = std::move(selection);
+
+		m_SelectionContext = m_Selection.empty() ? Entity() : Entity(m_Selection.front(), m_Context.get());
+		m_ScrollToSelection = true;
+	}
+
+	void SceneHierarchyPanel::ToggleSelected(Entity entity)
+	{
+		auto it = std::lower_bound(m_Selection.begin(), m_Selection.end(), (entt::entity)entity);
+		if (it != m_Selection.end() && *it == entity)
+		{
+			m_Selection.erase(it);
+			if (m_SelectionContext == entity)
+				m_SelectionContext = m_Selection.empty() ? Entity() : Entity(m_Selection.back(), m_Context.get());
+		}
+		else
+		{
+			m_Selection.insert(it, entity);
+			m_SelectionContext = entity;
+		}
+	}
+
+	bool SceneHierarchyPanel::IsSelected(entt::entity entity) const
+	{
+		return std::binary_search(m_Selection.begin(), m_Selection.end(), entity);
 	}
 
 	void SceneHierarchyPanel::DrawEntityNode(Entity entity)
 	{
 		auto& tag = entity.GetComponent<TagComponent>().Tag;
 
-		ImGuiTreeNodeFlags flags = ((m_SelectionContext == entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
+		// Entities have no children, so nodes are leaves and never push onto the ID stack
+		ImGuiTreeNodeFlags flags = (IsSelected(entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 		flags |= ImGuiTreeNodeFlags_SpanAvailWidth;
 
-		bool opened = ImGui::TreeNodeEx((void*)(uint64_t)(uint32_t)entity, flags, tag.c_str());
+		ImGui::TreeNodeEx((void*)(uint64_t)(uint32_t)entity, flags, "%s", tag.c_str());
 
 		if (ImGui::IsItemClicked())
 		{
-			m_SelectionContext = entity;
+			if (ImGui::GetIO().KeyCtrl)
+				ToggleSelected(entity);
+			else
+			{
+				m_SelectionContext = entity;
+				m_Selection.assign(1, entity);
+			}
 		}
 
 		bool entityDeleted = false;
@@ -84,18 +157,11 @@ namespace DemoEngine
 			ImGui::EndPopup();
 		}
 
-		if (opened)
-		{
-			ImGui::TreePop();
-		}
-
 		if (entityDeleted)
 		{
+			if (IsSelected(entity))
+				ToggleSelected(entity);
 			m_Context->DestroyEntity(entity);
-			if (m_SelectionContext == entity)
-			{
-				m_SelectionContext = {};
-			}
 		}
 	}
 
@@ -4,6 +4,7 @@
 #include "Scene/Scene.h" 
 #include "Scene/Entity.h"
 #include "InspectorPanel.h"
+#include "HierarchyIndex.h"
 
 namespace DemoEngine
 {
@@ -17,8 +18,14 @@ namespace DemoEngine
 
 		void OnImGuiRender();
 
+		// The inspector shows the primary selection; the rest only matters to bulk actions like delete
 		Entity GetSelectedEntity() const { return m_SelectionContext; } 
 		void SetSelectedEntity(Entity entity);
+
+		const std::vector<entt::entity>& GetSelection() const { return m_Selection; }
+		void SetSelection(std::vector<entt::entity> selection);
+		void ToggleSelected(Entity entity);
+		bool IsSelected(entt::entity entity) const;
 	
 	private:
 		void DrawEntityNode(Entity entity);
@@ -27,7 +34,13 @@ namespace DemoEngine
 	private:
 		Ref<Scene> m_Context; 
 		Entity m_SelectionContext;
+		std::vector<entt::entity> m_Selection; // Sorted, includes m_SelectionContext
 		Ref<InspectorPanel> m_InspectorPanel;
+
+		// Only the visible rows are drawn, so the panel costs the same for 100 or 100k entities
+		HierarchyIndex m_Index;
+		char m_Filter[256] = {};
+		bool m_ScrollToSelection = false; // Set when the selection comes from outside the panel
 	};
 	
 }
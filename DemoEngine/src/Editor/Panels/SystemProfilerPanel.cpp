@@ -0,0 +1,95 @@
+#include "DemoEngine_PCH.h"
+#include "SystemProfilerPanel.h"
+#include "Core/ThreadPool.h"
+#include "Core/HeapTracker.h"
+#include <imgui/imgui.h>
+
+namespace DemoEngine
+{
+	void SystemProfilerPanel::OnImGuiRender()
+	{
+		ImGui::Begin("Systems");
+
+		if (!m_Context)
+		{
+			ImGui::End();
+			return;
+		}
+
+		SystemScheduler& scheduler = m_Context->GetSystems();
+
+		bool parallel = scheduler.IsParallel();
+		if (ImGui::Checkbox("Parallel", &parallel))
+			scheduler.SetParallel(parallel);
+
+		ImGui::SameLine();
+		ImGui::Text("%u workers, frame %.3f ms", ThreadPool::GetWorkerCount(), scheduler.GetLastFrameTime());
+		if (HeapTracker::IsEnabled())
+		{
+			ImGui::SameLine();
+			ImGui::Text(", %llu heap allocations last frame", (unsigned long long)HeapTracker::GetLastFrameCounters().Allocations);
+		}
+
+		const auto& systems = scheduler.GetSystems();
+		float frameTime = std::max(scheduler.GetLastFrameTime(), 0.001f);
+
+		if (ImGui::BeginTable("SystemTimes", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable))
+		{
+			ImGui::TableSetupColumn("System");
+			ImGui::TableSetupColumn("Thread", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+			ImGui::TableSetupColumn("Last (ms)", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+			ImGui::TableSetupColumn("Avg (ms)", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+			ImGui::TableSetupColumn("Heap", ImGuiTableColumnFlags_WidthFixed, 40.0f);
+			ImGui::TableSetupColumn("Timeline", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableHeadersRow();
+
+			for (const System& system : systems)
+			{
+				const SystemStats& stats = system.Stats;
+
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(system.Name.c_str());
+				if (ImGui::IsItemHovered())
+					ImGui::SetTooltip("%zu reads, %zu writes%s%s", system.Reads.size(), system.Writes.size(),
+						system.MainThreadOnly ? ", main thread" : "", system.Exclusive ? ", exclusive" : "");
+
+				ImGui::TableNextColumn();
+				if (stats.Thread == 0)
+					ImGui::TextUnformatted("Main");
+				else
+					ImGui::Text("W%d", stats.Thread - 1);
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", stats.LastTime);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", stats.AverageTime);
+
+				// Steady-state systems should not touch the global heap
+				ImGui::TableNextColumn();
+				if (stats.HeapAllocations > 0)
+					ImGui::TextColored(ImVec4(0.9f, 0.6f, 0.2f, 1.0f), "%u", stats.HeapAllocations);
+				else
+					ImGui::TextDisabled("0");
+
+				// Bar placed where the system ran within the frame; overlapping bars ran concurrently
+				ImGui::TableNextColumn();
+				ImVec2 origin = ImGui::GetCursorScreenPos();
+				float width = ImGui::GetContentRegionAvail().x;
+				float height = ImGui::GetTextLineHeight();
+
+				float x0 = origin.x + width * std::min(stats.StartOffset / frameTime, 1.0f);
+				float x1 = origin.x + width * std::min((stats.StartOffset + stats.LastTime) / frameTime, 1.0f);
+				ImU32 colour = stats.Thread == 0 ? IM_COL32(90, 160, 230, 255) : IM_COL32(110, 200, 120, 255);
+
+				ImDrawList* drawList = ImGui::GetWindowDrawList();
+				drawList->AddRectFilled(ImVec2(x0, origin.y), ImVec2(std::max(x1, x0 + 1.0f), origin.y + height), colour);
+				ImGui::Dummy(ImVec2(width, height));
+			}
+
+			ImGui::EndTable();
+		}
+
+		ImGui::End();
+	}
+}
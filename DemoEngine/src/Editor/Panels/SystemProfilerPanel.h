@@ -0,0 +1,20 @@
+#pragma once
+#include "Core/Core.h"
+#include "Scene/Scene.h"
+
+namespace DemoEngine
+{
+	// Per-system timings of the active scene's scheduler, with a frame timeline
+	class SystemProfilerPanel
+	{
+	public:
+		SystemProfilerPanel() = default;
+
+		void SetContext(const Ref<Scene>& context) { m_Context = context; }
+
+		void OnImGuiRender();
+
+	private:
+		Ref<Scene> m_Context;
+	};
+}
@@ -39,6 +39,24 @@ namespace DemoEngine
 		int GetCategoryFlags() const override { return EventCategoryApplication; }
 	};
 
+	class WindowFocusEvent : public Event {
+	public:
+		WindowFocusEvent() {}
+		static EventType GetStaticType() { return EventType::WindowFocus; }
+		EventType GetEventType() const override { return GetStaticType(); }
+		const char* GetName() const override { return "WindowFocus"; }
+		int GetCategoryFlags() const override { return EventCategoryApplication; }
+	};
+
+	class WindowLostFocusEvent : public Event {
+	public:
+		WindowLostFocusEvent() {}
+		static EventType GetStaticType() { return EventType::WindowLostFocus; }
+		EventType GetEventType() const override { return GetStaticType(); }
+		const char* GetName() const override { return "WindowLostFocus"; }
+		int GetCategoryFlags() const override { return EventCategoryApplication; }
+	};
+
 
 	class AppTickEvent : public Event {
 	public:
@@ -30,4 +30,14 @@ namespace DemoEngine
 	{
 		glfwSwapBuffers(m_WindowHandle);
 	}
+
+	void OpenGLContext::MakeCurrent()
+	{
+		glfwMakeContextCurrent(m_WindowHandle);
+	}
+
+	void OpenGLContext::ReleaseCurrent()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
 }
\ No newline at end of file
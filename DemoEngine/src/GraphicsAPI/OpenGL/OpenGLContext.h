@@ -14,6 +14,9 @@ namespace DemoEngine
 		virtual void Init() override;
 		virtual void SwapBuffers() override;
 
+		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
+
 	private:
 		GLFWwindow* m_WindowHandle;
 	};
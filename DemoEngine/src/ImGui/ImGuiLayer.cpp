@@ -6,6 +6,8 @@
 #include "backends/imgui_impl_opengl3.h"
 
 #include <Core/Application.h>
+#include "Core/HeapTracker.h"
+#include "Renderer/RenderThread.h"
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
@@ -14,6 +16,22 @@
 
 namespace DemoEngine
 {
+	// ImGui reuses its draw lists every frame, so the render thread draws from a deep copy
+	static ImDrawData* CloneDrawData(const ImDrawData* source)
+	{
+		ImDrawData* clone = IM_NEW(ImDrawData)(*source);
+		for (ImDrawList*& list : clone->CmdLists)
+			list = list->CloneOutput();
+		return clone;
+	}
+
+	static void DestroyDrawData(ImDrawData* drawData)
+	{
+		for (ImDrawList* list : drawData->CmdLists)
+			IM_DELETE(list);
+		IM_DELETE(drawData);
+	}
+
 	ImGuiLayer::ImGuiLayer()
 		:Layer("ImGui Layer")
 	{
@@ -29,13 +47,19 @@ namespace DemoEngine
 	{
 		//Setup Dear Imgui content
 		IMGUI_CHECKVERSION();
+		// Track ImGui's memory under its own tag; must be set before the context exists
+		ImGui::SetAllocatorFunctions(
+			[](size_t size, void*) { return HeapTracker::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, MemoryTag::UI); },
+			[](void* memory, void*) { HeapTracker::Free(memory); });
 		ImGui::CreateContext();
 
 		ImGuiIO& io = ImGui::GetIO(); (void)io;
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;  //Enable keyboard controls 
 		//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad; //Enable gamepaad controls 
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;       //Enable docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+		// Platform windows each need the GL context made current in turn, which only works on the main thread
+		if (!RenderThread::IsThreaded())
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
 		//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoTaskBarIcons;
 		//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoMerge;
 
@@ -58,12 +82,20 @@ namespace DemoEngine
 
 		//Setup Platform/Renderer bindings
 		ImGui_ImplGlfw_InitForOpenGL(window, true);
-		ImGui_ImplOpenGL3_Init("#version 410");
+
+		// Creating the device objects up front keeps the font atlas from being built on the render thread mid-frame
+		RenderThread::Submit([]()
+		{
+			ImGui_ImplOpenGL3_Init("#version 410");
+			ImGui_ImplOpenGL3_NewFrame();
+		});
+		RenderThread::WaitIdle();
 	}
 
 	void ImGuiLayer::OnDetach()
 	{
-		ImGui_ImplOpenGL3_Shutdown();
+		RenderThread::Submit([]() { ImGui_ImplOpenGL3_Shutdown(); });
+		RenderThread::WaitIdle();
 		ImGui_ImplGlfw_Shutdown();
 		ImGui::DestroyContext();
 	}
@@ -89,13 +121,27 @@ namespace DemoEngine
 
 	void ImGuiLayer::End()
 	{
+		PROFILE_FUNCTION();
+
 		ImGuiIO& io = ImGui::GetIO();
 		Application& app = Application::Get();
 		io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
 		//Rendering
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		if (RenderThread::IsThreaded())
+		{
+			ImDrawData* drawData = CloneDrawData(ImGui::GetDrawData());
+			RenderThread::Submit([drawData]()
+			{
+				ImGui_ImplOpenGL3_RenderDrawData(drawData);
+				DestroyDrawData(drawData);
+			});
+		}
+		else
+		{
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		}
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
@@ -216,11 +216,14 @@ namespace DemoEngine
 
 
 
-		static void DrawVec3Control(const std::string& label, glm::vec3& values, float resetValue = 0.0f, float columnWidth = 100.0f)
+		// Returns true when any of the three values changed
+		static bool DrawVec3Control(const std::string& label, glm::vec3& values, float resetValue = 0.0f, float columnWidth = 100.0f)
 		{
 			ImGuiIO& io = ImGui::GetIO();
 			auto boldFont = io.Fonts->Fonts[0];
 
+			bool changed = false;
+
 			ImGui::PushID(label.c_str());
 			ImGui::Columns(2);
 			ImGui::SetColumnWidth(0, columnWidth);
@@ -241,13 +244,14 @@ namespace DemoEngine
 			if (ImGui::Button("X", buttonSize))
 			{
 				values.x = resetValue;
+				changed = true;
 			}
 
 			ImGui::PopFont();
 			ImGui::PopStyleColor(3);
 			ImGui::SameLine();
 
-			ImGui::DragFloat("##X", &values.x, 0.1f, 0.0f, 0.0f, "%.2f");
+			changed |= ImGui::DragFloat("##X", &values.x, 0.1f, 0.0f, 0.0f, "%.2f");
 			ImGui::PopItemWidth();
 			ImGui::SameLine();
 
@@ -259,12 +263,13 @@ namespace DemoEngine
 			if (ImGui::Button("Y", buttonSize))
 			{
 				values.y = resetValue;
+				changed = true;
 			}
 
 			ImGui::PopFont();
 			ImGui::PopStyleColor(3);
 			ImGui::SameLine();
-			ImGui::DragFloat("##Y", &values.y, 0.1f, 0.0f, 0.0f, "%.2f");
+			changed |= ImGui::DragFloat("##Y", &values.y, 0.1f, 0.0f, 0.0f, "%.2f");
 			ImGui::PopItemWidth();
 			ImGui::SameLine();
 			ImGui::PushStyleColor(ImGuiCol_Button, ImVec4{ 0.1f, 0.25f, 0.8f, 1.0f });
@@ -275,16 +280,18 @@ namespace DemoEngine
 			if (ImGui::Button("Z", buttonSize))
 			{
 				values.z = resetValue;
+				changed = true;
 			}
 
 			ImGui::PopFont();
 			ImGui::PopStyleColor(3);
 			ImGui::SameLine();
-			ImGui::DragFloat("##Z", &values.z, 0.1f, 0.0f, 0.0f, "%.2f");
+			changed |= ImGui::DragFloat("##Z", &values.z, 0.1f, 0.0f, 0.0f, "%.2f");
 			ImGui::PopItemWidth();
 			ImGui::PopStyleVar();
 			ImGui::Columns(1);
 			ImGui::PopID();
+			return changed;
 		}
 	};
 }
\ No newline at end of file
@@ -1,14 +1,37 @@
 #include "DemoEngine_PCH.h"
 #include "Log.h"
+#include "spdlog/async.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 
 namespace DemoEngine
 {
 	std::shared_ptr<spdlog::logger> Log::s_Logger;
+	std::shared_ptr<spdlog::logger> Log::s_SyncLogger;
 	void Log::Init()
 	{
 		spdlog::set_pattern("%^[%] %: %v%$");
-		s_Logger = spdlog::stdout_color_mt("DemoEngine");
+
+		// One background thread owns the console; callers only enqueue
+		spdlog::init_thread_pool(QueueSize, 1);
+		auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+		s_Logger = std::make_shared<spdlog::async_logger>("DemoEngine", sink, spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+		spdlog::initialize_logger(s_Logger);
+
 		s_Logger->set_level(spdlog::level::trace);
+		s_Logger->flush_on(spdlog::level::err);
+
+		// An async flush only queues a request, which is too late for a message before __debugbreak
+		s_SyncLogger = std::make_shared<spdlog::logger>("DemoEngineSync", sink);
+		spdlog::initialize_logger(s_SyncLogger);
+		s_SyncLogger->set_level(spdlog::level::trace);
+		s_SyncLogger->flush_on(spdlog::level::trace);
+	}
+
+	void Log::Shutdown()
+	{
+		// Later calls (static destructors) are reported by spdlog instead of crashing
+		if (s_Logger)
+			s_Logger->flush();
+		spdlog::shutdown();
 	}
-}
\ No newline at end of file
+}
@@ -2,17 +2,72 @@
 #include "Core/Core.h" 
 #include "spdlog/spdlog.h" 
 #include "spdlog/fmt/ostr.h"
+#include <atomic>
+#include <chrono>
+
+// Log calls below DEMOENGINE_LOG_LEVEL compile to nothing, arguments included
+#define DEMOENGINE_LOG_LEVEL_TRACE 0
+#define DEMOENGINE_LOG_LEVEL_INFO 1
+#define DEMOENGINE_LOG_LEVEL_WARN 2
+#define DEMOENGINE_LOG_LEVEL_ERROR 3
+#define DEMOENGINE_LOG_LEVEL_FATAL 4
+#define DEMOENGINE_LOG_LEVEL_OFF 5
+
+#ifndef DEMOENGINE_LOG_LEVEL
+	#define DEMOENGINE_LOG_LEVEL DEMOENGINE_LOG_LEVEL_TRACE
+#endif
 
 namespace DemoEngine
 {
+	// Messages are formatted on the calling thread and handed to a preallocated ring
+	// that a background thread drains into the sinks, so logging never waits on the console.
+	// When the ring is full the oldest queued messages are overwritten, so failed asserts and
+	// fatal messages bypass it and are written by the calling thread before it returns.
 	class Log
 	{
 	public:
+	static constexpr size_t QueueSize = 8192; // Messages
+
 	static void Init();
+	// Drains the queue and stops the logging thread
+	static void Shutdown();
 	inline static std::shared_ptr<spdlog::logger>& GetLogger() { return s_Logger; }
+	// Same sinks, written and flushed on the calling thread, ahead of anything still queued
+	inline static std::shared_ptr<spdlog::logger>& GetSyncLogger() { return s_SyncLogger; }
 	
 private:
 		static std::shared_ptr<spdlog::logger> s_Logger;
+		static std::shared_ptr<spdlog::logger> s_SyncLogger;
+	};
+
+	// Per call site state for the LOG_*_THROTTLED macros
+	class LogThrottle
+	{
+	public:
+		LogThrottle(float intervalSeconds)
+			: m_Interval((int64_t)(intervalSeconds * 1e9f))
+		{
+		}
+
+		// True at most once per interval; suppressed receives how many calls were dropped since
+		bool Allow(uint32_t& suppressed)
+		{
+			int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			int64_t next = m_Next.load(std::memory_order_relaxed);
+			if (now < next || !m_Next.compare_exchange_strong(next, now + m_Interval, std::memory_order_relaxed))
+			{
+				m_Suppressed.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			suppressed = m_Suppressed.exchange(0, std::memory_order_relaxed);
+			return true;
+		}
+
+	private:
+		int64_t m_Interval;
+		std::atomic<int64_t> m_Next = 0;
+		std::atomic<uint32_t> m_Suppressed = 0;
 	};
 }
 
@@ -21,8 +76,55 @@ private:
 // //Log::GetLogger()->TYPE
 //each time we want to log something to the console
 
-#define LOG_TRACE(...) :: DemoEngine::Log::GetLogger()->trace(__VA_ARGS__)
-#define LOG_INFO(...) :: DemoEngine::Log::GetLogger()->info(__VA_ARGS__) 
-#define LOG_WARN(...) :: DemoEngine::Log::GetLogger()->warn(__VA_ARGS__)
-#define LOG_ERROR(...) :: DemoEngine::Log::GetLogger()->error(__VA_ARGS__) 
-#define LOG_FATAL(...): DemoEngine::Log::GetLogger()->fatal(__VA_ARGS__)
+#define LOG_STRIPPED(...) ((void)0)
+
+// Logs at most once per interval from this call site and reports how many were dropped
+#define LOG_THROTTLED(level, seconds, ...) \
+	do { \
+		static ::DemoEngine::LogThrottle logThrottle(seconds); \
+		uint32_t logSuppressed = 0; \
+		if (logThrottle.Allow(logSuppressed)) \
+		{ \
+			::DemoEngine::Log::GetLogger()->log(level, __VA_ARGS__); \
+			if (logSuppressed > 0) \
+				::DemoEngine::Log::GetLogger()->log(level, "  ({0} similar messages suppressed)", logSuppressed); \
+		} \
+	} while (false)
+
+#if DEMOENGINE_LOG_LEVEL <= DEMOENGINE_LOG_LEVEL_TRACE
+	#define LOG_TRACE(...) :: DemoEngine::Log::GetLogger()->trace(__VA_ARGS__)
+	#define LOG_TRACE_THROTTLED(seconds, ...) LOG_THROTTLED(spdlog::level::trace, seconds, __VA_ARGS__)
+#else
+	#define LOG_TRACE(...) LOG_STRIPPED()
+	#define LOG_TRACE_THROTTLED(...) LOG_STRIPPED()
+#endif
+
+#if DEMOENGINE_LOG_LEVEL <= DEMOENGINE_LOG_LEVEL_INFO
+	#define LOG_INFO(...) :: DemoEngine::Log::GetLogger()->info(__VA_ARGS__) 
+	#define LOG_INFO_THROTTLED(seconds, ...) LOG_THROTTLED(spdlog::level::info, seconds, __VA_ARGS__)
+#else
+	#define LOG_INFO(...) LOG_STRIPPED()
+	#define LOG_INFO_THROTTLED(...) LOG_STRIPPED()
+#endif
+
+#if DEMOENGINE_LOG_LEVEL <= DEMOENGINE_LOG_LEVEL_WARN
+	#define LOG_WARN(...) :: DemoEngine::Log::GetLogger()->warn(__VA_ARGS__)
+	#define LOG_WARN_THROTTLED(seconds, ...) LOG_THROTTLED(spdlog::level::warn, seconds, __VA_ARGS__)
+#else
+	#define LOG_WARN(...) LOG_STRIPPED()
+	#define LOG_WARN_THROTTLED(...) LOG_STRIPPED()
+#endif
+
+#if DEMOENGINE_LOG_LEVEL <= DEMOENGINE_LOG_LEVEL_ERROR
+	#define LOG_ERROR(...) :: DemoEngine::Log::GetLogger()->error(__VA_ARGS__) 
+	#define LOG_ERROR_THROTTLED(seconds, ...) LOG_THROTTLED(spdlog::level::err, seconds, __VA_ARGS__)
+#else
+	#define LOG_ERROR(...) LOG_STRIPPED()
+	#define LOG_ERROR_THROTTLED(...) LOG_STRIPPED()
+#endif
+
+#if DEMOENGINE_LOG_LEVEL <= DEMOENGINE_LOG_LEVEL_FATAL
+	#define LOG_FATAL(...) :: DemoEngine::Log::GetSyncLogger()->critical(__VA_ARGS__)
+#else
+	#define LOG_FATAL(...) LOG_STRIPPED()
+#endif
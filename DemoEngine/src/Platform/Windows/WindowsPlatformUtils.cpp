@@ -2,6 +2,7 @@
 #include "WindowsPlatformUtils.h"
 
 #include <commdlg.h>
+#include <psapi.h>
 #include <GLFW/glfw3.h>
 #define GLFW_EXPOSE_NATIVE_WIN32
 #include <GLFW/glfw3native.h>
@@ -51,4 +52,20 @@ namespace DemoEngine
 			return ofn.lpstrFile;
 		return std::string();
 	}
+
+	uint64_t WindowsProcessMemory::GetWorkingSet()
+	{
+		PROCESS_MEMORY_COUNTERS_EX counters = {};
+		if (!K32GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&counters, sizeof(counters)))
+			return 0;
+		return counters.WorkingSetSize;
+	}
+
+	uint64_t WindowsProcessMemory::GetPrivateBytes()
+	{
+		PROCESS_MEMORY_COUNTERS_EX counters = {};
+		if (!K32GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&counters, sizeof(counters)))
+			return 0;
+		return counters.PrivateUsage;
+	}
 }
@@ -11,5 +11,12 @@ namespace DemoEngine
 		static std::string SaveFile(const char* filter);
 
 	};
+
+	class WindowsProcessMemory : ProcessMemory
+	{
+	public:
+		static uint64_t GetWorkingSet();
+		static uint64_t GetPrivateBytes();
+	};
 }
 	
\ No newline at end of file
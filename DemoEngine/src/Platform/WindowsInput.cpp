@@ -1,58 +1,321 @@
 #include "DemoEngine_PCH.h"
 #include "Core/Input.h"
 #include <GLFW/glfw3.h>
-#include "Core/Application.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+#include "Events/ApplicationEvent.h"
 
 namespace DemoEngine
 {
+	struct ActionBinding
+	{
+		enum class Source : uint8_t { Key, MouseButton, GamepadButton, GamepadAxis };
+
+		Source Type;
+		uint16_t Code;
+		float Direction = 1.0f;
+	};
+
+	struct InputActionData
+	{
+		std::string Name;
+		std::vector<ActionBinding> Bindings;
+	};
+
+	struct InputData
+	{
+		InputSnapshot Live; // Written by events between snapshots
+		bool Focused = true;
+		InputSnapshot Current;
+		InputSnapshot Previous;
+
+		std::vector<InputActionData> Actions;
+		std::array<float, Input::MaxActions> ActionValues = {};
+		std::bitset<Input::MaxActions> ActionsHeld;
+		std::bitset<Input::MaxActions> PreviousActionsHeld;
+	};
+
 	static EventCallbackFn s_EventCallback;
+	static InputData s_Data;
+
+	// Stick values inside this radius are treated as centred
+	static constexpr float s_AxisDeadzone = 0.25f;
 
+	// Doesn't need a window, so headless replays can use it too
 	void Input::Init()
 	{
+		// Default gameplay actions used by PlayerControllerSystem
+		InputAction up = CreateAction("MoveUp");
+		BindKey(up, Key::W);
+		BindKey(up, Key::Up);
+		BindGamepadButton(up, Gamepad::DPadUp);
+		BindGamepadAxis(up, GamepadAxis::LeftY, -1.0f);
+
+		InputAction down = CreateAction("MoveDown");
+		BindKey(down, Key::S);
+		BindKey(down, Key::Down);
+		BindGamepadButton(down, Gamepad::DPadDown);
+		BindGamepadAxis(down, GamepadAxis::LeftY, 1.0f);
+
+		InputAction left = CreateAction("MoveLeft");
+		BindKey(left, Key::A);
+		BindKey(left, Key::Left);
+		BindGamepadButton(left, Gamepad::DPadLeft);
+		BindGamepadAxis(left, GamepadAxis::LeftX, -1.0f);
 
+		InputAction right = CreateAction("MoveRight");
+		BindKey(right, Key::D);
+		BindKey(right, Key::Right);
+		BindGamepadButton(right, Gamepad::DPadRight);
+		BindGamepadAxis(right, GamepadAxis::LeftX, 1.0f);
 	}
+
 	void Input::SetEventCallback(const EventCallbackFn& callback)
 	{
 		s_EventCallback = callback;
 	}
 
+	void Input::OnEvent(Event& e)
+	{
+		InputSnapshot& live = s_Data.Live;
+
+		switch (e.GetEventType())
+		{
+		case EventType::KeyPressed:
+		case EventType::KeyReleased:
+		{
+			int key = static_cast<KeyEvent&>(e).GetKeyCode();
+			if (key >= 0 && key < (int)live.Keys.size())
+				live.Keys.set(key, e.GetEventType() == EventType::KeyPressed);
+			break;
+		}
+		case EventType::MouseButtonPressed:
+		case EventType::MouseButtonReleased:
+		{
+			int button = static_cast<MouseButtonEvent&>(e).GetMouseButton();
+			if (button >= 0 && button < (int)live.MouseButtons.size())
+				live.MouseButtons.set(button, e.GetEventType() == EventType::MouseButtonPressed);
+			break;
+		}
+		case EventType::MouseMoved:
+		{
+			auto& moved = static_cast<MouseMovedEvent&>(e);
+			live.MouseX = moved.GetX();
+			live.MouseY = moved.GetY();
+			break;
+		}
+		case EventType::MouseScrolled:
+		{
+			auto& scrolled = static_cast<MouseScrolledEvent&>(e);
+			live.ScrollX += scrolled.GetXOffset();
+			live.ScrollY += scrolled.GetYOffset();
+			break;
+		}
+		case EventType::WindowFocus:
+			s_Data.Focused = true;
+			break;
+		case EventType::WindowLostFocus:
+		{
+			// Releases never arrive for whatever was held when focus went, so nothing stays stuck down
+			s_Data.Focused = false;
+			live.Keys.reset();
+			live.MouseButtons.reset();
+			live.ScrollX = 0.0f;
+			live.ScrollY = 0.0f;
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	static float EvaluateBinding(const ActionBinding& binding, const InputSnapshot& snapshot)
+	{
+		switch (binding.Type)
+		{
+		case ActionBinding::Source::Key:           return snapshot.Keys.test(binding.Code) ? 1.0f : 0.0f;
+		case ActionBinding::Source::MouseButton:   return snapshot.MouseButtons.test(binding.Code) ? 1.0f : 0.0f;
+		case ActionBinding::Source::GamepadButton: return snapshot.GamepadButtons.test(binding.Code) ? 1.0f : 0.0f;
+		case ActionBinding::Source::GamepadAxis:
+		{
+			float value = snapshot.GamepadAxes[binding.Code] * binding.Direction;
+			return value > s_AxisDeadzone ? std::min((value - s_AxisDeadzone) / (1.0f - s_AxisDeadzone), 1.0f) : 0.0f;
+		}
+		}
+		return 0.0f;
+	}
+
 	void Input::Update()
 	{
+		InputSnapshot snapshot = s_Data.Live;
+
+		// Scroll is a per-frame delta
+		s_Data.Live.ScrollX = 0.0f;
+		s_Data.Live.ScrollY = 0.0f;
+
+		// Gamepads have no callbacks for buttons and axes, so poll the first one here. GLFW reports
+		// them regardless of focus, so an unfocused window ignores them like the keyboard.
+		GLFWgamepadstate gamepad;
+		snapshot.GamepadConnected = glfwJoystickIsGamepad(GLFW_JOYSTICK_1) && glfwGetGamepadState(GLFW_JOYSTICK_1, &gamepad);
+		snapshot.GamepadButtons.reset();
+		snapshot.GamepadAxes.fill(0.0f);
+		if (snapshot.GamepadConnected && s_Data.Focused)
+		{
+			for (size_t i = 0; i < snapshot.GamepadButtons.size(); i++)
+				snapshot.GamepadButtons.set(i, gamepad.buttons[i] == GLFW_PRESS);
+			for (size_t i = 0; i < snapshot.GamepadAxes.size(); i++)
+				snapshot.GamepadAxes[i] = gamepad.axes[i];
+		}
 
+		// Actions resolve here, on the main thread, so systems only ever read them
+		InjectSnapshot(snapshot);
+	}
+
+	void Input::InjectSnapshot(const InputSnapshot& snapshot)
+	{
+		s_Data.Previous = s_Data.Current;
+		s_Data.Current = snapshot;
+		const InputSnapshot& current = s_Data.Current;
+
+		s_Data.PreviousActionsHeld = s_Data.ActionsHeld;
+		for (size_t i = 0; i < s_Data.Actions.size(); i++)
+		{
+			float value = 0.0f;
+			for (const ActionBinding& binding : s_Data.Actions[i].Bindings)
+				value = std::max(value, EvaluateBinding(binding, current));
+
+			s_Data.ActionValues[i] = value;
+			s_Data.ActionsHeld.set(i, value > 0.0f);
+		}
 	}
 
 	bool Input::IsKeyPressed(KeyCode key)
 	{
-		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow()); 
-		auto state = glfwGetKey(window, static_cast<int32_t>(key));
-		return state == GLFW_PRESS || state == GLFW_REPEAT;
-		
+		return key < s_Data.Current.Keys.size() && s_Data.Current.Keys.test(key);
 	}
 
 	bool Input::IsMouseButtonPressed(MouseCode button)
 	{
-		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow()); 
-		auto state = glfwGetMouseButton(window, button);
-		return state == GLFW_PRESS;
+		return button < s_Data.Current.MouseButtons.size() && s_Data.Current.MouseButtons.test(button);
+	}
+
+	bool Input::IsGamepadButtonPressed(GamepadButtonCode button)
+	{
+		return button < s_Data.Current.GamepadButtons.size() && s_Data.Current.GamepadButtons.test(button);
+	}
+
+	bool Input::IsKeyJustPressed(KeyCode key)
+	{
+		return IsKeyPressed(key) && !s_Data.Previous.Keys.test(key);
+	}
+
+	bool Input::IsKeyJustReleased(KeyCode key)
+	{
+		return key < s_Data.Current.Keys.size() && !s_Data.Current.Keys.test(key) && s_Data.Previous.Keys.test(key);
+	}
+
+	bool Input::IsMouseButtonJustPressed(MouseCode button)
+	{
+		return IsMouseButtonPressed(button) && !s_Data.Previous.MouseButtons.test(button);
+	}
+
+	bool Input::IsMouseButtonJustReleased(MouseCode button)
+	{
+		return button < s_Data.Current.MouseButtons.size() && !s_Data.Current.MouseButtons.test(button) && s_Data.Previous.MouseButtons.test(button);
+	}
+
+	float Input::GetGamepadAxis(GamepadAxisCode axis)
+	{
+		return axis < s_Data.Current.GamepadAxes.size() ? s_Data.Current.GamepadAxes[axis] : 0.0f;
 	}
 
 	std::pair<float, float> Input::GetMousePosition()
 	{
-		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow()); 
-		double xpos, ypos;
-		glfwGetCursorPos(window, &xpos, &ypos);
-		return { (float)xpos, (float)ypos };
+		return { s_Data.Current.MouseX, s_Data.Current.MouseY };
 	}
 	
 	float Input::GetMouseX()
 	{
-		auto [x, y] = GetMousePosition();
-		return x;
+		return s_Data.Current.MouseX;
 	}
 
 	float Input::GetMouseY()
 	{
-		auto [x, y] = GetMousePosition();
-		return y;
+		return s_Data.Current.MouseY;
+	}
+
+	const InputSnapshot& Input::GetSnapshot()
+	{
+		return s_Data.Current;
+	}
+
+	const InputSnapshot& Input::GetPreviousSnapshot()
+	{
+		return s_Data.Previous;
+	}
+
+	InputAction Input::CreateAction(const std::string& name)
+	{
+		InputAction existing = GetAction(name);
+		if (existing != InvalidAction)
+			return existing;
+
+		CORE_ASSERT(s_Data.Actions.size() < MaxActions, "Too many input actions");
+		s_Data.Actions.push_back({ name, {} });
+		return (InputAction)(s_Data.Actions.size() - 1);
+	}
+
+	InputAction Input::GetAction(const std::string& name)
+	{
+		for (size_t i = 0; i < s_Data.Actions.size(); i++)
+		{
+			if (s_Data.Actions[i].Name == name)
+				return (InputAction)i;
+		}
+		return InvalidAction;
+	}
+
+	void Input::BindKey(InputAction action, KeyCode key)
+	{
+		CORE_ASSERT(key < s_Data.Current.Keys.size(), "Invalid key code");
+		s_Data.Actions[action].Bindings.push_back({ ActionBinding::Source::Key, key });
+	}
+
+	void Input::BindMouseButton(InputAction action, MouseCode button)
+	{
+		CORE_ASSERT(button < s_Data.Current.MouseButtons.size(), "Invalid mouse button");
+		s_Data.Actions[action].Bindings.push_back({ ActionBinding::Source::MouseButton, button });
+	}
+
+	void Input::BindGamepadButton(InputAction action, GamepadButtonCode button)
+	{
+		CORE_ASSERT(button < s_Data.Current.GamepadButtons.size(), "Invalid gamepad button");
+		s_Data.Actions[action].Bindings.push_back({ ActionBinding::Source::GamepadButton, button });
+	}
+
+	void Input::BindGamepadAxis(InputAction action, GamepadAxisCode axis, float direction)
+	{
+		CORE_ASSERT(axis < s_Data.Current.GamepadAxes.size(), "Invalid gamepad axis");
+		s_Data.Actions[action].Bindings.push_back({ ActionBinding::Source::GamepadAxis, axis, direction < 0.0f ? -1.0f : 1.0f });
+	}
+
+	bool Input::IsActionHeld(InputAction action)
+	{
+		return action < MaxActions && s_Data.ActionsHeld.test(action);
+	}
+
+	bool Input::IsActionPressed(InputAction action)
+	{
+		return action < MaxActions && s_Data.ActionsHeld.test(action) && !s_Data.PreviousActionsHeld.test(action);
+	}
+
+	bool Input::IsActionReleased(InputAction action)
+	{
+		return action < MaxActions && !s_Data.ActionsHeld.test(action) && s_Data.PreviousActionsHeld.test(action);
+	}
+
+	float Input::GetActionValue(InputAction action)
+	{
+		return action < MaxActions ? s_Data.ActionValues[action] : 0.0f;
 	}
-}
\ No newline at end of file
+}
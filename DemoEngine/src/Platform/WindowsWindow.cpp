@@ -5,6 +5,7 @@
 #include "Events/MouseEvent.h"
 
 #include "GraphicsAPI/OpenGL/OpenGLContext.h"
+#include "Renderer/RenderThread.h"
 
 namespace DemoEngine
 {
@@ -84,6 +85,21 @@ namespace DemoEngine
 			data.EventCallback(ev);
 		});
 
+		glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* window, int focused)
+		{
+			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			if (focused)
+			{
+				WindowFocusEvent ev;
+				data.EventCallback(ev);
+			}
+			else
+			{
+				WindowLostFocusEvent ev;
+				data.EventCallback(ev);
+			}
+		});
+
 		glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int scancode, int action, int mods) { 
 			
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
@@ -161,19 +177,20 @@ namespace DemoEngine
 	void WindowsWindow::OnUpdate()
 	{
 		glfwPollEvents();
-		m_Context->SwapBuffers();
+
+		GraphicsContext* context = m_Context;
+		RenderThread::Submit([context]() { context->SwapBuffers(); });
 	}
 
-	void WindowsWindow::SetVSync(bool enabled)
+	void WindowsWindow::WaitEvents(double timeout)
 	{
-		if (enabled) {
-			glfwSwapInterval(1);
-		}
-		else
-		{
-		}
+		glfwWaitEventsTimeout(timeout);
+	}
 
-		glfwSwapInterval(0);
+	void WindowsWindow::SetVSync(bool enabled)
+	{
+		// The swap interval belongs to whichever thread has the context current
+		RenderThread::Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
 		m_Data.VSync = enabled;
 	}
 
@@ -16,6 +16,7 @@ namespace DemoEngine
 		virtual ~WindowsWindow();
 
 		void OnUpdate() override;
+		void WaitEvents(double timeout) override;
 
 		inline unsigned int GetWidth() const override { return m_Data.Width; }
 		inline unsigned int GetHeight() const override { return m_Data.Height; }
@@ -24,6 +25,7 @@ namespace DemoEngine
 		bool IsVSync() const;
 
 		inline virtual void* GetNativeWindow() const { return m_Window; }
+		inline GraphicsContext& GetContext() const override { return *m_Context; }
 
 		inline void SetEventCallback(const EventCallbackFn& callback) override {
 			m_Data.EventCallback = callback;
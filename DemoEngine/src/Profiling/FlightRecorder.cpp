@@ -0,0 +1,161 @@
+#include "DemoEngine_PCH.h"
+#include "FlightRecorder.h"
+#include "TraceWriter.h"
+#include "Utils/PlatformUtils.h"
+#include <deque>
+
+namespace DemoEngine
+{
+	struct FlightCounter
+	{
+		const char* Name;
+		std::function<double()> Provider;
+	};
+
+	struct FlightRecorderData
+	{
+		bool Enabled = true;
+		double WindowMicroseconds = 5.0 * 1000000.0;
+
+		float BudgetMultiplier = 2.0f;
+		float BudgetMinimum = 20.0f; // Milliseconds
+		double AverageFrame = 0.0; // Milliseconds, hitches excluded
+
+		std::deque<ProfileSample> Samples;
+		std::deque<ProfileCounterSample> Counters;
+		std::vector<FlightCounter> Providers;
+
+		uint64_t LastDump = 0;
+		bool HasDumped = false;
+		uint32_t HitchCount = 0;
+		std::string LastDumpPath;
+	};
+
+	static FlightRecorderData s_Data;
+
+	// Smoothing for the frame time average the budget is relative to
+	static constexpr double s_AverageWeight = 0.05;
+
+	void FlightRecorder::Init(float windowSeconds)
+	{
+		s_Data.WindowMicroseconds = (double)windowSeconds * 1000000.0;
+	}
+
+	void FlightRecorder::Shutdown()
+	{
+		s_Data.Samples.clear();
+		s_Data.Counters.clear();
+		s_Data.Providers.clear();
+	}
+
+	void FlightRecorder::SetEnabled(bool enabled)
+	{
+		s_Data.Enabled = enabled;
+		if (!enabled)
+		{
+			s_Data.Samples.clear();
+			s_Data.Counters.clear();
+		}
+	}
+
+	bool FlightRecorder::IsEnabled()
+	{
+		return s_Data.Enabled;
+	}
+
+	void FlightRecorder::SetBudget(float multiplier, float minimumMilliseconds)
+	{
+		s_Data.BudgetMultiplier = multiplier;
+		s_Data.BudgetMinimum = minimumMilliseconds;
+	}
+
+	float FlightRecorder::GetBudgetMultiplier()
+	{
+		return s_Data.BudgetMultiplier;
+	}
+
+	float FlightRecorder::GetBudgetMinimum()
+	{
+		return s_Data.BudgetMinimum;
+	}
+
+	void FlightRecorder::AddCounter(const char* name, const std::function<double()>& provider)
+	{
+		s_Data.Providers.push_back({ name, provider });
+	}
+
+	void FlightRecorder::EndFrame(Timestep ts)
+	{
+		if (!s_Data.Enabled)
+			return;
+
+		PROFILE_SCOPE("FlightRecorder::EndFrame");
+
+		uint64_t now = Profiler::ReadTicks();
+		const std::vector<ProfileSample>& collected = Profiler::GetCollectedSamples();
+		s_Data.Samples.insert(s_Data.Samples.end(), collected.begin(), collected.end());
+
+		double frame = ts.GetMilliseconds();
+		s_Data.Counters.push_back({ "Frame (ms)", now, frame });
+		for (const FlightCounter& counter : s_Data.Providers)
+			s_Data.Counters.push_back({ counter.Name, now, counter.Provider() });
+
+		// Samples arrive roughly in time order, so trimming from the front is enough
+		double nowMicroseconds = Profiler::TicksToMicroseconds(now);
+		auto expired = [nowMicroseconds](uint64_t ticks) { return nowMicroseconds - Profiler::TicksToMicroseconds(ticks) > s_Data.WindowMicroseconds; };
+		while (!s_Data.Samples.empty() && expired(s_Data.Samples.front().End))
+			s_Data.Samples.pop_front();
+		while (!s_Data.Counters.empty() && expired(s_Data.Counters.front().Time))
+			s_Data.Counters.pop_front();
+
+		// The first Timestep spans startup, so it only seeds the average
+		if (s_Data.AverageFrame == 0.0)
+		{
+			s_Data.AverageFrame = std::min(frame, (double)s_Data.BudgetMinimum);
+			return;
+		}
+
+		double budget = std::max((double)s_Data.BudgetMinimum, s_Data.AverageFrame * s_Data.BudgetMultiplier);
+		if (frame <= budget)
+		{
+			s_Data.AverageFrame += (frame - s_Data.AverageFrame) * s_AverageWeight;
+			return;
+		}
+
+		s_Data.HitchCount++;
+		LOG_WARN("Hitch: frame took {0:.2f} ms (budget {1:.2f} ms)", frame, budget);
+
+		// One dump per window; a burst of slow frames ends up in the same file
+		// (and writing it is a hitch of its own)
+		if (s_Data.HasDumped && !expired(s_Data.LastDump))
+			return;
+
+		Dump("Hitches/Hitch_" + LocalTime::Format() + "_" + std::to_string((int)frame) + "ms.json");
+		s_Data.LastDump = Profiler::ReadTicks();
+		s_Data.HasDumped = true;
+	}
+
+	bool FlightRecorder::Dump(const std::string& path)
+	{
+		std::vector<ProfileSample> samples(s_Data.Samples.begin(), s_Data.Samples.end());
+		std::vector<ProfileCounterSample> counters(s_Data.Counters.begin(), s_Data.Counters.end());
+
+		bool written = WriteTrace(path, samples, Profiler::GetThreadNames(), counters);
+		if (written)
+		{
+			s_Data.LastDumpPath = path;
+			LOG_INFO("Flight recorder written to '{0}' ({1} events)", path, samples.size());
+		}
+		return written;
+	}
+
+	uint32_t FlightRecorder::GetHitchCount()
+	{
+		return s_Data.HitchCount;
+	}
+
+	const std::string& FlightRecorder::GetLastDumpPath()
+	{
+		return s_Data.LastDumpPath;
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Profiler.h"
+#include "Core/Timestep.h"
+#include <functional>
+#include <string>
+
+namespace DemoEngine
+{
+	// Always-on flight recorder: keeps the last few seconds of profiler scopes and
+	// per-frame counters in memory, and dumps them to Hitches/ whenever a frame blows
+	// its budget, so slow frames can be inspected without a capture already running.
+	class FlightRecorder
+	{
+	public:
+		static void Init(float windowSeconds = 5.0f);
+		static void Shutdown();
+
+		static void SetEnabled(bool enabled);
+		static bool IsEnabled();
+
+		// A frame is a hitch when its Timestep exceeds multiplier times the recent
+		// average, and is never one below minimumMilliseconds
+		static void SetBudget(float multiplier, float minimumMilliseconds);
+		static float GetBudgetMultiplier();
+		static float GetBudgetMinimum();
+
+		// Sampled once per frame and written as counter tracks (render stats, memory, ...).
+		// Name must outlive the recorder.
+		static void AddCounter(const char* name, const std::function<double()>& provider);
+
+		// Call once per frame after Profiler::Collect, with the Timestep the frame ran with
+		static void EndFrame(Timestep ts);
+
+		// Writes the current window regardless of hitches
+		static bool Dump(const std::string& path);
+
+		static uint32_t GetHitchCount();
+		static const std::string& GetLastDumpPath();
+	};
+}
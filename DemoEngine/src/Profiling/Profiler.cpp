@@ -0,0 +1,219 @@
+#include "DemoEngine_PCH.h"
+#include "Profiler.h"
+#include "TraceWriter.h"
+#include "Core/FrameAllocator.h"
+#include <chrono>
+#include <mutex>
+
+namespace DemoEngine
+{
+	// Single-producer ring: only the owning thread writes, and Head is published with
+	// release ordering after the slot is filled. Readers copy a range and then discard
+	// whatever the writer may have lapped in the meantime.
+	struct ThreadRing
+	{
+		std::string Name;
+		uint32_t Index = 0;
+		std::atomic<uint64_t> Head = 0;
+		uint64_t ReadIndex = 0; // Only touched by Collect
+		std::unique_ptr<ProfileEvent[]> Events = std::make_unique<ProfileEvent[]>(Profiler::RingCapacity);
+	};
+
+	struct ProfilerData
+	{
+		std::mutex ThreadsMutex; // Guards registration only, never recording
+		std::vector<std::unique_ptr<ThreadRing>> Threads;
+
+		uint64_t BaseTicks = 0;
+		std::chrono::steady_clock::time_point BaseTime;
+		double TicksPerMicrosecond = 0.0;
+
+		bool SessionActive = false;
+		std::string SessionName;
+		uint64_t SessionStart = 0;
+		std::vector<ProfileSample> SessionSamples;
+
+		std::vector<ProfileSample> Collected;
+	};
+
+	static ProfilerData s_Data;
+	static thread_local ThreadRing* t_Ring = nullptr;
+
+	static ThreadRing& GetThreadRing()
+	{
+		if (t_Ring)
+			return *t_Ring;
+
+		std::lock_guard<std::mutex> lock(s_Data.ThreadsMutex);
+		auto& ring = s_Data.Threads.emplace_back(std::make_unique<ThreadRing>());
+		ring->Index = (uint32_t)(s_Data.Threads.size() - 1);
+		ring->Name = "Thread " + std::to_string(ring->Index);
+		t_Ring = ring.get();
+		return *t_Ring;
+	}
+
+	void Profiler::Init()
+	{
+		s_Data.BaseTicks = ReadTicks();
+		s_Data.BaseTime = std::chrono::steady_clock::now();
+		SetThreadName("Main");
+	}
+
+	void Profiler::Shutdown()
+	{
+		if (s_Data.SessionActive)
+			LOG_WARN("Profiling session '{0}' was never ended", s_Data.SessionName);
+		s_Data.SessionActive = false;
+		s_Data.SessionSamples.clear();
+	}
+
+	void Profiler::SetThreadName(const char* name)
+	{
+		ThreadRing& ring = GetThreadRing();
+		std::lock_guard<std::mutex> lock(s_Data.ThreadsMutex);
+		ring.Name = name;
+	}
+
+	const char* Profiler::InternName(const std::string& name)
+	{
+		// Never freed, so names stay valid through the traces written at shutdown
+		static std::mutex* s_InternMutex = new std::mutex();
+		static std::unordered_set<std::string>* s_InternedNames = new std::unordered_set<std::string>();
+
+		std::lock_guard<std::mutex> lock(*s_InternMutex);
+		return s_InternedNames->insert(name).first->c_str();
+	}
+
+	void Profiler::Record(const char* name, uint64_t start, uint64_t end)
+	{
+		ThreadRing& ring = GetThreadRing();
+
+		uint64_t head = ring.Head.load(std::memory_order_relaxed);
+		ring.Events[head & (RingCapacity - 1)] = { name, start, end };
+		ring.Head.store(head + 1, std::memory_order_release);
+	}
+
+	// Copies ring events in [from, head) that are still intact after the copy
+	template<typename Func>
+	static uint64_t ReadRing(const ThreadRing& ring, uint64_t from, Func&& func)
+	{
+		uint64_t head = ring.Head.load(std::memory_order_acquire);
+		if (head - from > Profiler::RingCapacity)
+			from = head - Profiler::RingCapacity;
+
+		ScratchScope scratch;
+		ArenaVector<ProfileEvent> copied(scratch.GetArena());
+		copied.reserve(head - from);
+		for (uint64_t i = from; i < head; i++)
+			copied.push_back(ring.Events[i & (Profiler::RingCapacity - 1)]);
+
+		// Anything the writer reached again while we were copying is unreliable
+		uint64_t headAfter = ring.Head.load(std::memory_order_acquire);
+		uint64_t firstValid = headAfter > Profiler::RingCapacity ? headAfter - Profiler::RingCapacity : 0;
+		for (uint64_t i = std::max(from, firstValid); i < head; i++)
+			func(copied[i - from]);
+
+		return head;
+	}
+
+	// The longer since Init, the better the tick rate estimate
+	static void Calibrate()
+	{
+		uint64_t ticks = Profiler::ReadTicks();
+		double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - s_Data.BaseTime).count();
+		if (elapsed > 0.0 && ticks > s_Data.BaseTicks)
+			s_Data.TicksPerMicrosecond = (double)(ticks - s_Data.BaseTicks) / elapsed;
+	}
+
+	void Profiler::Collect()
+	{
+		Calibrate();
+		s_Data.Collected.clear();
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data.ThreadsMutex);
+			for (auto& ring : s_Data.Threads)
+			{
+				uint32_t thread = ring->Index;
+				ring->ReadIndex = ReadRing(*ring, ring->ReadIndex, [thread](const ProfileEvent& event)
+				{
+					s_Data.Collected.push_back({ event.Name, event.Start, event.End, thread });
+				});
+			}
+		}
+
+		if (s_Data.SessionActive)
+		{
+			for (const ProfileSample& sample : s_Data.Collected)
+			{
+				if (sample.Start >= s_Data.SessionStart)
+					s_Data.SessionSamples.push_back(sample);
+			}
+		}
+	}
+
+	const std::vector<ProfileSample>& Profiler::GetCollectedSamples()
+	{
+		return s_Data.Collected;
+	}
+
+	void Profiler::BeginSession(const std::string& name)
+	{
+		if (s_Data.SessionActive)
+			LOG_WARN("Profiling session '{0}' replaced by '{1}'", s_Data.SessionName, name);
+
+		// Skip whatever is already in the rings
+		Collect();
+
+		s_Data.SessionActive = true;
+		s_Data.SessionName = name;
+		s_Data.SessionStart = ReadTicks();
+		s_Data.SessionSamples.clear();
+	}
+
+	bool Profiler::EndSession(const std::string& path)
+	{
+		if (!s_Data.SessionActive)
+			return false;
+
+		Collect();
+		s_Data.SessionActive = false;
+
+		bool written = WriteTrace(path, s_Data.SessionSamples, GetThreadNames());
+		if (written)
+			LOG_INFO("Profiling session '{0}' written to '{1}' ({2} events)", s_Data.SessionName, path, s_Data.SessionSamples.size());
+
+		s_Data.SessionSamples.clear();
+		s_Data.SessionSamples.shrink_to_fit();
+		return written;
+	}
+
+	bool Profiler::IsSessionActive()
+	{
+		return s_Data.SessionActive;
+	}
+
+	double Profiler::TicksToMicroseconds(uint64_t ticks)
+	{
+		if (s_Data.TicksPerMicrosecond == 0.0)
+			Calibrate();
+
+		double ticksPerMicrosecond = s_Data.TicksPerMicrosecond > 0.0 ? s_Data.TicksPerMicrosecond : 1.0;
+		return (double)(int64_t)(ticks - s_Data.BaseTicks) / ticksPerMicrosecond;
+	}
+
+	uint64_t Profiler::GetBaseTicks()
+	{
+		return s_Data.BaseTicks;
+	}
+
+	std::vector<std::string> Profiler::GetThreadNames()
+	{
+		std::lock_guard<std::mutex> lock(s_Data.ThreadsMutex);
+
+		std::vector<std::string> names;
+		for (auto& ring : s_Data.Threads)
+			names.push_back(ring->Name);
+		return names;
+	}
+}
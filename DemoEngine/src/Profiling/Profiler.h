@@ -0,0 +1,126 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+
+// Set DEMOENGINE_PROFILE to 0 (Dist does) to compile every PROFILE_* macro out
+#ifndef DEMOENGINE_PROFILE
+	#define DEMOENGINE_PROFILE 1
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#else
+	#include <chrono>
+#endif
+
+namespace DemoEngine
+{
+	// One completed scope. Name must outlive the trace: a string literal, or a
+	// runtime name passed through Profiler::InternName.
+	struct ProfileEvent
+	{
+		const char* Name;
+		uint64_t Start; // Profiler ticks
+		uint64_t End;
+	};
+
+	// Event tagged with the thread that recorded it, as handed to the trace writers
+	struct ProfileSample
+	{
+		const char* Name;
+		uint64_t Start;
+		uint64_t End;
+		uint32_t Thread;
+	};
+
+	// Value of a named counter at a point in time (frame stats, memory, ...)
+	struct ProfileCounterSample
+	{
+		const char* Name;
+		uint64_t Time; // Profiler ticks
+		double Value;
+	};
+
+	// Collects PROFILE_SCOPE events. Every thread records into its own fixed-size
+	// ring buffer without locking; Collect() drains the rings on the main thread.
+	class Profiler
+	{
+	public:
+		static constexpr uint32_t RingCapacity = 1 << 16; // Events per thread, power of two
+
+		static void Init();
+		static void Shutdown();
+
+		// Shown as the track name in traces; call once from each long-lived thread
+		static void SetThreadName(const char* name);
+
+		// Copy of name that lives until the process exits, for scopes named at runtime (layers,
+		// systems). Traces and the flight recorder keep names long after their owner is gone.
+		// Takes a lock; intern once when the owner is created, not per scope.
+		static const char* InternName(const std::string& name);
+
+		// Invariant TSC where available, so a scope costs two rdtsc and a store
+		static uint64_t ReadTicks()
+		{
+		#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+		#else
+			return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+		#endif
+		}
+
+		static void Record(const char* name, uint64_t start, uint64_t end);
+
+		// Records everything from now until EndSession, which writes it to path.
+		// ".json" writes Chrome Trace Event JSON (chrome://tracing, ui.perfetto.dev),
+		// ".pftrace"/".perfetto-trace" write a Perfetto protobuf trace.
+		static void BeginSession(const std::string& name);
+		static bool EndSession(const std::string& path);
+		static bool IsSessionActive();
+
+		// Drains the thread rings; call once per frame from the main thread
+		static void Collect();
+		// Samples drained by the most recent Collect, for consumers such as FlightRecorder
+		static const std::vector<ProfileSample>& GetCollectedSamples();
+
+		// Tick conversion, recalibrated against steady_clock by every Collect
+		static double TicksToMicroseconds(uint64_t ticks);
+		static uint64_t GetBaseTicks();
+
+		static std::vector<std::string> GetThreadNames();
+	};
+
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name) : m_Name(name), m_Start(Profiler::ReadTicks()) {}
+		~ProfileScope() { Profiler::Record(m_Name, m_Start, Profiler::ReadTicks()); }
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* m_Name;
+		uint64_t m_Start;
+	};
+}
+
+#if DEMOENGINE_PROFILE
+	#if defined(_MSC_VER)
+		#define PROFILE_FUNCSIG __FUNCSIG__
+	#else
+		#define PROFILE_FUNCSIG __PRETTY_FUNCTION__
+	#endif
+
+	#define PROFILE_CONCAT_INNER(a, b) a##b
+	#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+	#define PROFILE_SCOPE(name) ::DemoEngine::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+	#define PROFILE_FUNCTION() PROFILE_SCOPE(PROFILE_FUNCSIG)
+#else
+	#define PROFILE_SCOPE(name)
+	#define PROFILE_FUNCTION()
+#endif
@@ -0,0 +1,88 @@
+#include "DemoEngine_PCH.h"
+#include "StartupTimeline.h"
+#include "TraceWriter.h"
+#include "Utils/PlatformUtils.h"
+
+namespace DemoEngine
+{
+	struct StartupTimelineData
+	{
+		bool Complete = false;
+		bool WriteTrace = false;
+		double TimeToFirstFrame = 0.0;
+		std::string ReportPath;
+	};
+
+	static StartupTimelineData s_Data;
+
+	void StartupTimeline::OnFirstFrame()
+	{
+		if (s_Data.Complete)
+			return;
+
+		s_Data.Complete = true;
+		s_Data.TimeToFirstFrame = Profiler::TicksToMicroseconds(Profiler::ReadTicks()) / 1000.0;
+
+		const std::vector<ProfileSample>& samples = Profiler::GetCollectedSamples();
+		std::vector<std::string> threadNames = Profiler::GetThreadNames();
+
+		// Outermost spans only: anything starting before the previous span on its thread ended is nested in it
+		std::vector<ProfileSample> spans = samples;
+		std::sort(spans.begin(), spans.end(), [](const ProfileSample& a, const ProfileSample& b)
+		{
+			if (a.Thread != b.Thread)
+				return a.Thread < b.Thread;
+			return a.Start != b.Start ? a.Start < b.Start : a.End > b.End;
+		});
+
+		std::vector<ProfileSample> topLevel;
+		for (const ProfileSample& span : spans)
+		{
+			if (!topLevel.empty() && topLevel.back().Thread == span.Thread && span.Start < topLevel.back().End)
+				continue;
+			topLevel.push_back(span);
+		}
+		std::sort(topLevel.begin(), topLevel.end(), [](const ProfileSample& a, const ProfileSample& b) { return a.Start < b.Start; });
+
+		LOG_INFO("Startup: first frame finished after {0:.1f} ms", s_Data.TimeToFirstFrame);
+		for (const ProfileSample& span : topLevel)
+		{
+			double start = Profiler::TicksToMicroseconds(span.Start) / 1000.0;
+			double duration = (Profiler::TicksToMicroseconds(span.End) - Profiler::TicksToMicroseconds(span.Start)) / 1000.0;
+			const std::string& thread = span.Thread < threadNames.size() ? threadNames[span.Thread] : "?";
+			LOG_INFO("  {0:>8.1f} ms  {1:>8.1f} ms  {2:<10} {3}", start, duration, thread, span.Name);
+		}
+
+	#if DEMOENGINE_PROFILE
+		if (!s_Data.WriteTrace)
+			return;
+
+		std::string path = "Profiles/Startup_" + LocalTime::Format() + ".json";
+		if (WriteChromeTrace(path, samples, threadNames))
+		{
+			s_Data.ReportPath = path;
+			LOG_INFO("Startup timeline written to '{0}'", s_Data.ReportPath);
+		}
+	#endif
+	}
+
+	void StartupTimeline::SetWriteTrace(bool enabled)
+	{
+		s_Data.WriteTrace = enabled;
+	}
+
+	bool StartupTimeline::IsComplete()
+	{
+		return s_Data.Complete;
+	}
+
+	double StartupTimeline::GetTimeToFirstFrame()
+	{
+		return s_Data.TimeToFirstFrame;
+	}
+
+	const std::string& StartupTimeline::GetReportPath()
+	{
+		return s_Data.ReportPath;
+	}
+}
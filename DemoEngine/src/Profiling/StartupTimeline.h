@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+
+namespace DemoEngine
+{
+	// Reports where startup time went. Profiler rings are only drained once the
+	// first frame ends, so the first Collect still holds every PROFILE_SCOPE from
+	// Profiler::Init (the top of main) onwards.
+	class StartupTimeline
+	{
+	public:
+		// Call once after the first frame's Profiler::Collect. Logs the top-level
+		// spans of each thread, and writes the full timeline to Profiles/ if enabled.
+		static void OnFirstFrame();
+
+		// Off by default so every launch doesn't leave a file behind; --startup-trace turns it on
+		static void SetWriteTrace(bool enabled);
+
+		static bool IsComplete();
+		// Milliseconds from Profiler::Init to the end of the first frame
+		static double GetTimeToFirstFrame();
+		static const std::string& GetReportPath();
+	};
+}
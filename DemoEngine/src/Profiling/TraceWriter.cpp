@@ -0,0 +1,287 @@
+#include "DemoEngine_PCH.h"
+#include "TraceWriter.h"
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+namespace DemoEngine
+{
+	bool WriteTrace(const std::string& path, const std::vector<ProfileSample>& samples, const std::vector<std::string>& threadNames,
+		const std::vector<ProfileCounterSample>& counters)
+	{
+		std::string extension = std::filesystem::path(path).extension().string();
+		if (extension == ".pftrace" || extension == ".perfetto-trace")
+			return WritePerfettoTrace(path, samples, threadNames, counters);
+
+		return WriteChromeTrace(path, samples, threadNames, counters);
+	}
+
+	static std::ofstream OpenTraceFile(const std::string& path, std::ios::openmode mode)
+	{
+		std::filesystem::path filePath(path);
+		if (filePath.has_parent_path())
+			std::filesystem::create_directories(filePath.parent_path());
+
+		std::ofstream stream(filePath, mode | std::ios::trunc);
+		if (!stream)
+			LOG_ERROR("Could not open trace file '{0}'", path);
+		return stream;
+	}
+
+	static void WriteJsonString(std::ostream& stream, const char* text)
+	{
+		stream << '"';
+		for (const char* c = text; *c; c++)
+		{
+			if (*c == '"' || *c == '\\')
+				stream << '\\';
+			stream << *c;
+		}
+		stream << '"';
+	}
+
+	bool WriteChromeTrace(const std::string& path, const std::vector<ProfileSample>& samples, const std::vector<std::string>& threadNames,
+		const std::vector<ProfileCounterSample>& counters)
+	{
+		std::ofstream stream = OpenTraceFile(path, std::ios::out);
+		if (!stream)
+			return false;
+
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		bool first = true;
+		for (uint32_t thread = 0; thread < threadNames.size(); thread++)
+		{
+			stream << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":";
+			WriteJsonString(stream, threadNames[thread].c_str());
+			stream << "}}";
+			first = false;
+		}
+
+		stream.setf(std::ios::fixed);
+		stream.precision(3);
+		for (const ProfileSample& sample : samples)
+		{
+			double start = Profiler::TicksToMicroseconds(sample.Start);
+			double duration = Profiler::TicksToMicroseconds(sample.End) - start;
+
+			stream << (first ? "" : ",") << "\n{\"ph\":\"X\",\"cat\":\"function\",\"name\":";
+			WriteJsonString(stream, sample.Name);
+			stream << ",\"ts\":" << start << ",\"dur\":" << duration << ",\"pid\":0,\"tid\":" << sample.Thread << "}";
+			first = false;
+		}
+
+		for (const ProfileCounterSample& counter : counters)
+		{
+			stream << (first ? "" : ",") << "\n{\"ph\":\"C\",\"name\":";
+			WriteJsonString(stream, counter.Name);
+			stream << ",\"ts\":" << Profiler::TicksToMicroseconds(counter.Time) << ",\"pid\":0,\"args\":{\"value\":" << counter.Value << "}}";
+			first = false;
+		}
+
+		stream << "\n]}\n";
+		return (bool)stream;
+	}
+
+	// Just enough of the protobuf wire format for Trace/TracePacket/TrackEvent
+	class ProtoWriter
+	{
+	public:
+		void Varint(uint32_t field, uint64_t value) { Tag(field, 0); RawVarint(value); }
+		void Bytes(uint32_t field, const void* data, size_t size)
+		{
+			Tag(field, 2);
+			RawVarint(size);
+			m_Buffer.append((const char*)data, size);
+		}
+		void String(uint32_t field, const std::string& text) { Bytes(field, text.data(), text.size()); }
+		void Double(uint32_t field, double value)
+		{
+			Tag(field, 1);
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			for (int i = 0; i < 8; i++)
+				m_Buffer.push_back((char)(bits >> (i * 8)));
+		}
+		void Message(uint32_t field, const ProtoWriter& message) { Bytes(field, message.m_Buffer.data(), message.m_Buffer.size()); }
+
+		const std::string& GetBuffer() const { return m_Buffer; }
+		void Clear() { m_Buffer.clear(); }
+
+	private:
+		void Tag(uint32_t field, uint32_t wireType) { RawVarint((field << 3) | wireType); }
+		void RawVarint(uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				m_Buffer.push_back((char)((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+			m_Buffer.push_back((char)value);
+		}
+
+	private:
+		std::string m_Buffer;
+	};
+
+	// Field numbers from perfetto/protos/perfetto/trace/
+	namespace PerfettoField
+	{
+		enum : uint32_t
+		{
+			TracePacket = 1, // Trace.packet
+
+			Timestamp = 8, // TracePacket
+			TrustedPacketSequenceId = 10,
+			TrackEvent = 11,
+			SequenceFlags = 13,
+			TrackDescriptor = 60,
+
+			TrackUuid = 1, // TrackDescriptor.uuid
+			TrackName = 2,
+			TrackThread = 4,
+			TrackCounter = 8,
+
+			ThreadPid = 1, // ThreadDescriptor
+			ThreadTid = 2,
+			ThreadName = 5,
+
+			EventType = 9, // TrackEvent
+			EventTrackUuid = 11,
+			EventName = 23,
+			EventDoubleCounterValue = 44
+		};
+	}
+
+	static constexpr uint32_t s_PerfettoSequenceId = 1;
+	static constexpr uint64_t s_PerfettoTrackBase = 1000; // Track uuid = base + thread index
+	static constexpr uint64_t s_CounterTrackBase = 100000; // Track uuid = base + counter index
+	static constexpr uint64_t s_SliceBegin = 1, s_SliceEnd = 2, s_Counter = 4;
+
+	bool WritePerfettoTrace(const std::string& path, const std::vector<ProfileSample>& samples, const std::vector<std::string>& threadNames,
+		const std::vector<ProfileCounterSample>& counters)
+	{
+		std::ofstream stream = OpenTraceFile(path, std::ios::out | std::ios::binary);
+		if (!stream)
+			return false;
+
+		using namespace PerfettoField;
+
+		ProtoWriter packet, nested, inner, trace;
+		auto emitPacket = [&]()
+		{
+			trace.Clear();
+			trace.Message(TracePacket, packet);
+			stream.write(trace.GetBuffer().data(), trace.GetBuffer().size());
+			packet.Clear();
+		};
+
+		// One thread track per recorded thread
+		for (uint32_t thread = 0; thread < threadNames.size(); thread++)
+		{
+			inner.Clear();
+			inner.Varint(ThreadPid, 1);
+			inner.Varint(ThreadTid, thread + 1);
+			inner.String(ThreadName, threadNames[thread]);
+
+			nested.Clear();
+			nested.Varint(TrackUuid, s_PerfettoTrackBase + thread);
+			nested.String(TrackName, threadNames[thread]);
+			nested.Message(TrackThread, inner);
+
+			packet.Varint(TrustedPacketSequenceId, s_PerfettoSequenceId);
+			if (thread == 0)
+				packet.Varint(SequenceFlags, 1); // SEQ_INCREMENTAL_STATE_CLEARED
+			packet.Message(TrackDescriptor, nested);
+			emitPacket();
+		}
+
+		// One counter track per distinct counter name
+		std::vector<const char*> counterNames;
+		for (const ProfileCounterSample& counter : counters)
+		{
+			if (std::find_if(counterNames.begin(), counterNames.end(), [&](const char* name) { return strcmp(name, counter.Name) == 0; }) != counterNames.end())
+				continue;
+
+			inner.Clear();
+			nested.Clear();
+			nested.Varint(TrackUuid, s_CounterTrackBase + counterNames.size());
+			nested.String(TrackName, counter.Name);
+			nested.Message(TrackCounter, inner);
+
+			packet.Varint(TrustedPacketSequenceId, s_PerfettoSequenceId);
+			packet.Message(TrackDescriptor, nested);
+			emitPacket();
+
+			counterNames.push_back(counter.Name);
+		}
+
+		for (const ProfileCounterSample& counter : counters)
+		{
+			size_t index = std::find_if(counterNames.begin(), counterNames.end(), [&](const char* name) { return strcmp(name, counter.Name) == 0; }) - counterNames.begin();
+
+			nested.Clear();
+			nested.Varint(EventType, s_Counter);
+			nested.Varint(EventTrackUuid, s_CounterTrackBase + index);
+			nested.Double(EventDoubleCounterValue, counter.Value);
+
+			packet.Varint(Timestamp, (uint64_t)(Profiler::TicksToMicroseconds(counter.Time) * 1000.0));
+			packet.Varint(TrustedPacketSequenceId, s_PerfettoSequenceId);
+			packet.Message(TrackEvent, nested);
+			emitPacket();
+		}
+
+		auto emitSlice = [&](const ProfileSample& sample, bool begin)
+		{
+			nested.Clear();
+			nested.Varint(EventType, begin ? s_SliceBegin : s_SliceEnd);
+			nested.Varint(EventTrackUuid, s_PerfettoTrackBase + sample.Thread);
+			if (begin)
+				nested.String(EventName, sample.Name);
+
+			uint64_t ticks = begin ? sample.Start : sample.End;
+			packet.Varint(Timestamp, (uint64_t)(Profiler::TicksToMicroseconds(ticks) * 1000.0));
+			packet.Varint(TrustedPacketSequenceId, s_PerfettoSequenceId);
+			packet.Message(TrackEvent, nested);
+			emitPacket();
+		};
+
+		// Scopes nest within a thread, so walking each thread's samples by start time
+		// (outermost first) with a stack of open slices yields matched begin/end pairs
+		std::vector<const ProfileSample*> sorted;
+		sorted.reserve(samples.size());
+		for (const ProfileSample& sample : samples)
+			sorted.push_back(&sample);
+
+		std::sort(sorted.begin(), sorted.end(), [](const ProfileSample* a, const ProfileSample* b)
+		{
+			if (a->Thread != b->Thread)
+				return a->Thread < b->Thread;
+			if (a->Start != b->Start)
+				return a->Start < b->Start;
+			return a->End > b->End;
+		});
+
+		std::vector<const ProfileSample*> open;
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			const ProfileSample& sample = *sorted[i];
+			while (!open.empty() && (open.back()->Thread != sample.Thread || open.back()->End <= sample.Start))
+			{
+				emitSlice(*open.back(), false);
+				open.pop_back();
+			}
+
+			emitSlice(sample, true);
+			open.push_back(&sample);
+		}
+
+		while (!open.empty())
+		{
+			emitSlice(*open.back(), false);
+			open.pop_back();
+		}
+
+		return (bool)stream;
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "Profiler.h"
+
+namespace DemoEngine
+{
+	// Writes samples (and optional counters) as Chrome Trace Event JSON or as a
+	// Perfetto protobuf trace, picked from the file extension (see Profiler::EndSession)
+	bool WriteTrace(const std::string& path, const std::vector<ProfileSample>& samples, const std::vector<std::string>& threadNames,
+		const std::vector<ProfileCounterSample>& counters = {});
+
+	bool WriteChromeTrace(const std::string& path, const std::vector<ProfileSample>& samples, const std::vector<std::string>& threadNames,
+		const std::vector<ProfileCounterSample>& counters = {});
+	bool WritePerfettoTrace(const std::string& path, const std::vector<ProfileSample>& samples, const std::vector<std::string>& threadNames,
+		const std::vector<ProfileCounterSample>& counters = {});
+}
@@ -4,94 +4,54 @@
 #include "Renderer/Data/VertexArray.h" 
 #include "Renderer/Shader/Shader.h"
 #include "Renderer/Data/UniformBuffer.h"
+#include "Renderer/RenderThread.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 #include "Renderer2DData.h"
+#include "Core/HeapTracker.h"
+#include "Core/TaskGroup.h"
 #include <glad/glad.h>
 
 namespace DemoEngine
 {
 	static Renderer2DData s_Data; // Global static instance holding rendering state
 
-	// Initializes all buffers, shaders and state for 2D rendering
-	void Renderer2D::Init()
+	// GPU work goes through these so the null backend can drop it
+	template<typename FuncT>
+	static void SubmitGPU(FuncT&& func)
 	{
-		// Quad buffers and setup
-		s_Data.QuadVertexArray = VertexArray::Create();
-		s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
-		s_Data.QuadVertexBuffer->SetLayout({
-			{ ShaderDataType::Float3, "a_Position" },
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Float2, "a_TexCoord" },
-			{ ShaderDataType::Float2, "a_TilingFactor" },
-			{ ShaderDataType::Int,    "a_EntityID" }
-			});
-		s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
-		s_Data.QuadVertexBufferBase = new QuadVertex[s_Data.MaxVertices];
+		if (s_Data.Backend != RendererBackend::Null)
+			RenderThread::Submit(std::forward<FuncT>(func));
+	}
 
-		// Generate indices for quads
-		uint32_t* quadIndices = new uint32_t[s_Data.MaxIndices];
-		uint32_t offset = 0;
-		for (uint32_t i = 0; i < s_Data.MaxIndices; i += 6)
-		{
-			quadIndices[i + 0] = offset + 0;
-			quadIndices[i + 1] = offset + 1;
-			quadIndices[i + 2] = offset + 2;
-			quadIndices[i + 3] = offset + 2;
-			quadIndices[i + 4] = offset + 3;
-			quadIndices[i + 5] = offset + 0;
-			offset += 4;
-		}
-		Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Data.MaxIndices);
-		s_Data.QuadVertexArray->SetIndexBuffer(quadIB);
-		delete[] quadIndices;
-
-		// Circle buffer setup (uses same index buffer)
-		s_Data.CircleVertexArray = VertexArray::Create();
-		s_Data.CircleVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(CircleVertex));
-		s_Data.CircleVertexBuffer->SetLayout({
-			{ ShaderDataType::Float3, "a_WorldPosition" },
-			{ ShaderDataType::Float3, "a_LocalPosition" },
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Float,  "a_Thickness" },
-			{ ShaderDataType::Float,  "a_Fade" },
-			{ ShaderDataType::Int,    "a_EntityID" }
-			});
-		s_Data.CircleVertexArray->AddVertexBuffer(s_Data.CircleVertexBuffer);
-		s_Data.CircleVertexArray->SetIndexBuffer(quadIB);
-		s_Data.CircleVertexBufferBase = new CircleVertex[s_Data.MaxVertices];
+	static const void* CopyGPU(const void* data, uint32_t size)
+	{
+		return s_Data.Backend == RendererBackend::Null ? data : RenderThread::Copy(data, size);
+	}
 
-		// Box collider rendering buffers
-		s_Data.BoxColliderVertexArray = VertexArray::Create();
-		s_Data.BoxColliderVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(ColliderVertex));
-		s_Data.BoxColliderVertexBuffer->SetLayout({
-			{ ShaderDataType::Float3, "a_Position" },
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Int,    "a_EntityID" }
-			});
-		s_Data.BoxColliderVertexArray->AddVertexBuffer(s_Data.BoxColliderVertexBuffer);
-		s_Data.BoxColliderVertexArray->SetIndexBuffer(quadIB);
-		s_Data.BoxColliderVertexBufferBase = new ColliderVertex[s_Data.MaxVertices];
+	// Initializes the quad batch and shared state for 2D rendering. Circle and
+	// collider batches are built the first time something draws into them.
+	void Renderer2D::Init(RendererBackend backend)
+	{
+		PROFILE_FUNCTION();
+		MemoryTagScope memoryTag(MemoryTag::Renderer);
 
-		// Circle collider rendering buffers
-		s_Data.CircleColliderVertexArray = VertexArray::Create();
-		s_Data.CircleColliderVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(ColliderVertex));
-		s_Data.CircleColliderVertexBuffer->SetLayout({
-			{ ShaderDataType::Float3, "a_Position" },
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Int,    "a_EntityID" }
-			});
-		s_Data.CircleColliderVertexArray->AddVertexBuffer(s_Data.CircleColliderVertexBuffer);
-		s_Data.CircleColliderVertexArray->SetIndexBuffer(quadIB);
-		s_Data.CircleColliderVertexBufferBase = new ColliderVertex[s_Data.MaxVertices];
+		s_Data.Backend = backend;
+
+		// Read every shader in parallel; the lazy batches only need to compile theirs later
+		ShaderSource quadShaderSource;
+		if (backend != RendererBackend::Null)
+		{
+			TaskGroup loads;
+			loads.Run([&]() { quadShaderSource = Shader::LoadSource("assets/shaders/Renderer2D_Quad.glsl"); });
+			loads.Run([]() { s_Data.CircleShaderSource = Shader::LoadSource("assets/shaders/Renderer2D_Circle.glsl"); });
+			loads.Run([]() { s_Data.BoxColliderShaderSource = Shader::LoadSource("assets/shaders/BoxColliderShader.glsl"); });
+			loads.Run([]() { s_Data.CircleColliderShaderSource = Shader::LoadSource("assets/shaders/CircleColliderShader.glsl"); });
+		}
 
-		// Load shaders
-		s_Data.QuadShader = CreateRef<Shader>("assets/shaders/Renderer2D_Quad.glsl");
-		s_Data.CircleShader = CreateRef<Shader>("assets/shaders/Renderer2D_Circle.glsl");
-		s_Data.BoxColliderShader = CreateRef<Shader>("assets/shaders/BoxColliderShader.glsl");
-		s_Data.CircleColliderShader = CreateRef<Shader>("assets/shaders/CircleColliderShader.glsl");
+		s_Data.QuadVertexBufferBase = new QuadVertex[s_Data.MaxVertices];
 
 		// Set default quad positions (unit quad)
 		s_Data.QuadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
@@ -99,35 +59,167 @@ namespace DemoEngine
 		s_Data.QuadVertexPositions[2] = { 0.5f,  0.5f, 0.0f, 1.0f };
 		s_Data.QuadVertexPositions[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
 
-		// Create uniform buffer for camera matrices
-		s_Data.CameraUniformBuffer = UniformBuffer::Create(sizeof(Renderer2DData::CameraData), 0);
+		// GPU resources are created on the render thread; wait so they exist before the first frame
+		SubmitGPU([quadShaderSource]()
+		{
+			MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+			// Quad buffers and setup
+			s_Data.QuadVertexArray = VertexArray::Create();
+			s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
+			s_Data.QuadVertexBuffer->SetLayout({
+				{ ShaderDataType::Float3, "a_Position" },
+				{ ShaderDataType::Float4, "a_Color" },
+				{ ShaderDataType::Float2, "a_TexCoord" },
+				{ ShaderDataType::Float2, "a_TilingFactor" },
+				{ ShaderDataType::Int,    "a_EntityID" }
+				});
+			s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
+
+			// Generate indices for quads, shared by every batch
+			uint32_t* quadIndices = new uint32_t[s_Data.MaxIndices];
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < s_Data.MaxIndices; i += 6)
+			{
+				quadIndices[i + 0] = offset + 0;
+				quadIndices[i + 1] = offset + 1;
+				quadIndices[i + 2] = offset + 2;
+				quadIndices[i + 3] = offset + 2;
+				quadIndices[i + 4] = offset + 3;
+				quadIndices[i + 5] = offset + 0;
+				offset += 4;
+			}
+			s_Data.QuadIndexBuffer = IndexBuffer::Create(quadIndices, s_Data.MaxIndices);
+			s_Data.QuadVertexArray->SetIndexBuffer(s_Data.QuadIndexBuffer);
+			delete[] quadIndices;
+
+			s_Data.QuadShader = CreateRef<Shader>(quadShaderSource);
+
+			// Create uniform buffer for camera matrices
+			s_Data.CameraUniformBuffer = UniformBuffer::Create(sizeof(Renderer2DData::CameraData), 0);
+
+			glEnable(GL_DEPTH_TEST); // Enable depth testing
+		});
+		RenderThread::WaitIdle();
+	}
+
+	// Circle buffer setup (uses the quad index buffer)
+	void Renderer2D::InitCircleBatch()
+	{
+		PROFILE_FUNCTION();
+		MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+		s_Data.CircleVertexBufferBase = new CircleVertex[s_Data.MaxVertices];
+		s_Data.CircleVertexBufferPtr = s_Data.CircleVertexBufferBase;
+
+		SubmitGPU([]()
+		{
+			MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+			s_Data.CircleVertexArray = VertexArray::Create();
+			s_Data.CircleVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(CircleVertex));
+			s_Data.CircleVertexBuffer->SetLayout({
+				{ ShaderDataType::Float3, "a_WorldPosition" },
+				{ ShaderDataType::Float3, "a_LocalPosition" },
+				{ ShaderDataType::Float4, "a_Color" },
+				{ ShaderDataType::Float,  "a_Thickness" },
+				{ ShaderDataType::Float,  "a_Fade" },
+				{ ShaderDataType::Int,    "a_EntityID" }
+				});
+			s_Data.CircleVertexArray->AddVertexBuffer(s_Data.CircleVertexBuffer);
+			s_Data.CircleVertexArray->SetIndexBuffer(s_Data.QuadIndexBuffer);
+			s_Data.CircleShader = CreateRef<Shader>(s_Data.CircleShaderSource);
+		});
+	}
+
+	// Box collider rendering buffers
+	void Renderer2D::InitBoxColliderBatch()
+	{
+		PROFILE_FUNCTION();
+		MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+		s_Data.BoxColliderVertexBufferBase = new ColliderVertex[s_Data.MaxVertices];
+		s_Data.BoxColliderVertexBufferPtr = s_Data.BoxColliderVertexBufferBase;
 
-		glEnable(GL_DEPTH_TEST); // Enable depth testing
+		SubmitGPU([]()
+		{
+			MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+			s_Data.BoxColliderVertexArray = VertexArray::Create();
+			s_Data.BoxColliderVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(ColliderVertex));
+			s_Data.BoxColliderVertexBuffer->SetLayout({
+				{ ShaderDataType::Float3, "a_Position" },
+				{ ShaderDataType::Float4, "a_Color" },
+				{ ShaderDataType::Int,    "a_EntityID" }
+				});
+			s_Data.BoxColliderVertexArray->AddVertexBuffer(s_Data.BoxColliderVertexBuffer);
+			s_Data.BoxColliderVertexArray->SetIndexBuffer(s_Data.QuadIndexBuffer);
+			s_Data.BoxColliderShader = CreateRef<Shader>(s_Data.BoxColliderShaderSource);
+		});
 	}
 
-	// Frees dynamically allocated vertex buffer
+	// Circle collider rendering buffers
+	void Renderer2D::InitCircleColliderBatch()
+	{
+		PROFILE_FUNCTION();
+		MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+		s_Data.CircleColliderVertexBufferBase = new ColliderVertex[s_Data.MaxVertices];
+		s_Data.CircleColliderVertexBufferPtr = s_Data.CircleColliderVertexBufferBase;
+
+		SubmitGPU([]()
+		{
+			MemoryTagScope memoryTag(MemoryTag::Renderer);
+
+			s_Data.CircleColliderVertexArray = VertexArray::Create();
+			s_Data.CircleColliderVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(ColliderVertex));
+			s_Data.CircleColliderVertexBuffer->SetLayout({
+				{ ShaderDataType::Float3, "a_Position" },
+				{ ShaderDataType::Float4, "a_Color" },
+				{ ShaderDataType::Int,    "a_EntityID" }
+				});
+			s_Data.CircleColliderVertexArray->AddVertexBuffer(s_Data.CircleColliderVertexBuffer);
+			s_Data.CircleColliderVertexArray->SetIndexBuffer(s_Data.QuadIndexBuffer);
+			s_Data.CircleColliderShader = CreateRef<Shader>(s_Data.CircleColliderShaderSource);
+		});
+	}
+
+	// Frees the CPU-side staging arrays; batches never used were never allocated
 	void Renderer2D::Shutdown()
 	{
 		delete[] s_Data.QuadVertexBufferBase;
+		delete[] s_Data.CircleVertexBufferBase;
+		delete[] s_Data.BoxColliderVertexBufferBase;
+		delete[] s_Data.CircleColliderVertexBufferBase;
+
+		s_Data.QuadVertexBufferBase = nullptr;
+		s_Data.CircleVertexBufferBase = nullptr;
+		s_Data.BoxColliderVertexBufferBase = nullptr;
+		s_Data.CircleColliderVertexBufferBase = nullptr;
+	}
+
+	RendererBackend Renderer2D::GetBackend()
+	{
+		return s_Data.Backend;
 	}
 
 	// Clears color and depth buffer
 	void Renderer2D::Clear()
 	{
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		SubmitGPU([]() { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); });
 	}
 
 	// Sets the clear color used on each frame
 	void Renderer2D::SetClearColor(const glm::vec4& color)
 	{
-		glClearColor(color.r, color.g, color.b, color.a);
+		SubmitGPU([color]() { glClearColor(color.r, color.g, color.b, color.a); });
 	}
 
 	// Begins rendering a scene from a given camera
 	void Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform)
 	{
 		s_Data.CameraBuffer.ViewProjection = camera.GetProjection() * glm::inverse(transform);
-		s_Data.CameraUniformBuffer->SetData(&s_Data.CameraBuffer, sizeof(Renderer2DData::CameraData));
+		UploadCamera();
 		StartBatch();
 	}
 
@@ -135,13 +227,24 @@ namespace DemoEngine
 	void Renderer2D::BeginScene(const EditorCamera& camera)
 	{
 		s_Data.CameraBuffer.ViewProjection = camera.GetViewProjection();
-		s_Data.CameraUniformBuffer->SetData(&s_Data.CameraBuffer, sizeof(Renderer2DData::CameraData));
+		UploadCamera();
 		StartBatch();
 	}
 
+	// The render thread reads its own copy, as the next BeginScene may overwrite CameraBuffer first
+	void Renderer2D::UploadCamera()
+	{
+		SubmitGPU([camera = s_Data.CameraBuffer]()
+		{
+			s_Data.CameraUniformBuffer->SetData(&camera, sizeof(Renderer2DData::CameraData));
+		});
+	}
+
 	// Ends scene rendering and flushes draw calls
 	void Renderer2D::EndScene()
 	{
+		PROFILE_FUNCTION();
+
 		Flush();
 		RenderColliderDebug(); // Optional debug rendering
 	}
@@ -165,23 +268,34 @@ namespace DemoEngine
 	// Submits current batch to GPU
 	void Renderer2D::Flush()
 	{
+		PROFILE_FUNCTION();
+
+		// Vertex data is copied into the command stream so the staging arrays can be refilled at once
 		if (s_Data.QuadIndexCount)
 		{
 			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
-			s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
-			s_Data.QuadShader->Bind();
-			s_Data.QuadVertexArray->Bind();
-			glDrawElements(GL_TRIANGLES, s_Data.QuadIndexCount, GL_UNSIGNED_INT, nullptr);
+			const void* data = CopyGPU(s_Data.QuadVertexBufferBase, dataSize);
+			SubmitGPU([data, dataSize, indexCount = s_Data.QuadIndexCount]()
+			{
+				s_Data.QuadVertexBuffer->SetData(data, dataSize);
+				s_Data.QuadShader->Bind();
+				s_Data.QuadVertexArray->Bind();
+				glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+			});
 			s_Data.Stats.DrawCalls++;
 		}
 
 		if (s_Data.CircleIndexCount)
 		{
 			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.CircleVertexBufferPtr - (uint8_t*)s_Data.CircleVertexBufferBase);
-			s_Data.CircleVertexBuffer->SetData(s_Data.CircleVertexBufferBase, dataSize);
-			s_Data.CircleShader->Bind();
-			s_Data.CircleVertexArray->Bind();
-			glDrawElements(GL_TRIANGLES, s_Data.CircleIndexCount, GL_UNSIGNED_INT, nullptr);
+			const void* data = CopyGPU(s_Data.CircleVertexBufferBase, dataSize);
+			SubmitGPU([data, dataSize, indexCount = s_Data.CircleIndexCount]()
+			{
+				s_Data.CircleVertexBuffer->SetData(data, dataSize);
+				s_Data.CircleShader->Bind();
+				s_Data.CircleVertexArray->Bind();
+				glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+			});
 			s_Data.Stats.DrawCalls++;
 		}
 	}
@@ -192,36 +306,45 @@ namespace DemoEngine
 		if (s_Data.BoxColliderIndexCount == 0 && s_Data.CircleColliderIndexCount == 0)
 			return;
 
-		glDisable(GL_DEPTH_TEST);
-		glLineWidth(3.0f);
+		uint32_t boxCount = s_Data.BoxColliderIndexCount;
+		uint32_t boxSize = (uint32_t)((uint8_t*)s_Data.BoxColliderVertexBufferPtr - (uint8_t*)s_Data.BoxColliderVertexBufferBase);
+		const void* boxData = CopyGPU(s_Data.BoxColliderVertexBufferBase, boxSize);
 
-		if (s_Data.BoxColliderIndexCount)
-		{
-			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.BoxColliderVertexBufferPtr - (uint8_t*)s_Data.BoxColliderVertexBufferBase);
-			s_Data.BoxColliderVertexBuffer->SetData(s_Data.BoxColliderVertexBufferBase, dataSize);
-			s_Data.CircleColliderShader->Bind();
-			s_Data.BoxColliderShader->SetMat4("u_ViewProjection", s_Data.CameraBuffer.ViewProjection);
-			s_Data.BoxColliderVertexArray->Bind();
-
-			for (uint32_t i = 0; i < s_Data.BoxColliderIndexCount; i += 4)
-				glDrawArrays(GL_LINE_LOOP, i, 4);
-		}
+		uint32_t circleCount = s_Data.CircleColliderIndexCount;
+		uint32_t circleSize = (uint32_t)((uint8_t*)s_Data.CircleColliderVertexBufferPtr - (uint8_t*)s_Data.CircleColliderVertexBufferBase);
+		const void* circleData = CopyGPU(s_Data.CircleColliderVertexBufferBase, circleSize);
 
-		if (s_Data.CircleColliderIndexCount)
+		SubmitGPU([=, viewProjection = s_Data.CameraBuffer.ViewProjection]()
 		{
-			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.CircleColliderVertexBufferPtr - (uint8_t*)s_Data.CircleColliderVertexBufferBase);
-			s_Data.CircleColliderVertexBuffer->SetData(s_Data.CircleColliderVertexBufferBase, dataSize);
-			s_Data.CircleColliderShader->Bind();
-			s_Data.CircleColliderShader->SetMat4("u_ViewProjection", s_Data.CameraBuffer.ViewProjection);
-			s_Data.CircleColliderVertexArray->Bind();
-
-			constexpr int circleSegments = 32;
-			for (uint32_t i = 0; i < s_Data.CircleColliderIndexCount; i += circleSegments)
-				glDrawArrays(GL_LINE_LOOP, i, circleSegments);
-		}
-
-		glLineWidth(1.0f);
-		glEnable(GL_DEPTH_TEST);
+			glDisable(GL_DEPTH_TEST);
+			glLineWidth(3.0f);
+
+			if (boxCount)
+			{
+				s_Data.BoxColliderVertexBuffer->SetData(boxData, boxSize);
+				s_Data.BoxColliderShader->Bind();
+				s_Data.BoxColliderShader->SetMat4("u_ViewProjection", viewProjection);
+				s_Data.BoxColliderVertexArray->Bind();
+
+				for (uint32_t i = 0; i < boxCount; i += 4)
+					glDrawArrays(GL_LINE_LOOP, i, 4);
+			}
+
+			if (circleCount)
+			{
+				s_Data.CircleColliderVertexBuffer->SetData(circleData, circleSize);
+				s_Data.CircleColliderShader->Bind();
+				s_Data.CircleColliderShader->SetMat4("u_ViewProjection", viewProjection);
+				s_Data.CircleColliderVertexArray->Bind();
+
+				constexpr int circleSegments = 32;
+				for (uint32_t i = 0; i < circleCount; i += circleSegments)
+					glDrawArrays(GL_LINE_LOOP, i, circleSegments);
+			}
+
+			glLineWidth(1.0f);
+			glEnable(GL_DEPTH_TEST);
+		});
 	}
 
 	// Flushes and resets the current batch
@@ -287,6 +410,9 @@ namespace DemoEngine
 	// Draws a filled circle
 	void Renderer2D::DrawCircle(const glm::mat4& transform, const glm::vec4 color, float thickness, float fade, int entityID)
 	{
+		if (!s_Data.CircleVertexBufferBase)
+			InitCircleBatch();
+
 		if (s_Data.CircleIndexCount >= Renderer2DData::MaxIndices)
 			NextBatch();
 
@@ -307,6 +433,9 @@ namespace DemoEngine
 	// Draws box collider wireframe
 	void Renderer2D::DrawBoxCollider(const glm::mat4& transform, const glm::vec4& color, int entityID)
 	{
+		if (!s_Data.BoxColliderVertexBufferBase)
+			InitBoxColliderBatch();
+
 		if (s_Data.BoxColliderIndexCount >= Renderer2DData::MaxIndices)
 			NextBatch();
 
@@ -331,6 +460,9 @@ namespace DemoEngine
 	// Draws a circle collider wireframe
 	void Renderer2D::DrawCircleCollider(const glm::mat4& transform, const glm::vec4& color, int entityID)
 	{
+		if (!s_Data.CircleColliderVertexBufferBase)
+			InitCircleColliderBatch();
+
 		if (s_Data.CircleColliderIndexCount >= Renderer2DData::MaxIndices)
 			NextBatch();
 
@@ -7,12 +7,17 @@
 
 namespace DemoEngine
 {
+	// Null builds batches and statistics as usual but never touches the GPU (benchmarks, headless runs)
+	enum class RendererBackend { OpenGL = 0, Null = 1 };
+
 	class Renderer2D
 	{
 	public:
-		static void Init();
+		static void Init(RendererBackend backend = RendererBackend::OpenGL);
 		static void Shutdown();
 
+		static RendererBackend GetBackend();
+
 		static void Clear();
 		static void SetClearColor(const glm::vec4& color);
 		static void BeginScene(const EditorCamera& camera);
@@ -55,5 +60,10 @@ namespace DemoEngine
 	private:
 		static void StartBatch(); static void NextBatch();
 		static void RenderColliderDebug();
+		static void UploadCamera();
+
+		static void InitCircleBatch();
+		static void InitBoxColliderBatch();
+		static void InitCircleColliderBatch();
 	};
 }
@@ -39,6 +39,12 @@ namespace DemoEngine
 		QuadVertex* QuadVertexBufferPtr = nullptr;
 
 		glm::vec4 QuadVertexPositions[4];
+		Ref<IndexBuffer> QuadIndexBuffer; // Shared by every batch
+
+		// Loaded by Init, compiled when the matching batch is first used
+		ShaderSource CircleShaderSource;
+		ShaderSource BoxColliderShaderSource;
+		ShaderSource CircleColliderShaderSource;
 
 
 		//Circles
@@ -50,6 +56,7 @@ namespace DemoEngine
 		CircleVertex* CircleVertexBufferPtr = nullptr;
 
 		Renderer2D::Statistics Stats;
+		RendererBackend Backend = RendererBackend::OpenGL;
 
 		struct CameraData
 		{
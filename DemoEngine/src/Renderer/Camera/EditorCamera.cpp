@@ -39,6 +39,28 @@ namespace DemoEngine
 	}
 
 
+	void EditorCamera::GetRay(const glm::vec2& viewportPosition, glm::vec3& origin, glm::vec3& direction) const
+	{
+		glm::vec2 ndc = viewportPosition / glm::vec2(m_ViewportWidth, m_ViewportHeight) * 2.0f - 1.0f;
+		glm::mat4 inverseViewProjection = glm::inverse(GetViewProjection());
+
+		glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+		glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+		origin = glm::vec3(nearPoint) / nearPoint.w;
+		direction = glm::normalize(glm::vec3(farPoint) / farPoint.w - origin);
+	}
+
+	bool EditorCamera::WorldToViewport(const glm::vec3& point, glm::vec2& viewportPosition) const
+	{
+		glm::vec4 clip = GetViewProjection() * glm::vec4(point, 1.0f);
+		if (clip.w <= 0.0f)
+			return false;
+
+		glm::vec2 ndc = glm::vec2(clip) / clip.w;
+		viewportPosition = (ndc * 0.5f + 0.5f) * glm::vec2(m_ViewportWidth, m_ViewportHeight);
+		return true;
+	}
+
 	void EditorCamera::OnEvent(Event& e)
 	{
 		EventDispatcher dispatcher(e);
@@ -30,6 +30,11 @@ namespace DemoEngine
 		const glm::vec3& GetPosition() const { return m_Position; }
 		glm::quat GetOrientation() const;
 
+		// Ray through a viewport position given in pixels from the bottom-left corner
+		void GetRay(const glm::vec2& viewportPosition, glm::vec3& origin, glm::vec3& direction) const;
+		// Viewport position (pixels from the bottom-left) of a world point; false if behind the camera
+		bool WorldToViewport(const glm::vec3& point, glm::vec2& viewportPosition) const;
+
 		float GetPitch() const { return m_Pitch; }
 		float GetYaw() const { return m_Yaw; }
 		void OnResize(float width, float height);
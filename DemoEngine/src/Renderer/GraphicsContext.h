@@ -7,5 +7,9 @@ namespace DemoEngine
 	public:
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
+
+		// Binds or unbinds the context on the calling thread, see RenderThread
+		virtual void MakeCurrent() = 0;
+		virtual void ReleaseCurrent() = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "DemoEngine_PCH.h"
+#include "RenderCommandQueue.h"
+
+namespace DemoEngine
+{
+	RenderCommandQueue::RenderCommandQueue(size_t capacity)
+		: m_Arena(capacity)
+	{
+	}
+
+	void RenderCommandQueue::Push(CommandFn function, void* storage)
+	{
+		Command* command = m_Arena.Allocate<Command>(1);
+		command->Function = function;
+		command->Storage = storage;
+		command->Next = nullptr;
+
+		if (m_Tail)
+			m_Tail->Next = command;
+		else
+			m_Head = command;
+		m_Tail = command;
+		m_CommandCount++;
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		for (Command* command = m_Head; command; command = command->Next)
+			command->Function(command->Storage);
+
+		m_Head = nullptr;
+		m_Tail = nullptr;
+		m_CommandCount = 0;
+		m_Arena.Reset();
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Core/FrameAllocator.h"
+#include <new>
+#include <utility>
+
+namespace DemoEngine
+{
+	// Records type-erased commands into a linear arena and runs them in submission
+	// order. Commands and any data they reference live until Execute finishes;
+	// commands still pending when the queue is destroyed are dropped without running.
+	class RenderCommandQueue
+	{
+	public:
+		explicit RenderCommandQueue(size_t capacity = 1024 * 1024);
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename FuncT>
+		void Submit(FuncT&& func)
+		{
+			using Functor = std::decay_t<FuncT>;
+
+			// Invokes and destroys the functor in place; nothing else frees it
+			auto execute = [](void* storage)
+			{
+				Functor* functor = static_cast<Functor*>(storage);
+				(*functor)();
+				functor->~Functor();
+			};
+
+			void* storage = m_Arena.Allocate(sizeof(Functor), alignof(Functor));
+			new (storage) Functor(std::forward<FuncT>(func));
+			Push(execute, storage);
+		}
+
+		// Raw memory that stays valid until the queue has executed
+		void* Allocate(size_t size) { return m_Arena.Allocate(size); }
+
+		// Runs every command, then rewinds the arena for the next frame
+		void Execute();
+
+		uint32_t GetCommandCount() const { return m_CommandCount; }
+		size_t GetUsedBytes() const { return m_Arena.GetUsed(); }
+
+	private:
+		using CommandFn = void(*)(void*);
+
+		struct Command
+		{
+			CommandFn Function;
+			void* Storage;
+			Command* Next;
+		};
+
+		void Push(CommandFn function, void* storage);
+
+	private:
+		LinearArena m_Arena;
+		Command* m_Head = nullptr;
+		Command* m_Tail = nullptr;
+		uint32_t m_CommandCount = 0;
+	};
+}
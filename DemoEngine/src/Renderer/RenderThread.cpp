@@ -0,0 +1,168 @@
+#include "DemoEngine_PCH.h"
+#include "RenderThread.h"
+#include "Renderer/GraphicsContext.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace DemoEngine
+{
+	struct RenderThreadData
+	{
+		bool Enabled = false;
+		bool Threaded = false;
+		GraphicsContext* Context = nullptr;
+
+		std::thread Thread;
+		std::mutex Mutex;
+		std::condition_variable Changed;
+
+		// The main thread records into Queues[SubmitIndex]; the render thread executes the other
+		RenderCommandQueue Queues[2];
+		uint32_t SubmitIndex = 0;
+		bool FramePending = false;
+		bool Stopping = false;
+
+		RenderThreadStats Stats;
+	};
+
+	static RenderThreadData s_Data;
+	static thread_local bool t_IsRenderThread = false;
+
+	static void RenderLoop()
+	{
+		t_IsRenderThread = true;
+		Profiler::SetThreadName("Render");
+		s_Data.Context->MakeCurrent();
+
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		while (true)
+		{
+			s_Data.Changed.wait(lock, [] { return s_Data.FramePending || s_Data.Stopping; });
+			if (!s_Data.FramePending)
+				break;
+
+			RenderCommandQueue& queue = s_Data.Queues[s_Data.SubmitIndex ^ 1];
+			uint32_t commandCount = queue.GetCommandCount();
+			lock.unlock();
+
+			auto start = std::chrono::steady_clock::now();
+			{
+				PROFILE_SCOPE("RenderThread::Execute");
+				queue.Execute();
+			}
+			float renderTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			lock.lock();
+			s_Data.Stats.RenderTime = renderTime;
+			s_Data.Stats.CommandCount = commandCount;
+			s_Data.FramePending = false;
+			s_Data.Changed.notify_all();
+		}
+
+		s_Data.Context->ReleaseCurrent();
+	}
+
+	void RenderThread::SetEnabled(bool enabled)
+	{
+		CORE_ASSERT(!s_Data.Threaded, "RenderThread must be configured before Init");
+		s_Data.Enabled = enabled;
+	}
+
+	void RenderThread::Init(GraphicsContext& context)
+	{
+		if (!s_Data.Enabled)
+			return;
+
+		s_Data.Context = &context;
+		s_Data.Stopping = false;
+		s_Data.FramePending = false;
+
+		// A context can only be current on one thread at a time
+		context.ReleaseCurrent();
+		s_Data.Thread = std::thread(RenderLoop);
+		s_Data.Threaded = true;
+
+		LOG_INFO("Rendering on a dedicated thread");
+	}
+
+	void RenderThread::Shutdown()
+	{
+		if (!s_Data.Threaded)
+			return;
+
+		WaitIdle();
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			s_Data.Stopping = true;
+		}
+		s_Data.Changed.notify_all();
+		s_Data.Thread.join();
+
+		s_Data.Threaded = false;
+		s_Data.Context->MakeCurrent();
+	}
+
+	bool RenderThread::IsThreaded()
+	{
+		return s_Data.Threaded;
+	}
+
+	bool RenderThread::IsRenderThread()
+	{
+		return t_IsRenderThread;
+	}
+
+	const void* RenderThread::Copy(const void* data, size_t size)
+	{
+		if (!IsThreaded() || IsRenderThread())
+			return data;
+
+		void* copy = GetSubmitQueue().Allocate(size);
+		memcpy(copy, data, size);
+		return copy;
+	}
+
+	void RenderThread::EndFrame()
+	{
+		if (!s_Data.Threaded)
+			return;
+
+		PROFILE_FUNCTION();
+
+		auto start = std::chrono::steady_clock::now();
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		s_Data.Changed.wait(lock, [] { return !s_Data.FramePending; });
+		s_Data.Stats.WaitTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		s_Data.SubmitIndex ^= 1;
+		s_Data.FramePending = true;
+		s_Data.Changed.notify_all();
+	}
+
+	void RenderThread::WaitIdle()
+	{
+		if (!s_Data.Threaded || IsRenderThread())
+			return;
+
+		PROFILE_FUNCTION();
+
+		EndFrame();
+
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		s_Data.Changed.wait(lock, [] { return !s_Data.FramePending; });
+	}
+
+	RenderThreadStats RenderThread::GetStats()
+	{
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		return s_Data.Stats;
+	}
+
+	RenderCommandQueue& RenderThread::GetSubmitQueue()
+	{
+		return s_Data.Queues[s_Data.SubmitIndex];
+	}
+}
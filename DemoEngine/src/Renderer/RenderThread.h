@@ -0,0 +1,61 @@
+#pragma once
+#include "Renderer/RenderCommandQueue.h"
+
+namespace DemoEngine
+{
+	class GraphicsContext;
+
+	struct RenderThreadStats
+	{
+		float RenderTime = 0.0f; // ms the render thread spent executing the last frame
+		float WaitTime = 0.0f; // ms the main thread blocked on the render thread last frame
+		uint32_t CommandCount = 0;
+	};
+
+	// Optional render thread that owns the graphics context. The main thread records
+	// frame N + 1 into one queue while the render thread executes frame N from the
+	// other, so simulation and GPU submission overlap.
+	//
+	// Anything touching the graphics API goes through Submit. Without the thread, or
+	// when called from the render thread itself, Submit runs the command immediately,
+	// so the same code serves both modes.
+	class RenderThread
+	{
+	public:
+		// Opt in before Init, e.g. from the command line
+		static void SetEnabled(bool enabled);
+
+		// Takes the context over from the calling thread if enabled
+		static void Init(GraphicsContext& context);
+		// Drains outstanding work and hands the context back to the calling thread
+		static void Shutdown();
+
+		static bool IsThreaded();
+		static bool IsRenderThread();
+
+		template<typename FuncT>
+		static void Submit(FuncT&& func)
+		{
+			if (!IsThreaded() || IsRenderThread())
+			{
+				func();
+				return;
+			}
+			GetSubmitQueue().Submit(std::forward<FuncT>(func));
+		}
+
+		// Copies data for a command to read later; returns the source when commands run inline
+		static const void* Copy(const void* data, size_t size);
+
+		// Hands the recorded frame to the render thread, waiting for the previous one first
+		static void EndFrame();
+		// Executes everything submitted so far and waits for it. A sync point: use for
+		// rare operations whose results the main thread needs straight away.
+		static void WaitIdle();
+
+		static RenderThreadStats GetStats();
+
+	private:
+		static RenderCommandQueue& GetSubmitQueue();
+	};
+}
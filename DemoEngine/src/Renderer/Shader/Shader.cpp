@@ -20,16 +20,26 @@ namespace DemoEngine
     }
 
     Shader::Shader(const std::string& filepath)
+        : Shader(LoadSource(filepath))
     {
-        // Load the file and read it as a string
-        std::string source = Shader::ReadFile(filepath);
+    }
+
+    Shader::Shader(const ShaderSource& source)
+        : m_Name(source.Name)
+    {
+        Compile(source.Stages);
+    }
 
-        auto shaderSources = Shader::PreProcess(source);
+    ShaderSource Shader::LoadSource(const std::string& filepath)
+    {
+        PROFILE_FUNCTION();
 
-        Compile(shaderSources);
+        ShaderSource source;
+        source.Stages = PreProcess(ReadFile(filepath));
 
         const std::filesystem::path pathname = filepath;
-        m_Name = pathname.stem().string();
+        source.Name = pathname.stem().string();
+        return source;
     }
 
     Shader::Shader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
@@ -79,7 +89,7 @@ namespace DemoEngine
             CORE_ASSERT(eol != std::string::npos, "Syntax Error");
             size_t begin = pos + typeTokenLength + 1;
             std::string type = source.substr(begin, eol - begin);
-            std::cout << "Parsed Shader Type: " << type << std::endl;
+            LOG_TRACE("Parsed shader type: {0}", type);
             CORE_ASSERT(ShaderTypeFromString(type), "Invalid Shader Type Specified");
 
             size_t nextLinePos = source.find_first_not_of("\r\n", eol);
@@ -93,6 +103,8 @@ namespace DemoEngine
 
     void Shader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
     {
+        PROFILE_FUNCTION();
+
         GLuint program = glCreateProgram();
         CORE_ASSERT(shaderSources.size() <= 2, "Shader Array is not sufficiently sized for the number of shaders provided");
         std::array<GLenum, 2> glShaderIDs;
@@ -197,50 +209,50 @@ namespace DemoEngine
         glUseProgram(0);
     }
 
-    void Shader::SetInt(const std::string& name, int value)
+    void Shader::SetInt(const char* name, int value)
     {
         UploadUniformInt(name, value);
     }
 
-    void Shader::SetIntArray(const std::string& name, int* values, uint32_t count)
+    void Shader::SetIntArray(const char* name, int* values, uint32_t count)
     {
         UploadUniformIntArray(name, values, count);
     }
 
-    void Shader::SetMat4(const std::string& name, const glm::mat4& value)
+    void Shader::SetMat4(const char* name, const glm::mat4& value)
     {
         UploadUniformMat4(name, value);
     }
 
-    void Shader::SetFloat4(const std::string& name, const glm::vec4& value)
+    void Shader::SetFloat4(const char* name, const glm::vec4& value)
     {
         UploadUniformFloat4(name, value);
     }
 
-    void Shader::SetFloat3(const std::string& name, const glm::vec3& value)
+    void Shader::SetFloat3(const char* name, const glm::vec3& value)
     {
         UploadUniformFloat3(name, value);
     }
 
-    void Shader::SetFloat2(const std::string& name, const glm::vec2& value)
+    void Shader::SetFloat2(const char* name, const glm::vec2& value)
     {
         UploadUniformFloat2(name, value);
     }
 
-    void Shader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix)
+    void Shader::UploadUniformMat3(const char* name, const glm::mat3& matrix)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniformMatrix3fv(u_location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
-    void Shader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix)
+    void Shader::UploadUniformMat4(const char* name, const glm::mat4& matrix)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         // u_location = Specifies the location of the uniform variable to be modified.
         // size = how many matrices provided
@@ -251,56 +263,56 @@ namespace DemoEngine
         glUniformMatrix4fv(u_location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
-    void Shader::UploadUniformInt(const std::string& name, const int value)
+    void Shader::UploadUniformInt(const char* name, const int value)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniform1i(u_location, value);
     }
 
-    void Shader::UploadUniformIntArray(const std::string& name, const int* values, const uint32_t count)
+    void Shader::UploadUniformIntArray(const char* name, const int* values, const uint32_t count)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniform1iv(u_location, count, values);
     }
 
-    void Shader::UploadUniformFloat(const std::string& name, float value)
+    void Shader::UploadUniformFloat(const char* name, float value)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniform1f(u_location, value);
     }
 
-    void Shader::UploadUniformFloat2(const std::string& name, const glm::vec2& values)
+    void Shader::UploadUniformFloat2(const char* name, const glm::vec2& values)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniform2f(u_location, values.x, values.y);
     }
 
-    void Shader::UploadUniformFloat3(const std::string& name, const glm::vec3& values)
+    void Shader::UploadUniformFloat3(const char* name, const glm::vec3& values)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniform3f(u_location, values.x, values.y, values.z);
     }
 
-    void Shader::UploadUniformFloat4(const std::string& name, const glm::vec4& values)
+    void Shader::UploadUniformFloat4(const char* name, const glm::vec4& values)
     {
         // glGetUniformLocation returns an integer that represents the location
         // of a specific uniform variable within a program object
-        GLint u_location = glGetUniformLocation(m_RendererID, name.c_str());
+        GLint u_location = glGetUniformLocation(m_RendererID, name);
 
         glUniform4f(u_location, values.x, values.y, values.z, values.w);
     }
@@ -9,39 +9,50 @@ typedef unsigned int GLenum;
 
 namespace DemoEngine
 {
+	// Shader stages read and split from a .glsl file, ready to compile. Loading
+	// needs no graphics context, so sources can be read on worker threads.
+	struct ShaderSource
+	{
+		std::string Name;
+		std::unordered_map<GLenum, std::string> Stages;
+	};
+
 	class Shader
 	{
 	public:
 		Shader(const std::string& filepath);
+		Shader(const ShaderSource& source);
 		Shader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
 		~Shader();
 
 		void Bind() const;
 		void Unbind() const;
 
-		void SetInt(const std::string& name, int value);
-		void SetIntArray(const std::string& name, int* values, uint32_t count);
-		void SetMat4(const std::string& name, const glm::mat4& value);
-		void SetFloat4(const std::string& name, const glm::vec4& value);
-		void SetFloat3(const std::string& name, const glm::vec3& value);
-		void SetFloat2(const std::string& name, const glm::vec2& value);
+		void SetInt(const char* name, int value);
+		void SetIntArray(const char* name, int* values, uint32_t count);
+		void SetMat4(const char* name, const glm::mat4& value);
+		void SetFloat4(const char* name, const glm::vec4& value);
+		void SetFloat3(const char* name, const glm::vec3& value);
+		void SetFloat2(const char* name, const glm::vec2& value);
 
 		inline const std::string& GetName() { return m_Name; };
 
-		void UploadUniformInt(const std::string& name, const int value);
-		void UploadUniformIntArray(const std::string& name, const int* values, const uint32_t count);
+		void UploadUniformInt(const char* name, const int value);
+		void UploadUniformIntArray(const char* name, const int* values, const uint32_t count);
 		
-		void UploadUniformFloat(const std::string& name, float value);
-		void UploadUniformFloat2(const std::string& name, const glm::vec2& values);
-		void UploadUniformFloat3(const std::string& name, const glm::vec3& values);
-		void UploadUniformFloat4(const std::string& name, const glm::vec4& values);
+		void UploadUniformFloat(const char* name, float value);
+		void UploadUniformFloat2(const char* name, const glm::vec2& values);
+		void UploadUniformFloat3(const char* name, const glm::vec3& values);
+		void UploadUniformFloat4(const char* name, const glm::vec4& values);
+
+		void UploadUniformMat3(const char* name, const glm::mat3& matrix);
+		void UploadUniformMat4(const char* name, const glm::mat4& matrix);
 
-		void UploadUniformMat3(const std::string& name, const glm::mat3& matrix);
-		void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
+		static ShaderSource LoadSource(const std::string& filepath);
 
 	private:
-		std::string ReadFile(const std::string& filepath);
-		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
+		static std::string ReadFile(const std::string& filepath);
+		static std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
 		void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
 
 	private:
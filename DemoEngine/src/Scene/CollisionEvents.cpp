@@ -0,0 +1,191 @@
+#include "DemoEngine_PCH.h"
+#include "CollisionEvents.h"
+#include "Scene.h"
+#include "Components.h"
+
+namespace DemoEngine
+{
+	// Shapes carry their owning entity as user data (set in Scene::OnRuntimeStart).
+	// End events can reference shapes destroyed during the step, so validate first.
+	static bool ResolveEntity(b2ShapeId shapeId, entt::entity& outEntity)
+	{
+		if (!b2Shape_IsValid(shapeId))
+			return false;
+
+		outEntity = (entt::entity)(uintptr_t)b2Shape_GetUserData(shapeId);
+		return true;
+	}
+
+	void CollisionEventQueue::Buffers::Clear()
+	{
+		Begin.clear();
+		End.clear();
+		Hit.clear();
+		SensorBegin.clear();
+		SensorEnd.clear();
+	}
+
+	CollisionEventBatch CollisionEventQueue::Buffers::AsBatch() const
+	{
+		CollisionEventBatch batch;
+		batch.Begin = { Begin.data(), Begin.size() };
+		batch.End = { End.data(), End.size() };
+		batch.Hit = { Hit.data(), Hit.size() };
+		batch.SensorBegin = { SensorBegin.data(), SensorBegin.size() };
+		batch.SensorEnd = { SensorEnd.data(), SensorEnd.size() };
+		return batch;
+	}
+
+	void CollisionEventQueue::Gather(b2WorldId world)
+	{
+		PROFILE_FUNCTION();
+
+		m_Buffers.Clear();
+
+		entt::entity a, b;
+
+		b2ContactEvents contactEvents = b2World_GetContactEvents(world);
+		for (int i = 0; i < contactEvents.beginCount; i++)
+		{
+			const b2ContactBeginTouchEvent& e = contactEvents.beginEvents[i];
+			if (ResolveEntity(e.shapeIdA, a) && ResolveEntity(e.shapeIdB, b))
+				m_Buffers.Begin.push_back({ a, b, { e.manifold.normal.x, e.manifold.normal.y }, e.manifold.pointCount });
+		}
+
+		for (int i = 0; i < contactEvents.endCount; i++)
+		{
+			const b2ContactEndTouchEvent& e = contactEvents.endEvents[i];
+			if (ResolveEntity(e.shapeIdA, a) && ResolveEntity(e.shapeIdB, b))
+				m_Buffers.End.push_back({ a, b });
+		}
+
+		for (int i = 0; i < contactEvents.hitCount; i++)
+		{
+			const b2ContactHitEvent& e = contactEvents.hitEvents[i];
+			if (ResolveEntity(e.shapeIdA, a) && ResolveEntity(e.shapeIdB, b))
+				m_Buffers.Hit.push_back({ a, b, { e.point.x, e.point.y }, { e.normal.x, e.normal.y }, e.approachSpeed });
+		}
+
+		b2SensorEvents sensorEvents = b2World_GetSensorEvents(world);
+		for (int i = 0; i < sensorEvents.beginCount; i++)
+		{
+			const b2SensorBeginTouchEvent& e = sensorEvents.beginEvents[i];
+			if (ResolveEntity(e.sensorShapeId, a) && ResolveEntity(e.visitorShapeId, b))
+				m_Buffers.SensorBegin.push_back({ a, b });
+		}
+
+		for (int i = 0; i < sensorEvents.endCount; i++)
+		{
+			const b2SensorEndTouchEvent& e = sensorEvents.endEvents[i];
+			if (ResolveEntity(e.sensorShapeId, a) && ResolveEntity(e.visitorShapeId, b))
+				m_Buffers.SensorEnd.push_back({ a, b });
+		}
+
+		m_Events = m_Buffers.AsBatch();
+	}
+
+	void CollisionEventQueue::Filter(const ScenePool& pool)
+	{
+		m_Filtered.Clear();
+
+		// Contact events are flipped so the subscribed entity is always A
+		for (const auto& e : m_Buffers.Begin)
+		{
+			if (pool.contains(e.EntityA))
+				m_Filtered.Begin.push_back(e);
+			else if (pool.contains(e.EntityB))
+				m_Filtered.Begin.push_back({ e.EntityB, e.EntityA, -e.Normal, e.PointCount });
+		}
+
+		for (const auto& e : m_Buffers.End)
+		{
+			if (pool.contains(e.EntityA))
+				m_Filtered.End.push_back(e);
+			else if (pool.contains(e.EntityB))
+				m_Filtered.End.push_back({ e.EntityB, e.EntityA });
+		}
+
+		for (const auto& e : m_Buffers.Hit)
+		{
+			if (pool.contains(e.EntityA))
+				m_Filtered.Hit.push_back(e);
+			else if (pool.contains(e.EntityB))
+				m_Filtered.Hit.push_back({ e.EntityB, e.EntityA, e.Point, -e.Normal, e.ApproachSpeed });
+		}
+
+		for (const auto& e : m_Buffers.SensorBegin)
+		{
+			if (pool.contains(e.Sensor) || pool.contains(e.Visitor))
+				m_Filtered.SensorBegin.push_back(e);
+		}
+
+		for (const auto& e : m_Buffers.SensorEnd)
+		{
+			if (pool.contains(e.Sensor) || pool.contains(e.Visitor))
+				m_Filtered.SensorEnd.push_back(e);
+		}
+	}
+
+	void CollisionEventQueue::Dispatch(Scene& scene)
+	{
+		PROFILE_FUNCTION();
+
+		if (m_LoggingEnabled)
+			LogEvents(scene);
+
+		if (m_Events.Empty())
+			return;
+
+		for (auto& subscriber : m_Subscribers)
+		{
+			if (subscriber.All)
+			{
+				subscriber.Callback(scene, m_Events);
+				continue;
+			}
+
+			// No pool means no entity has the component yet
+			const ScenePool* pool = scene.m_Registry.storage(subscriber.ComponentType);
+			if (!pool || pool->empty())
+				continue;
+
+			Filter(*pool);
+
+			CollisionEventBatch batch = m_Filtered.AsBatch();
+			if (!batch.Empty())
+				subscriber.Callback(scene, batch);
+		}
+	}
+
+	void CollisionEventQueue::Clear()
+	{
+		m_Buffers.Clear();
+		m_Filtered.Clear();
+		m_Events = {};
+	}
+
+	// Every event is logged: a per call site throttle would drop distinct pairs, and this is opt-in
+	void CollisionEventQueue::LogEvents(Scene& scene) const
+	{
+		auto tagOf = [&scene](entt::entity entity) -> const char*
+		{
+			auto* tag = scene.m_Registry.valid(entity) ? scene.m_Registry.try_get<TagComponent>(entity) : nullptr;
+			return tag ? tag->Tag.c_str() : "<destroyed>";
+		};
+
+		for (const auto& e : m_Buffers.Begin)
+			LOG_INFO("[COLLISION] '{}' began touching '{}'", tagOf(e.EntityA), tagOf(e.EntityB));
+
+		for (const auto& e : m_Buffers.End)
+			LOG_INFO("[COLLISION] '{}' stopped touching '{}'", tagOf(e.EntityA), tagOf(e.EntityB));
+
+		for (const auto& e : m_Buffers.Hit)
+			LOG_INFO("[COLLISION] '{}' hit '{}' at {:.2f} m/s", tagOf(e.EntityA), tagOf(e.EntityB), e.ApproachSpeed);
+
+		for (const auto& e : m_Buffers.SensorBegin)
+			LOG_INFO("[SENSOR] '{}' entered '{}'", tagOf(e.Visitor), tagOf(e.Sensor));
+
+		for (const auto& e : m_Buffers.SensorEnd)
+			LOG_INFO("[SENSOR] '{}' left '{}'", tagOf(e.Visitor), tagOf(e.Sensor));
+	}
+}
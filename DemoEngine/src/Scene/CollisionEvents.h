@@ -0,0 +1,125 @@
+#pragma once
+#include "entt.hpp"
+#include "SceneRegistry.h"
+#include <box2d/box2d.h>
+#include <glm/glm.hpp>
+
+namespace DemoEngine
+{
+	class Scene;
+
+	// Non-owning view over a contiguous run of events
+	template<typename T>
+	struct EventSpan
+	{
+		const T* Data = nullptr;
+		size_t Count = 0;
+
+		const T* begin() const { return Data; }
+		const T* end() const { return Data + Count; }
+		size_t size() const { return Count; }
+		bool empty() const { return Count == 0; }
+		const T& operator[](size_t index) const { return Data[index]; }
+	};
+
+	struct CollisionBeginEvent
+	{
+		entt::entity EntityA;
+		entt::entity EntityB;
+		glm::vec2 Normal; // Points from A to B
+		int PointCount;
+	};
+
+	struct CollisionEndEvent
+	{
+		entt::entity EntityA;
+		entt::entity EntityB;
+	};
+
+	struct CollisionHitEvent
+	{
+		entt::entity EntityA;
+		entt::entity EntityB;
+		glm::vec2 Point;
+		glm::vec2 Normal; // Points from A to B
+		float ApproachSpeed;
+	};
+
+	struct SensorEvent
+	{
+		entt::entity Sensor;
+		entt::entity Visitor;
+	};
+
+	// One step's worth of events, grouped by kind
+	struct CollisionEventBatch
+	{
+		EventSpan<CollisionBeginEvent> Begin;
+		EventSpan<CollisionEndEvent> End;
+		EventSpan<CollisionHitEvent> Hit;
+		EventSpan<SensorEvent> SensorBegin;
+		EventSpan<SensorEvent> SensorEnd;
+
+		bool Empty() const { return Begin.empty() && End.empty() && Hit.empty() && SensorBegin.empty() && SensorEnd.empty(); }
+	};
+
+	// Collects Box2D contact and sensor events into flat arrays after each step and
+	// hands them to subscribers in one batch. A subscriber registered for component T
+	// only sees events where at least one entity has T, and for contact events that
+	// entity is always EntityA.
+	class CollisionEventQueue
+	{
+	public:
+		using Handler = std::function<void(Scene&, const CollisionEventBatch&)>;
+
+		template<typename T>
+		void Subscribe(Handler handler)
+		{
+			m_Subscribers.push_back({ entt::type_hash<T>::value(), std::move(handler) });
+		}
+
+		// Subscribe to every event regardless of components
+		void SubscribeAll(Handler handler) { m_Subscribers.push_back({ 0, std::move(handler), true }); }
+
+		void Gather(b2WorldId world);
+		void Dispatch(Scene& scene);
+		void Clear();
+
+		const CollisionEventBatch& GetEvents() const { return m_Events; }
+
+		// Debug channel: logs begin/end events with entity tags
+		void SetLoggingEnabled(bool enabled) { m_LoggingEnabled = enabled; }
+		bool IsLoggingEnabled() const { return m_LoggingEnabled; }
+
+	private:
+		struct Buffers
+		{
+			std::vector<CollisionBeginEvent> Begin;
+			std::vector<CollisionEndEvent> End;
+			std::vector<CollisionHitEvent> Hit;
+			std::vector<SensorEvent> SensorBegin;
+			std::vector<SensorEvent> SensorEnd;
+
+			void Clear();
+			CollisionEventBatch AsBatch() const;
+		};
+
+		struct Subscriber
+		{
+			entt::id_type ComponentType;
+			Handler Callback;
+			bool All = false;
+		};
+
+		void Filter(const ScenePool& pool);
+		void LogEvents(Scene& scene) const;
+
+	private:
+		Buffers m_Buffers;
+		Buffers m_Filtered;
+		CollisionEventBatch m_Events;
+
+		std::vector<Subscriber> m_Subscribers;
+		bool m_LoggingEnabled = false;
+	};
+}
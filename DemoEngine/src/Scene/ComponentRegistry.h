@@ -0,0 +1,129 @@
+#pragma once
+#include "Components.h"
+#include <tuple>
+
+namespace DemoEngine
+{
+	enum ComponentFlags : uint32_t
+	{
+		ComponentFlags_None = 0,
+		ComponentFlags_Serialised = 1 << 0, // Written to scene files under ComponentTraits<T>::Name
+		ComponentFlags_Addable = 1 << 1, // Offered in the inspector's "Add Component" menu
+		ComponentFlags_Inspected = 1 << 2 // Drawn by InspectorPanel::DrawComponents
+	};
+
+	constexpr uint32_t ComponentFlags_Default = ComponentFlags_Serialised | ComponentFlags_Addable | ComponentFlags_Inspected;
+
+	// A plain-data member the scene serialisers and the inspector handle without a hand-written
+	// overload. Name is its key in scene files; Min == Max leaves the inspector's drag unbounded.
+	template<typename T, typename Member>
+	struct ComponentField
+	{
+		using Type = Member;
+
+		const char* Name;
+		const char* Label;
+		Member T::* Pointer;
+		float Speed, Min, Max;
+	};
+
+	// Used inside COMPONENT_LIST entries, where Self is the component being registered
+	#define COMPONENT_DRAG_FIELD(member, label, speed, min, max) ComponentField<Self, decltype(Self::member)>{ #member, label, &Self::member, speed, min, max }
+	#define COMPONENT_FIELD(member, label) COMPONENT_DRAG_FIELD(member, label, 0.1f, 0.0f, 0.0f)
+
+	// Every component that is copied into play mode, duplicated, serialised and inspected, one
+	// entry each: type, display name, flags, then its fields. The serialisers and the inspector
+	// are generated from the fields; a component whose state they can't describe (Camera,
+	// Rigidbody 2D) has hand-written overloads instead, which win over the generated ones.
+	// The order is the inspector's and the Add Component menu's.
+	#define COMPONENT_LIST(X) \
+		X(IDComponent, "ID", ComponentFlags_None) \
+		X(NetworkIDComponent, "Network ID", ComponentFlags_None) \
+		X(TagComponent, "Tag", ComponentFlags_Serialised, COMPONENT_FIELD(Tag, "Tag")) \
+		X(TransformComponent, "Transform", ComponentFlags_Serialised | ComponentFlags_Inspected, \
+			COMPONENT_FIELD(Translation, "Translation"), COMPONENT_FIELD(Rotation, "Rotation"), COMPONENT_FIELD(Scale, "Scale")) \
+		X(CameraComponent, "Camera", ComponentFlags_Default) \
+		X(SpriteRendererComponent, "Sprite Renderer", ComponentFlags_Default, COMPONENT_FIELD(Colour, "Colour")) \
+		X(CircleRendererComponent, "Circle Renderer", ComponentFlags_Default, COMPONENT_FIELD(Colour, "Colour"), \
+			COMPONENT_DRAG_FIELD(Thickness, "Thickness", 0.01f, 0.0f, 1.0f), COMPONENT_DRAG_FIELD(Fade, "Fade", 0.00025f, 0.0f, 1.0f)) \
+		X(Rigidbody2DComponent, "Rigidbody 2D", ComponentFlags_Default) \
+		X(BoxCollider2DComponent, "Box Collider 2D", ComponentFlags_Default, \
+			COMPONENT_FIELD(Offset, "Offset"), COMPONENT_FIELD(HalfSize, "Half Size"), \
+			COMPONENT_DRAG_FIELD(Density, "Density", 0.05f, 0.0f, 10.0f), COMPONENT_DRAG_FIELD(Friction, "Friction", 0.05f, 0.0f, 1.0f), \
+			COMPONENT_DRAG_FIELD(Restitution, "Restitution", 0.05f, 0.0f, 1.0f), COMPONENT_FIELD(IsSensor, "Is Sensor")) \
+		X(CircleCollider2DComponent, "Circle Collider 2D", ComponentFlags_Default, \
+			COMPONENT_FIELD(Offset, "Offset"), COMPONENT_DRAG_FIELD(Radius, "Radius", 0.05f, 0.0f, 10.0f), \
+			COMPONENT_DRAG_FIELD(Density, "Density", 0.05f, 0.0f, 10.0f), COMPONENT_DRAG_FIELD(Friction, "Friction", 0.05f, 0.0f, 1.0f), \
+			COMPONENT_DRAG_FIELD(Restitution, "Restitution", 0.05f, 0.0f, 1.0f), COMPONENT_FIELD(IsSensor, "Is Sensor")) \
+		X(AudioComponent, "Audio Component", ComponentFlags_Default, \
+			COMPONENT_FIELD(FilePath, "Audio File"), COMPONENT_FIELD(Loop, "Loop"), COMPONENT_FIELD(PlayOnStart, "Play On Start"), \
+			COMPONENT_FIELD(PlayOnCollision, "Play On Collision")) \
+		X(PlayerControllerComponent, "Player Controller", ComponentFlags_Default, COMPONENT_DRAG_FIELD(MoveForce, "Move Force", 0.1f, 0.0f, 1000.0f))
+
+	// Per-component metadata. Unregistered (runtime-only) components get these defaults.
+	// TriviallyRelocatable components can be copied as raw bytes (see Scene::CopyComponentStorage).
+	template<typename T>
+	struct ComponentTraits
+	{
+		static constexpr const char* Name = nullptr;
+		static constexpr const char* DisplayName = nullptr;
+		static constexpr uint32_t Flags = ComponentFlags_None;
+		static constexpr bool TriviallyRelocatable = std::is_trivially_copyable_v<T>;
+		static constexpr auto Fields = std::make_tuple();
+	};
+
+	#define REGISTER_COMPONENT(type, displayName, flags, ...) \
+		template<> struct ComponentTraits<type> \
+		{ \
+			using Self = type; \
+			static constexpr const char* Name = #type; \
+			static constexpr const char* DisplayName = displayName; \
+			static constexpr uint32_t Flags = (flags); \
+			static constexpr bool TriviallyRelocatable = std::is_trivially_copyable_v<type>; \
+			static constexpr auto Fields = std::make_tuple(__VA_ARGS__); \
+		};
+
+	COMPONENT_LIST(REGISTER_COMPONENT)
+
+	template<typename T>
+	constexpr bool HasComponentFlag(uint32_t flag) { return (ComponentTraits<T>::Flags & flag) != 0; }
+
+	template<typename T>
+	constexpr bool HasComponentFields() { return std::tuple_size_v<std::remove_const_t<decltype(ComponentTraits<T>::Fields)>> != 0; }
+
+	// Calls func(field) for every ComponentField of T, in registration order
+	template<typename T, typename Func>
+	void ForEachField(Func&& func)
+	{
+		std::apply([&](const auto&... field) { (func(field), ...); }, ComponentTraits<T>::Fields);
+	}
+
+	// Compile-time list of component types
+	template<typename... Component>
+	struct ComponentGroup
+	{
+		static constexpr size_t Count = sizeof...(Component);
+	};
+
+	template<typename... A, typename... B>
+	constexpr ComponentGroup<A..., B...> operator+(ComponentGroup<A...>, ComponentGroup<B...>) { return {}; }
+
+	// Passed to ForEachComponent callbacks; use typename decltype(arg)::Type
+	template<typename T>
+	struct ComponentType
+	{
+		using Type = T;
+	};
+
+	// Calls func(ComponentType<T>{}) for every T in the group, in order
+	template<typename... Component, typename Func>
+	void ForEachComponent(ComponentGroup<Component...>, Func&& func)
+	{
+		(func(ComponentType<Component>{}), ...);
+	}
+
+	#define COMPONENT_GROUP_ENTRY(type, ...) + ComponentGroup<type>{}
+
+	// Every component in COMPONENT_LIST, in order
+	using AllComponents = decltype(ComponentGroup<>{} COMPONENT_LIST(COMPONENT_GROUP_ENTRY));
+}
@@ -9,7 +9,7 @@
 #include "SceneCamera.h"
 #include <box2d/box2d.h>
 #include <soloud.h>
-#include <soloud_wav.h>
+#include "Audio/AudioClip.h"
 
 namespace DemoEngine
 {
@@ -23,6 +23,16 @@ namespace DemoEngine
 		IDComponent(const IDComponent&) = default;
 	};
 
+	// Runtime-only component linking an entity to its server-side network ID
+	struct NetworkIDComponent
+	{
+		int NetworkID = 0;
+
+		NetworkIDComponent() = default;
+		NetworkIDComponent(const NetworkIDComponent&) = default;
+		NetworkIDComponent(int networkID) : NetworkID(networkID) {}
+	};
+
 	// Component used to label entities with a name or tag
 	struct TagComponent
 	{
@@ -83,13 +93,13 @@ namespace DemoEngine
 	// Component to render circles with various visual properties
 	struct CircleRendererComponent
 	{
-		glm::vec4 Color{ 1.0f, 1.0f, 1.0f, 1.0f };
+		glm::vec4 Colour{ 1.0f, 1.0f, 1.0f, 1.0f };
 		float Radius = 0.5f;
 		float Thickness = 1.0f;
 		float Fade = 0.005f;
 		CircleRendererComponent() = default;
 		CircleRendererComponent(const CircleRendererComponent&) = default;
-		CircleRendererComponent(const glm::vec4& color) : Color(color) {}
+		CircleRendererComponent(const glm::vec4& colour) : Colour(colour) {}
 	};
 
 	// Defines 2D body types for physics simulation
@@ -124,6 +134,7 @@ namespace DemoEngine
 		float Density = 1.0f;
 		float Friction = 0.5f;
 		float Restitution = 0.0f; // Bounciness
+		bool IsSensor = false; // Reports overlaps instead of colliding
 
 		b2ShapeDef ShapeDef;
 
@@ -140,6 +151,7 @@ namespace DemoEngine
 		float Density = 1.0f;
 		float Friction = 0.5f;
 		float Restitution = 0.0f;
+		bool IsSensor = false;
 
 		b2ShapeDef ShapeDef;
 
@@ -151,13 +163,13 @@ namespace DemoEngine
 	struct AudioComponent
 	{
 		std::string FilePath;
-		SoLoud::Wav Sound;
+		Ref<AudioClip> Clip = CreateRef<AudioClip>(); // Shared on copy
 		bool Loop = false;
 		bool PlayOnStart = true;
+		bool PlayOnCollision = false; // Restarts its voice whenever the entity starts touching something
 
 		// Runtime fields
 		int Handle = 0;
-		bool IsLoaded = false;
 
 		AudioComponent() = default;
 		AudioComponent(const AudioComponent&) = default;
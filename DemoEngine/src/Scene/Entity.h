@@ -20,7 +20,7 @@ namespace DemoEngine
 
 			// Create and add the component to the registry
 			T& component = m_Scene->m_Registry.emplace<T>(m_EntityHandle, std::forward<Args>(args)...);
-			m_Scene->OnComponentAdded<T>(*this, component); // Call OnComponentAdded for potential custom logic
+			m_Scene->OnComponentAdded(*this, component); // Statically dispatched, see Scene::OnComponentAdded
 			return component;
 		}
 
@@ -54,6 +54,14 @@ namespace DemoEngine
 			return m_Scene->m_Registry.all_of<T>(m_EntityHandle);
 		}
 
+		// Edits component T through func and notifies the registry's on_update listeners
+		template<typename T, typename Func>
+		T& PatchComponent(Func&& func)
+		{
+			CORE_ASSERT(HasComponent<T>(), "Entity does not have the component");
+			return m_Scene->m_Registry.patch<T>(m_EntityHandle, std::forward<Func>(func));
+		}
+
 		// Removes a component of type T from this entity
 		template<typename T>
 		void RemoveComponent()
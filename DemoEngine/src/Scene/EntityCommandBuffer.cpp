@@ -0,0 +1,79 @@
+#include "DemoEngine_PCH.h"
+#include "EntityCommandBuffer.h"
+
+namespace DemoEngine
+{
+	EntityCommandBuffer::~EntityCommandBuffer()
+	{
+		Reset();
+	}
+
+	DeferredEntity EntityCommandBuffer::CreateEntity(const std::string& name)
+	{
+		// Names live in the arena as C strings
+		char* nameData = (char*)Allocate(name.size() + 1, alignof(char));
+		memcpy(nameData, name.c_str(), name.size() + 1);
+
+		DeferredEntity entity = { m_CreateCount++ };
+		Record(CommandType::Create, Subject{ entt::null, entity.Index }, nullptr, nameData);
+		return entity;
+	}
+
+	void EntityCommandBuffer::DestroyEntity(entt::entity entity)
+	{
+		Record(CommandType::Destroy, Subject{ entity, UINT32_MAX }, nullptr, nullptr);
+	}
+
+	void EntityCommandBuffer::Record(CommandType type, Subject target, const ComponentOps* ops, void* data)
+	{
+		m_Commands.push_back({ type, target, ops, data });
+	}
+
+	void* EntityCommandBuffer::Allocate(size_t size, size_t alignment)
+	{
+		while (m_BlockIndex < m_Blocks.size())
+		{
+			Block& block = m_Blocks[m_BlockIndex];
+			uintptr_t base = (uintptr_t)block.Memory.get();
+			uintptr_t aligned = (base + m_BlockOffset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+			if (aligned + size <= base + block.Size)
+			{
+				m_BlockOffset = aligned + size - base;
+				return (void*)aligned;
+			}
+
+			m_BlockIndex++;
+			m_BlockOffset = 0;
+		}
+
+		// Out of blocks; oversized payloads get a block of their own
+		size_t blockSize = std::max(s_BlockSize, size + alignment);
+		m_Blocks.push_back({ std::make_unique<uint8_t[]>(blockSize), blockSize });
+		m_BlockIndex = m_Blocks.size() - 1;
+		m_BlockOffset = 0;
+		return Allocate(size, alignment);
+	}
+
+	entt::entity EntityCommandBuffer::Resolve(const Subject& target) const
+	{
+		if (target.Deferred == UINT32_MAX)
+			return target.Entity;
+
+		return target.Deferred < m_Created.size() ? m_Created[target.Deferred] : entt::null;
+	}
+
+	void EntityCommandBuffer::Reset()
+	{
+		for (auto& command : m_Commands)
+		{
+			if (command.Type == CommandType::Add && command.Data)
+				command.Ops->Destroy(command.Data);
+		}
+
+		m_Commands.clear();
+		m_Created.clear();
+		m_CreateCount = 0;
+		m_BlockIndex = 0;
+		m_BlockOffset = 0;
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "entt.hpp"
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace DemoEngine
+{
+	class Scene;
+
+	// Handle to an entity created through a command buffer. It only becomes a real
+	// entity when the buffer is played back, but later commands can already target it.
+	struct DeferredEntity
+	{
+		uint32_t Index = UINT32_MAX;
+	};
+
+	// Records structural changes (create, destroy, add/remove component) instead of
+	// applying them, so systems can run while the registry is being iterated or from
+	// worker threads. Each thread records into its own buffer (Scene::GetCommandBuffer)
+	// and Scene::PlaybackCommandBuffers applies all of them at the next sync point.
+	class EntityCommandBuffer
+	{
+	public:
+		EntityCommandBuffer() = default;
+		~EntityCommandBuffer();
+
+		EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+		EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+		DeferredEntity CreateEntity(const std::string& name = std::string());
+		void DestroyEntity(entt::entity entity);
+
+		template<typename T>
+		void AddComponent(entt::entity entity, T component) { RecordAdd(Subject{ entity, UINT32_MAX }, std::move(component)); }
+		template<typename T>
+		void AddComponent(DeferredEntity entity, T component) { RecordAdd(Subject{ entt::null, entity.Index }, std::move(component)); }
+
+		template<typename T>
+		void RemoveComponent(entt::entity entity) { Record(CommandType::Remove, Subject{ entity, UINT32_MAX }, &ComponentOps::Get<T>(), nullptr); }
+
+		bool Empty() const { return m_Commands.empty(); }
+		size_t GetCommandCount() const { return m_Commands.size(); }
+
+		// Type-erased operations for a component payload stored in the arena.
+		// Get<T>() is defined in Scene.h, where Scene is complete.
+		struct ComponentOps
+		{
+			void (*Emplace)(Scene& scene, entt::entity entity, void* data);
+			void (*Remove)(Scene& scene, entt::entity entity);
+			void (*Destroy)(void* data);
+
+			template<typename T>
+			static const ComponentOps& Get();
+		};
+
+	private:
+		enum class CommandType : uint8_t
+		{
+			Create, Add, Remove, Destroy
+		};
+
+		struct Subject
+		{
+			entt::entity Entity;
+			uint32_t Deferred; // Index into m_Created, UINT32_MAX for a live entity
+		};
+
+		struct Command
+		{
+			CommandType Type;
+			Subject Target;
+			const ComponentOps* Ops;
+			void* Data; // Component payload, or the entity name (C string) for Create
+		};
+
+		// Creates run first and destroys last; adds and removes keep their recording order
+		static uint8_t GetPhase(CommandType type) { return type == CommandType::Create ? 0 : type == CommandType::Destroy ? 2 : 1; }
+
+		template<typename T>
+		void RecordAdd(Subject target, T&& component)
+		{
+			using Component = std::decay_t<T>;
+			void* data = Allocate(sizeof(Component), alignof(Component));
+			new (data) Component(std::forward<T>(component));
+			Record(CommandType::Add, target, &ComponentOps::Get<Component>(), data);
+		}
+
+		void Record(CommandType type, Subject target, const ComponentOps* ops, void* data);
+		void* Allocate(size_t size, size_t alignment);
+		entt::entity Resolve(const Subject& target) const;
+
+		// Destroys payloads that were never played back and rewinds the arena
+		void Reset();
+
+	private:
+		// Bump-allocated blocks, kept across frames so steady-state recording does not allocate
+		static constexpr size_t s_BlockSize = 64 * 1024;
+		struct Block
+		{
+			std::unique_ptr<uint8_t[]> Memory;
+			size_t Size;
+		};
+		std::vector<Block> m_Blocks;
+		size_t m_BlockIndex = 0;
+		size_t m_BlockOffset = 0;
+
+		std::vector<Command> m_Commands;
+		std::vector<entt::entity> m_Created;
+		uint32_t m_CreateCount = 0;
+
+		friend class Scene;
+	};
+}
@@ -0,0 +1,128 @@
+#include "DemoEngine_PCH.h"
+#include "EntityIndex.h"
+
+namespace DemoEngine
+{
+	static constexpr size_t s_MinCapacity = 16;
+
+	// splitmix64 finaliser: UUIDs are already random, but network IDs are small
+	// sequential integers and would cluster without mixing
+	uint64_t EntityIndex::Hash(uint64_t key)
+	{
+		key ^= key >> 30;
+		key *= 0xbf58476d1ce4e5b9ull;
+		key ^= key >> 27;
+		key *= 0x94d049bb133111ebull;
+		key ^= key >> 31;
+		return key;
+	}
+
+	void EntityIndex::Insert(uint64_t key, entt::entity entity)
+	{
+		CORE_ASSERT(entity != entt::null, "Cannot index a null entity");
+
+		// Keep the load factor at or below 3/4
+		if ((m_Count + 1) * 4 > m_Slots.size() * 3)
+			Rehash(std::max(s_MinCapacity, m_Slots.size() * 2));
+
+		size_t index = HomeSlot(key);
+		while (m_Slots[index].Entity != entt::null)
+		{
+			if (m_Slots[index].Key == key)
+			{
+				m_Slots[index].Entity = entity;
+				return;
+			}
+			index = (index + 1) & m_Mask;
+		}
+
+		m_Slots[index] = { key, entity };
+		m_Count++;
+	}
+
+	bool EntityIndex::Erase(uint64_t key)
+	{
+		if (m_Count == 0)
+			return false;
+
+		size_t index = HomeSlot(key);
+		while (m_Slots[index].Key != key || m_Slots[index].Entity == entt::null)
+		{
+			if (m_Slots[index].Entity == entt::null)
+				return false;
+			index = (index + 1) & m_Mask;
+		}
+
+		// Shift following entries of the same probe run back into the hole
+		size_t hole = index;
+		size_t next = (hole + 1) & m_Mask;
+		while (m_Slots[next].Entity != entt::null)
+		{
+			size_t home = HomeSlot(m_Slots[next].Key);
+			bool canMove = hole <= next ? (home <= hole || home > next) : (home <= hole && home > next);
+			if (canMove)
+			{
+				m_Slots[hole] = m_Slots[next];
+				hole = next;
+			}
+			next = (next + 1) & m_Mask;
+		}
+
+		m_Slots[hole] = Slot();
+		m_Count--;
+		return true;
+	}
+
+	entt::entity EntityIndex::Find(uint64_t key) const
+	{
+		if (m_Count == 0)
+			return entt::null;
+
+		size_t index = HomeSlot(key);
+		while (m_Slots[index].Entity != entt::null)
+		{
+			if (m_Slots[index].Key == key)
+				return m_Slots[index].Entity;
+			index = (index + 1) & m_Mask;
+		}
+		return entt::null;
+	}
+
+	void EntityIndex::Reserve(size_t count)
+	{
+		size_t capacity = s_MinCapacity;
+		while (capacity * 3 < count * 4)
+			capacity *= 2;
+
+		if (capacity > m_Slots.size())
+			Rehash(capacity);
+	}
+
+	void EntityIndex::Clear()
+	{
+		std::fill(m_Slots.begin(), m_Slots.end(), Slot());
+		m_Count = 0;
+	}
+
+	void EntityIndex::Rehash(size_t capacity)
+	{
+		std::vector<Slot> oldSlots = std::move(m_Slots);
+
+		m_Slots.assign(capacity, Slot());
+		m_Mask = capacity - 1;
+		m_Count = 0;
+
+		for (const Slot& slot : oldSlots)
+		{
+			if (slot.Entity == entt::null)
+				continue;
+
+			size_t index = HomeSlot(slot.Key);
+			while (m_Slots[index].Entity != entt::null)
+				index = (index + 1) & m_Mask;
+
+			m_Slots[index] = slot;
+			m_Count++;
+		}
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "entt.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace DemoEngine
+{
+	// Open-addressing hash map from a 64-bit key (UUID, network ID) to an entity.
+	// Linear probing over a power-of-two table with backward-shift deletion,
+	// so lookups never walk over tombstones.
+	class EntityIndex
+	{
+	public:
+		EntityIndex() = default;
+
+		// Inserts or overwrites the entity for key
+		void Insert(uint64_t key, entt::entity entity);
+		bool Erase(uint64_t key);
+
+		// Returns entt::null if the key is not present
+		entt::entity Find(uint64_t key) const;
+		bool Contains(uint64_t key) const { return Find(key) != entt::null; }
+
+		void Reserve(size_t count);
+		void Clear();
+
+		size_t Size() const { return m_Count; }
+		bool Empty() const { return m_Count == 0; }
+
+	private:
+		struct Slot
+		{
+			uint64_t Key = 0;
+			entt::entity Entity = entt::null; // entt::null marks an empty slot
+		};
+
+		static uint64_t Hash(uint64_t key);
+		size_t HomeSlot(uint64_t key) const { return (size_t)Hash(key) & m_Mask; }
+		void Rehash(size_t capacity);
+
+	private:
+		std::vector<Slot> m_Slots;
+		size_t m_Mask = 0;
+		size_t m_Count = 0;
+	};
+}
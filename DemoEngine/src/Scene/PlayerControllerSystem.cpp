@@ -3,13 +3,30 @@
 #include "Scene/Scene.h"
 #include "Scene/Components.h"
 #include "Core/Input.h"
-#include <GLFW/glfw3.h>
 #include <box2d/box2d.h> 
 
 namespace DemoEngine {
 
 	void UpdatePlayerControllers(Scene& scene, float deltaTime)
 	{
+		static const InputAction moveUp = Input::GetAction("MoveUp");
+		static const InputAction moveDown = Input::GetAction("MoveDown");
+		static const InputAction moveLeft = Input::GetAction("MoveLeft");
+		static const InputAction moveRight = Input::GetAction("MoveRight");
+
+		// Same input for every controller, so resolve it once per frame
+		glm::vec2 inputDirection = {
+			Input::GetActionValue(moveRight) - Input::GetActionValue(moveLeft),
+			Input::GetActionValue(moveUp) - Input::GetActionValue(moveDown)
+		};
+
+		if (glm::length(inputDirection) == 0.0f)
+			return;
+
+		// Analog sticks keep partial magnitude; diagonals don't exceed full force
+		if (glm::length(inputDirection) > 1.0f)
+			inputDirection = glm::normalize(inputDirection);
+
 		auto view = scene.m_Registry.view<PlayerControllerComponent, Rigidbody2DComponent>();
 
 		for (auto entity : view)
@@ -20,27 +37,10 @@ namespace DemoEngine {
 			if (!b2Body_IsValid(rb.RuntimeBody))
 				continue;
 
-			glm::vec2 inputDirection = { 0.0f, 0.0f };
-
-			if (Input::IsKeyPressed(GLFW_KEY_W) || Input::IsKeyPressed(GLFW_KEY_UP))
-				inputDirection.y += 1.0f;
-			if (Input::IsKeyPressed(GLFW_KEY_S) || Input::IsKeyPressed(GLFW_KEY_DOWN))
-				inputDirection.y -= 1.0f;
-			if (Input::IsKeyPressed(GLFW_KEY_A) || Input::IsKeyPressed(GLFW_KEY_LEFT))
-				inputDirection.x -= 1.0f;
-			if (Input::IsKeyPressed(GLFW_KEY_D) || Input::IsKeyPressed(GLFW_KEY_RIGHT))
-				inputDirection.x += 1.0f;
-
-			if (glm::length(inputDirection) > 0.0f)
-			{
-				inputDirection = glm::normalize(inputDirection);
-				glm::vec2 force = inputDirection * controller.MoveForce;
-
+			glm::vec2 force = inputDirection * controller.MoveForce;
 
-				b2Vec2 b2Force = { force.x, force.y };
-				b2Body_ApplyForceToCenter(rb.RuntimeBody, b2Force, true);
-			}
-			
+			b2Vec2 b2Force = { force.x, force.y };
+			b2Body_ApplyForceToCenter(rb.RuntimeBody, b2Force, true);
 		}
 	}
 }
@@ -0,0 +1,120 @@
+#include "DemoEngine_PCH.h"
+#include "ReplayRunner.h"
+#include "Scene.h"
+#include "SceneSerialiser.h"
+#include "Core/InputRecording.h"
+#include "Core/ThreadPool.h"
+#include "Core/FrameAllocator.h"
+#include "Core/HeapTracker.h"
+#include <chrono>
+#include <fstream>
+
+namespace DemoEngine
+{
+	bool ParseReplayOptions(int argc, char** argv, ReplayOptions& options)
+	{
+		for (int i = 1; i + 1 < argc; i++)
+		{
+			std::string arg = argv[i];
+			if (arg == "--replay")
+				options.RecordingPath = argv[++i];
+			else if (arg == "--scene")
+				options.ScenePath = argv[++i];
+			else if (arg == "--csv")
+				options.CsvPath = argv[++i];
+			else if (arg == "--threads")
+				options.Threads = std::atoi(argv[++i]);
+			else if (arg == "--trace")
+				options.TracePath = argv[++i];
+		}
+
+		return !options.RecordingPath.empty();
+	}
+
+	int RunReplay(const ReplayOptions& options)
+	{
+		InputReplay replay;
+		if (!replay.Open(options.RecordingPath))
+			return 1;
+
+		// The embedded scene is exactly what was played; --scene replays the same input on another
+		bool embedded = options.ScenePath.empty();
+		std::string scenePath = embedded ? replay.GetScenePath() : options.ScenePath;
+		if (embedded && replay.GetScene().empty())
+		{
+			LOG_ERROR("Recording has no scene; pass one with --scene");
+			return 1;
+		}
+
+		ThreadPool::Init(options.Threads < 0 ? 0 : (uint32_t)options.Threads);
+		Input::Init();
+		Scene::InitPhysicsAllocator();
+
+		Ref<Scene> scene = CreateRef<Scene>();
+		SceneSerialiser serialiser(scene);
+		bool loaded = embedded ? serialiser.DeserialiseBinary(replay.GetScene().data(), replay.GetScene().size(), options.RecordingPath) : serialiser.Deserialise(scenePath);
+		if (!loaded)
+		{
+			LOG_ERROR("Could not load scene '{0}'", embedded ? options.RecordingPath : scenePath);
+			ThreadPool::Shutdown();
+			return 1;
+		}
+
+		scene->SetHeadless(true);
+		scene->SetNetworkReplay(&replay);
+		scene->OnRuntimeStart();
+
+		std::ofstream csv;
+		if (!options.CsvPath.empty())
+		{
+			csv.open(options.CsvPath, std::ios::trunc);
+			csv << "frame,dt_ms,update_ms,heap_allocs";
+			for (const System& system : scene->GetSystems().GetSystems())
+				csv << ',' << system.Name;
+			csv << '\n';
+		}
+
+		LOG_INFO("Replaying '{0}' on '{1}'", options.RecordingPath, scenePath);
+
+		if (!options.TracePath.empty())
+			Profiler::BeginSession("Replay");
+
+		double totalTime = 0.0, worstTime = 0.0;
+		while (replay.NextFrame())
+		{
+			FrameAllocator::BeginFrame();
+			Input::InjectSnapshot(replay.GetSnapshot());
+
+			uint64_t heapBefore = HeapTracker::GetTotalCounters().Allocations;
+			auto start = std::chrono::steady_clock::now();
+			scene->OnUpdateRuntime(replay.GetTimestep());
+			double frameTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			uint64_t heapAllocations = HeapTracker::GetTotalCounters().Allocations - heapBefore;
+
+			totalTime += frameTime;
+			worstTime = std::max(worstTime, frameTime);
+
+			if (csv.is_open())
+			{
+				csv << replay.GetFramesRead() - 1 << ',' << replay.GetTimestep().GetMilliseconds() << ',' << frameTime
+					<< ',' << heapAllocations;
+				for (const System& system : scene->GetSystems().GetSystems())
+					csv << ',' << system.Stats.LastTime;
+				csv << '\n';
+			}
+
+			Profiler::Collect();
+		}
+
+		if (!options.TracePath.empty())
+			Profiler::EndSession(options.TracePath);
+
+		scene->OnRuntimeStop();
+		ThreadPool::Shutdown();
+
+		uint32_t frames = replay.GetFramesRead();
+		LOG_INFO("Replayed {0} frames in {1:.2f} ms (avg {2:.3f} ms, worst {3:.3f} ms)",
+			frames, totalTime, frames ? totalTime / frames : 0.0, worstTime);
+		return 0;
+	}
+}
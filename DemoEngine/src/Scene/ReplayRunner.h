@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+
+namespace DemoEngine
+{
+	struct ReplayOptions
+	{
+		std::string RecordingPath;
+		std::string ScenePath; // Defaults to the scene stored in the recording
+		std::string CsvPath; // Per-frame timings; empty to skip
+		int Threads = -1; // Worker threads; -1 for the ThreadPool default
+		std::string TracePath; // Profiling trace of the whole replay; empty to skip
+	};
+
+	// Recognises: --replay <recording> [--scene <file>] [--csv <file>] [--threads <n>] [--trace <file>]
+	// Returns false if the command line does not ask for a replay.
+	bool ParseReplayOptions(int argc, char** argv, ReplayOptions& options);
+
+	// Runs the recording against its scene headless and as fast as possible.
+	// Returns the process exit code.
+	int RunReplay(const ReplayOptions& options);
+}
@@ -5,20 +5,47 @@
 #include "Renderer/2D/Renderer2D.h"
 #include "Networking/NetStructs.h"
 #include "PlayerControllerSystem.h"
+#include "Core/InputRecording.h"
+#include "Core/FrameAllocator.h"
+#include "Core/HeapTracker.h"
+#include "Audio/AudioEngine.h"
 
 namespace DemoEngine
 {
+	static std::atomic<uint64_t> s_NextSceneInstanceID = 1;
+
+	// Box2D and ENet allocate through the heap tracker so their memory shows up under their own tags
+	static void* PhysicsAlloc(unsigned int size, int alignment) { return HeapTracker::Allocate(size, (size_t)alignment, MemoryTag::Physics); }
+	static void PhysicsFree(void* memory) { HeapTracker::Free(memory); }
+	static void* ENET_CALLBACK NetworkAlloc(size_t size) { return HeapTracker::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, MemoryTag::Networking); }
+	static void ENET_CALLBACK NetworkFree(void* memory) { HeapTracker::Free(memory); }
+
+	void Scene::InitPhysicsAllocator()
+	{
+		b2SetAllocator(PhysicsAlloc, PhysicsFree);
+	}
+
 	Scene::Scene(const std::string& name, bool isEditorScene)
-		: m_Name(name), m_IsEditorScene(isEditorScene)
+		: m_Name(name), m_IsEditorScene(isEditorScene), m_InstanceID(s_NextSceneInstanceID++)
 	{
-		// Register handler for CameraComponent
-		RegisterComponentHandler<CameraComponent>([](Entity entity, CameraComponent& component) {
-			LOG_INFO("Camera component added");
-			if (auto* scenePtr = entity.GetScene())
-			{
-				component.camera.SetViewportSize(scenePtr->GetViewportWidth(), scenePtr->GetViewportHeight());
-			}
-			});
+		RegisterRuntimeSystems();
+
+		// However a rigidbody goes (entity destroyed, component removed, command buffer), its body goes with it
+		m_Registry.on_destroy<Rigidbody2DComponent>().connect<&Scene::OnRigidbodyDestroyed>(*this);
+
+		m_CollisionEvents.Subscribe<AudioComponent>([](Scene& scene, const CollisionEventBatch& events) { scene.PlayCollisionSounds(events); });
+	}
+
+	// New cameras start out matching the current viewport
+	void Scene::OnComponentAdded(Entity, CameraComponent& component)
+	{
+		component.camera.SetViewportSize(m_ViewportWidth, m_ViewportHeight);
+	}
+
+	// However a network ID arrives (AddComponent, command buffer, deserialisation), it becomes findable
+	void Scene::OnComponentAdded(Entity entity, NetworkIDComponent& component)
+	{
+		m_EntityByNetworkID.Insert((uint64_t)(uint32_t)component.NetworkID, entity);
 	}
 
 	Scene::~Scene() {
@@ -40,37 +67,32 @@ namespace DemoEngine
 		destination->m_ViewportWidth = source->m_ViewportWidth;
 		destination->m_SceneID = source->m_SceneID;
 
-		std::unordered_map<UUID, entt::entity> enttMap;
+		CORE_ASSERT(destination->m_EntityByUUID.Empty(), "Scene::CopyTo expects an empty destination scene");
 
 		auto& srcSceneRegistry = source->m_Registry;
 		auto& dstSceneRegistry = destination->m_Registry;
 
+		// Recreate entities with the same identifiers, so every pool can be copied
+		// wholesale in packed order and the UUID and network-ID indexes stay valid as-is
 		auto idView = srcSceneRegistry.view<IDComponent>();
-
-		// Recreate entities with same UUID and tag
 		for (auto e : idView)
 		{
-			UUID uuid = srcSceneRegistry.get<IDComponent>(e).ID;
-			const auto& tag = srcSceneRegistry.get<TagComponent>(e).Tag;
-			Entity en = destination->CreateEntityWithID(uuid, tag);
-
-			enttMap[uuid] = en.m_EntityHandle;
+			[[maybe_unused]] entt::entity created = dstSceneRegistry.create(e);
+			CORE_ASSERT(created == e, "Entity identifier mismatch while copying scene");
 		}
+		destination->m_EntityByUUID = source->m_EntityByUUID;
+		destination->m_EntityByNetworkID = source->m_EntityByNetworkID;
 
-		// Copy supported components
-		CopyComponent<TagComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<TransformComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<CameraComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<SpriteRendererComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<CircleRendererComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<Rigidbody2DComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<BoxCollider2DComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<CircleCollider2DComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<AudioComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
-		CopyComponent<PlayerControllerComponent>(dstSceneRegistry, srcSceneRegistry, enttMap);
+		// Copy supported component pools
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				CopyComponentStorage<T>(dstSceneRegistry, srcSceneRegistry);
+			});
 
 		destination->m_IsEditorScene = false;
 		destination->m_ShouldConnectToServer = source->m_ShouldConnectToServer;
+		destination->m_CollisionEvents.SetLoggingEnabled(source->m_CollisionEvents.IsLoggingEnabled());
 	}
 
 	Entity Scene::CreateEntity(const std::string& name)
@@ -87,9 +109,29 @@ namespace DemoEngine
 		auto& tag = entity.AddComponent<TagComponent>();
 		tag.Tag = name.empty() ? "Entity" : name;
 
+		m_EntityByUUID.Insert(uuid, entity);
 		return entity;
 	}
 
+	SpatialIndex& Scene::GetSpatialIndex()
+	{
+		if (!m_SpatialIndex)
+			m_SpatialIndex = CreateScope<SpatialIndex>(m_Registry);
+		return *m_SpatialIndex;
+	}
+
+	Entity Scene::GetEntityByUUID(UUID uuid)
+	{
+		entt::entity entity = m_EntityByUUID.Find(uuid);
+		return entity != entt::null ? Entity{ entity, this } : Entity{};
+	}
+
+	Entity Scene::GetEntityByNetworkID(int networkID)
+	{
+		entt::entity entity = m_EntityByNetworkID.Find((uint64_t)(uint32_t)networkID);
+		return entity != entt::null ? Entity{ entity, this } : Entity{};
+	}
+
 	Entity Scene::DuplicateEntity(Entity entity)
 	{
 		// Create new entity with same tag
@@ -103,28 +145,128 @@ namespace DemoEngine
 			newEntity = CreateEntity();
 		}
 
-		// Copy all existing components from the source entity
-		CopyComponentIfExists<TagComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<TransformComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<CameraComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<SpriteRendererComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<CircleRendererComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<Rigidbody2DComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<BoxCollider2DComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<CircleCollider2DComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<AudioComponent>(newEntity.m_EntityHandle, m_Registry, entity);
-		CopyComponentIfExists<PlayerControllerComponent>(newEntity.m_EntityHandle, m_Registry, entity);
+		// Copy all existing components from the source entity (the duplicate keeps its own UUID
+		// and, as a local entity, gets no network ID)
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (!std::is_same_v<T, IDComponent> && !std::is_same_v<T, NetworkIDComponent>)
+					CopyComponentIfExists<T>(newEntity.m_EntityHandle, m_Registry, entity);
+			});
 
 		return newEntity;
 	}
 
 	void Scene::DestroyEntity(Entity entity)
 	{
+		if (auto* id = m_Registry.try_get<IDComponent>(entity))
+			m_EntityByUUID.Erase(id->ID);
+
+		if (auto* networkID = m_Registry.try_get<NetworkIDComponent>(entity))
+			m_EntityByNetworkID.Erase((uint64_t)(uint32_t)networkID->NetworkID);
+
 		m_Registry.destroy(entity);
 	}
 
-	void Scene::OnUpdateEditor(Timestep ts, EditorCamera& camera)
+	EntityCommandBuffer& Scene::GetCommandBuffer()
+	{
+		// Most threads only ever record into one scene, so cache the last lookup
+		thread_local uint64_t t_CachedScene = 0;
+		thread_local EntityCommandBuffer* t_CachedBuffer = nullptr;
+		if (t_CachedScene == m_InstanceID)
+			return *t_CachedBuffer;
+
+		std::lock_guard<std::mutex> lock(m_CommandBufferMutex);
+
+		std::thread::id thread = std::this_thread::get_id();
+		auto it = std::find_if(m_CommandBuffers.begin(), m_CommandBuffers.end(),
+			[thread](const ThreadCommandBuffer& entry) { return entry.Thread == thread; });
+		if (it == m_CommandBuffers.end())
+			it = m_CommandBuffers.insert(m_CommandBuffers.end(), { thread, CreateScope<EntityCommandBuffer>() });
+
+		t_CachedScene = m_InstanceID;
+		t_CachedBuffer = it->Buffer.get();
+		return *t_CachedBuffer;
+	}
+
+	void Scene::PlaybackCommandBuffers()
 	{
+		PROFILE_FUNCTION();
+
+		std::lock_guard<std::mutex> lock(m_CommandBufferMutex);
+
+		size_t commandCount = 0;
+		for (auto& entry : m_CommandBuffers)
+			commandCount += entry.Buffer->m_Commands.size();
+
+		if (commandCount == 0)
+			return;
+
+		// Walking the buffers once per phase gives (phase, buffer, recording) order
+		// without building and sorting a list of every command
+		struct PendingCommand
+		{
+			EntityCommandBuffer* Buffer;
+			EntityCommandBuffer::Command* Command;
+		};
+		ScratchScope scratch;
+		ArenaVector<PendingCommand> pending(scratch.GetArena());
+		pending.reserve(commandCount);
+		for (uint8_t phase = 0; phase < 3; phase++)
+		{
+			for (auto& entry : m_CommandBuffers)
+			{
+				for (auto& command : entry.Buffer->m_Commands)
+				{
+					if (EntityCommandBuffer::GetPhase(command.Type) == phase)
+						pending.push_back({ entry.Buffer.get(), &command });
+				}
+			}
+		}
+
+		for (auto& entry : m_CommandBuffers)
+			entry.Buffer->m_Created.assign(entry.Buffer->m_CreateCount, entt::null);
+
+		for (const PendingCommand& item : pending)
+		{
+			EntityCommandBuffer::Command& command = *item.Command;
+			entt::entity entity = item.Buffer->Resolve(command.Target);
+
+			switch (command.Type)
+			{
+			case EntityCommandBuffer::CommandType::Create:
+				item.Buffer->m_Created[command.Target.Deferred] = CreateEntity((const char*)command.Data);
+				break;
+
+			case EntityCommandBuffer::CommandType::Add:
+				// Payloads for entities that died in the meantime are freed by Reset
+				if (m_Registry.valid(entity))
+				{
+					command.Ops->Emplace(*this, entity, command.Data);
+					command.Data = nullptr;
+				}
+				break;
+
+			case EntityCommandBuffer::CommandType::Remove:
+				if (m_Registry.valid(entity))
+					command.Ops->Remove(*this, entity);
+				break;
+
+			case EntityCommandBuffer::CommandType::Destroy:
+				if (m_Registry.valid(entity))
+					DestroyEntity(Entity{ entity, this });
+				break;
+			}
+		}
+
+		for (auto& entry : m_CommandBuffers)
+			entry.Buffer->Reset();
+	}
+
+	void Scene::OnUpdateEditor(Timestep, EditorCamera& camera)
+	{
+		PROFILE_FUNCTION();
+
 		Renderer2D::BeginScene(camera);
 
 		// Draw sprite renderers
@@ -143,7 +285,7 @@ namespace DemoEngine
 			for (auto entity : view)
 			{
 				auto [transform, circle] = view.get<TransformComponent, CircleRendererComponent>(entity);
-				Renderer2D::DrawCircle(transform.GetTransform(), circle.Color, circle.Thickness, circle.Fade, (int)entity);
+				Renderer2D::DrawCircle(transform.GetTransform(), circle.Colour, circle.Thickness, circle.Fade, (int)entity);
 			}
 		}
 
@@ -188,7 +330,10 @@ namespace DemoEngine
 	}
 
 	void Scene::ConectarENet() {
-		if (enet_initialize() != 0) {
+		ENetCallbacks callbacks = {};
+		callbacks.malloc = NetworkAlloc;
+		callbacks.free = NetworkFree;
+		if (enet_initialize_with_callbacks(ENET_VERSION, &callbacks) != 0) {
 			LOG_ERROR("Could not initialize ENet");
 			return;
 		}
@@ -205,23 +350,79 @@ namespace DemoEngine
 
 	Entity Scene::FindOrCreateNetworkEntity(int id)
 	{
-		std::string name = "Remote_" + std::to_string(id);
-		for (auto e : m_Registry.view<TagComponent>())
-		{
-			auto& tag = m_Registry.get<TagComponent>(e);
-			if (tag.Tag == name)
-				return Entity{ e, this };
-		}
+		if (Entity existing = GetEntityByNetworkID(id))
+			return existing;
+
+		char name[32];
+		snprintf(name, sizeof(name), "Remote_%d", id);
 		Entity newEntity = CreateEntity(name);
 		newEntity.AddComponent<SpriteRendererComponent>().Colour = glm::vec4(0, 1, 1, 1);
+		newEntity.AddComponent<NetworkIDComponent>(id);
 		return newEntity;
 	}
 
 	void Scene::OnUpdateRuntime(Timestep ts)
 	{
+		PROFILE_FUNCTION();
+		m_Systems.Run(*this, ts);
+	}
+
+	// Built-in runtime systems. Only the ENet service and rendering are tied to the main thread,
+	// so network replication runs on a worker alongside player input and the physics step.
+	// Collision events are the one exclusive system: handlers may do anything, and what they and
+	// every other system recorded into command buffers is played back there, once a frame.
+	void Scene::RegisterRuntimeSystems()
+	{
+		m_Systems.AddSystem("Network Receive", [](Scene& scene, Timestep) { scene.UpdateNetworking(); })
+			.Writes<NetworkResource>()
+			.MainThreadOnly(); // ENet host and the input recorder
+
+		m_Systems.AddSystem("Network Replication", [](Scene& scene, Timestep) { scene.ReplicateNetworkEntities(); })
+			.Reads<NetworkResource, NetworkIDComponent>()
+			.Writes<TransformComponent>();
+
+		m_Systems.AddSystem("Player Controllers", [](Scene& scene, Timestep ts) { UpdatePlayerControllers(scene, ts.GetSeconds()); })
+			.Reads<PlayerControllerComponent, Rigidbody2DComponent>()
+			.Writes<PhysicsWorldResource>();
+
+		m_Systems.AddSystem("Physics Step", [](Scene& scene, Timestep ts) { scene.StepPhysics(ts); })
+			.Writes<PhysicsWorldResource>();
+
+		m_Systems.AddSystem("Physics Sync", [](Scene& scene, Timestep) { scene.SyncPhysicsTransforms(); })
+			.Reads<PhysicsWorldResource>()
+			.Writes<TransformComponent>();
+
+		m_Systems.AddSystem("Collision Events", [](Scene& scene, Timestep)
+		{
+			scene.m_CollisionEvents.Gather(scene.m_PhysicsWorld);
+			scene.m_CollisionEvents.Dispatch(scene);
+			scene.PlaybackCommandBuffers();
+		}).Exclusive().MainThreadOnly();
+
+		// The owning sprite group is created in OnRuntimeStart, so drawing never reorders the Transform pool
+		m_Systems.AddSystem("Render", [](Scene& scene, Timestep) { scene.RenderRuntime(); })
+			.Reads<TransformComponent, CameraComponent, SpriteRendererComponent, CircleRendererComponent>()
+			.MainThreadOnly();
+	}
+
+	void Scene::UpdateNetworking()
+	{
+		m_NetworkUpdates.clear();
+
+		// Replays feed the recorded traffic instead of talking to the server
+		if (m_NetworkReplay)
+		{
+			for (const RecordedNetworkEvent& event : m_NetworkReplay->GetNetworkEvents())
+			{
+				if (event.EventType == RecordedNetworkEvent::Type::Receive)
+					OnNetworkPacket(event.Data.data(), event.Data.size());
+			}
+			return;
+		}
+
 		// Initialize connection if needed
 		if (m_ShouldConnectToServer && m_Client == nullptr) {
-			LOG_INFO("Connecting...");
+			LOG_INFO_THROTTLED(1.0f, "Connecting...");
 			ConectarENet();
 		}
 
@@ -234,10 +435,18 @@ namespace DemoEngine
 				{
 				case ENET_EVENT_TYPE_CONNECT:
 					LOG_INFO("Connected to server.");
+					InputRecorder::RecordNetworkEvent(RecordedNetworkEvent::Type::Connect);
 					break;
 
 				case ENET_EVENT_TYPE_DISCONNECT:
 					LOG_INFO("Disconnected from server.");
+					InputRecorder::RecordNetworkEvent(RecordedNetworkEvent::Type::Disconnect);
+					break;
+
+				case ENET_EVENT_TYPE_RECEIVE:
+					InputRecorder::RecordNetworkEvent(RecordedNetworkEvent::Type::Receive, netEvent.packet->data, netEvent.packet->dataLength);
+					OnNetworkPacket(netEvent.packet->data, netEvent.packet->dataLength);
+					enet_packet_destroy(netEvent.packet);
 					break;
 
 				default:
@@ -245,48 +454,94 @@ namespace DemoEngine
 				}
 			}
 		}
+	}
 
-		// Update systems
-		UpdatePlayerControllers(*this, ts.GetSeconds());
-
-		// Step physics simulation
-		int subStepCount = 4;
-		b2World_Step(m_PhysicsWorld, ts, subStepCount);
-
-		// Check collisions
-		b2ContactEvents contactEvents = b2World_GetContactEvents(m_PhysicsWorld);
-		for (int i = 0; i < contactEvents.beginCount; i++)
+	void Scene::OnNetworkPacket(const uint8_t* data, size_t size)
+	{
+		// Remote entity positions; applied to the registry by ReplicateNetworkEntities
+		if (size >= sizeof(PhysicsData) && *(const int*)data == PhysicsData().packetType)
 		{
-			const auto& beginEvent = contactEvents.beginEvents[i];
-
-			auto bodyA = b2Shape_GetBody(beginEvent.shapeIdA);
-			auto bodyB = b2Shape_GetBody(beginEvent.shapeIdB);
+			const PhysicsData* physicsData = (const PhysicsData*)data;
+			int count = std::min(physicsData->entityCount, (int)std::size(physicsData->entities));
+			for (int i = 0; i < count; i++)
+			{
+				const NetworkEntity& remote = physicsData->entities[i];
+				m_NetworkUpdates.push_back({ remote.id, { remote.position.x, remote.position.y } });
+			}
+		}
+	}
 
-			entt::entity entityA = (entt::entity)(uintptr_t)b2Body_GetUserData(bodyA);
-			entt::entity entityB = (entt::entity)(uintptr_t)b2Body_GetUserData(bodyB);
+	void Scene::ReplicateNetworkEntities()
+	{
+		PROFILE_FUNCTION();
 
-			if (m_Registry.valid(entityA) && m_Registry.valid(entityB))
+		// Known entities move in place; new ones are created at the next sync point, once per ID
+		ScratchScope scratch;
+		ArenaVector<std::pair<int, DeferredEntity>> created(scratch.GetArena());
+		for (const NetworkUpdate& update : m_NetworkUpdates)
+		{
+			if (Entity existing = GetEntityByNetworkID(update.NetworkID))
 			{
-				const auto& tagA = m_Registry.get<TagComponent>(entityA).Tag;
-				const auto& tagB = m_Registry.get<TagComponent>(entityB).Tag;
+				existing.PatchComponent<TransformComponent>([&update](TransformComponent& transform)
+				{
+					transform.Translation.x = update.Position.x;
+					transform.Translation.y = update.Position.y;
+				});
+				continue;
+			}
 
-				LOG_INFO("[COLLISION] '{}' collided with '{}'", tagA, tagB);
+			EntityCommandBuffer& commands = GetCommandBuffer();
+			auto it = std::find_if(created.begin(), created.end(),
+				[&update](const std::pair<int, DeferredEntity>& entry) { return entry.first == update.NetworkID; });
+			if (it == created.end())
+			{
+				char name[32];
+				snprintf(name, sizeof(name), "Remote_%d", update.NetworkID);
+				DeferredEntity entity = commands.CreateEntity(name);
+				commands.AddComponent(entity, SpriteRendererComponent(glm::vec4(0, 1, 1, 1)));
+				commands.AddComponent(entity, NetworkIDComponent(update.NetworkID));
+				it = created.insert(created.end(), { update.NetworkID, entity });
 			}
+			commands.AddComponent(it->second, TransformComponent(glm::vec3(update.Position, 0.0f)));
 		}
+	}
 
-		// Sync physics to transform
-		auto physicsView = m_Registry.view<TransformComponent, Rigidbody2DComponent>();
-		for (auto entityID : physicsView)
+	void Scene::StepPhysics(Timestep ts)
+	{
+		// Step physics simulation
+		PROFILE_SCOPE("b2World_Step");
+		int subStepCount = 4;
+		b2World_Step(m_PhysicsWorld, ts, subStepCount);
+	}
+
+	void Scene::SyncPhysicsTransforms()
+	{
+		// Sync physics to transform (only bodies that moved this step report an event)
+		b2BodyEvents bodyEvents = b2World_GetBodyEvents(m_PhysicsWorld);
+		for (int i = 0; i < bodyEvents.moveCount; i++)
 		{
-			Entity entity = { entityID, this };
-			auto& transform = m_Registry.get<TransformComponent>(entity);
-			auto& rb2d = physicsView.get<Rigidbody2DComponent>(entity);
+			const b2BodyMoveEvent& moveEvent = bodyEvents.moveEvents[i];
 
-			b2Transform bodyTransform = b2Body_GetTransform(rb2d.RuntimeBody);
+			entt::entity entity = (entt::entity)(uintptr_t)moveEvent.userData;
+			if (!m_Registry.valid(entity))
+				continue;
 
-			transform.Translation = { b2Body_GetPosition(rb2d.RuntimeBody).x, b2Body_GetPosition(rb2d.RuntimeBody).y ,0.0f };
-			transform.Rotation.z = b2Rot_GetAngle(b2Body_GetRotation(rb2d.RuntimeBody));
+			// Patched, so the spatial index moves only the bodies that moved. The body owns the whole
+			// 2D pose, so the entity goes back onto the z = 0 plane as the full-scene sync always put it.
+			m_Registry.patch<TransformComponent>(entity, [&moveEvent](TransformComponent& transform)
+			{
+				transform.Translation = { moveEvent.transform.p.x, moveEvent.transform.p.y, 0.0f };
+				transform.Rotation.z = b2Rot_GetAngle(moveEvent.transform.q);
+			});
 		}
+	}
+
+	void Scene::RenderRuntime()
+	{
+		if (m_Headless)
+			return;
+
+		PROFILE_FUNCTION();
 
 		// Find main camera
 		Camera* mainCamera = nullptr;
@@ -322,7 +577,7 @@ namespace DemoEngine
 			for (auto entity : view)
 			{
 				auto [transform, circle] = view.get<TransformComponent, CircleRendererComponent>(entity);
-				Renderer2D::DrawCircle(transform.GetTransform(), circle.Color, circle.Thickness, circle.Fade, (int)entity);
+				Renderer2D::DrawCircle(transform.GetTransform(), circle.Colour, circle.Thickness, circle.Fade, (int)entity);
 			}
 
 			Renderer2D::EndScene();
@@ -353,39 +608,77 @@ namespace DemoEngine
 			ConectarENet();
 		}
 
-		// Initialize audio
-		m_Soloud.init();
-		m_Soloud.setGlobalVolume(1.0f);
+		// Created up front so the Render system only looks the group up; creating it sorts the Transform pool
+		m_Registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
 
-		auto audioView = m_Registry.view<AudioComponent>();
-		for (auto entity : audioView)
+		// Initialize audio
 		{
-			auto& audio = m_Registry.get<AudioComponent>(entity);
+			MemoryTagScope audioTag(MemoryTag::Audio);
+
+			// The application's device opens once at startup; headless scenes get a null device of their own
+			if (m_Headless || !AudioEngine::IsInitialised())
+			{
+				m_Soloud.init(SoLoud::Soloud::CLIP_ROUNDOFF, m_Headless ? SoLoud::Soloud::NULLDRIVER : SoLoud::Soloud::AUTO);
+				m_Soloud.setGlobalVolume(1.0f);
+				m_Audio = &m_Soloud;
+			}
+			else
+			{
+				m_Audio = &AudioEngine::Get();
+			}
+
+			// One decode per file, however many components play it
+			std::unordered_map<std::string, Ref<AudioClip>> clips;
 
-			if (!audio.IsLoaded && !audio.FilePath.empty())
+			auto audioView = m_Registry.view<AudioComponent>();
+			for (auto entity : audioView)
 			{
-				auto result = audio.Sound.load(audio.FilePath.c_str());
-				std::cout << "[Audio] Trying to load: " << audio.FilePath << "\n";
-				if (result != SoLoud::SO_NO_ERROR)
+				auto& audio = m_Registry.get<AudioComponent>(entity);
+
+				if (!audio.FilePath.empty())
 				{
-					std::cout << "[Audio] ERROR loading sound: " << result << "\n";
+					Ref<AudioClip>& cached = clips[audio.FilePath];
+					if (audio.Clip->IsLoaded(audio.FilePath))
+					{
+						if (!cached)
+							cached = audio.Clip;
+					}
+					else if (cached)
+					{
+						audio.Clip = cached;
+					}
+					else
+					{
+						// A clip holding another file may still be playing it for whoever shares it. An empty
+						// one is decoded in place, so the editor's copy keeps the samples for the next Play.
+						if (!audio.Clip->LoadedPath.empty() && audio.Clip.use_count() > 1)
+							audio.Clip = CreateRef<AudioClip>();
+
+						auto result = audio.Clip->Wav.load(audio.FilePath.c_str());
+						if (result != SoLoud::SO_NO_ERROR)
+						{
+							LOG_ERROR("[Audio] Could not load '{0}': {1}", audio.FilePath, m_Audio->getErrorString(result));
+						}
+						else
+						{
+							LOG_TRACE("[Audio] Loaded '{0}'", audio.FilePath);
+							audio.Clip->LoadedPath = audio.FilePath;
+							cached = audio.Clip;
+						}
+					}
 				}
-				else
+
+				if (audio.PlayOnStart && audio.Clip->IsLoaded(audio.FilePath))
 				{
-					std::cout << "[Audio] Sound loaded OK\n";
+					// Looping is set on the voice; the Wav is shared with components that may not loop
+					audio.Handle = m_Audio->play(audio.Clip->Wav, -1.0f, 0.0f, true);
+					m_Audio->setLooping(audio.Handle, audio.Loop);
+					m_Audio->setPause(audio.Handle, false);
 				}
-
-				audio.Sound.setLooping(audio.Loop);
-				audio.IsLoaded = true;
-			}
-
-			if (audio.PlayOnStart)
-			{
-				audio.Handle = m_Soloud.play(audio.Sound);
 			}
 		}
 
-		// Initialize physics world
+		// Initialize physics world (allocator installed at startup, see InitPhysicsAllocator)
 		m_WorldDefinition = b2DefaultWorldDef();
 		m_WorldDefinition.gravity = { 0.0f, -9.8f };
 		m_PhysicsWorld = b2CreateWorld(&m_WorldDefinition);
@@ -403,6 +696,7 @@ namespace DemoEngine
 			bodyDef.position = { transform.Translation.x, transform.Translation.y };
 			bodyDef.fixedRotation = rigidbody.FixedRotation;
 			bodyDef.rotation = b2MakeRot(transform.Rotation.z);
+			bodyDef.userData = (void*)(uintptr_t)entity;
 
 			rigidbody.RuntimeBody = b2CreateBody(m_PhysicsWorld, &bodyDef);
 			b2Body_SetGravityScale(rigidbody.RuntimeBody, rigidbody.AffectedbyGravity ? 1.0f : 0.0f);
@@ -441,7 +735,10 @@ namespace DemoEngine
 				boxCollider.ShapeDef.density = boxCollider.Density;
 				boxCollider.ShapeDef.friction = boxCollider.Friction;
 				boxCollider.ShapeDef.restitution = boxCollider.Restitution;
+				boxCollider.ShapeDef.isSensor = boxCollider.IsSensor;
 				boxCollider.ShapeDef.enableContactEvents = true;
+				boxCollider.ShapeDef.enableHitEvents = true;
+				boxCollider.ShapeDef.userData = (void*)(uintptr_t)entity;
 
 				b2CreatePolygonShape(rigidbody.RuntimeBody, &boxCollider.ShapeDef, &boxPoly);
 			}
@@ -465,13 +762,52 @@ namespace DemoEngine
 				circleCollider.ShapeDef.density = circleCollider.Density;
 				circleCollider.ShapeDef.friction = circleCollider.Friction;
 				circleCollider.ShapeDef.restitution = circleCollider.Restitution;
+				circleCollider.ShapeDef.isSensor = circleCollider.IsSensor;
 				circleCollider.ShapeDef.enableContactEvents = true;
+				circleCollider.ShapeDef.enableHitEvents = true;
+				circleCollider.ShapeDef.userData = (void*)(uintptr_t)entity;
 
 				b2CreateCircleShape(rigidbody.RuntimeBody, &circleCollider.ShapeDef, &circleShape);
 			}
 		}
 	}
 
+	void Scene::OnRigidbodyDestroyed(SceneRegistry& registry, entt::entity entity)
+	{
+		// Don't leave a body behind that still points at this entity
+		Rigidbody2DComponent& rb2d = registry.get<Rigidbody2DComponent>(entity);
+		if (b2World_IsValid(m_PhysicsWorld) && b2Body_IsValid(rb2d.RuntimeBody))
+			b2DestroyBody(rb2d.RuntimeBody);
+		rb2d.RuntimeBody = b2_nullBodyId;
+	}
+
+	// Subscribed for AudioComponent, so contact events always have the sounding entity as A
+	void Scene::PlayCollisionSounds(const CollisionEventBatch& events)
+	{
+		if (!m_Audio)
+			return;
+
+		auto play = [this](entt::entity entity)
+		{
+			auto* audio = m_Registry.valid(entity) ? m_Registry.try_get<AudioComponent>(entity) : nullptr;
+			if (!audio || !audio->PlayOnCollision || !audio->Clip->IsLoaded(audio->FilePath))
+				return;
+
+			m_Audio->stop(audio->Handle);
+			audio->Handle = m_Audio->play(audio->Clip->Wav);
+		};
+
+		for (const CollisionBeginEvent& e : events.Begin)
+			play(e.EntityA);
+
+		// Either side of a sensor event may be the one with the sound
+		for (const SensorEvent& e : events.SensorBegin)
+		{
+			play(e.Sensor);
+			play(e.Visitor);
+		}
+	}
+
 	void Scene::OnRuntimeStop()
 	{
 		// 1. Clear runtime body references from all rigidbodies
@@ -488,9 +824,26 @@ namespace DemoEngine
 
 		// 3. Reset global world ID
 		m_PhysicsWorld = b2_nullWorldId;
+		m_CollisionEvents.Clear();
+
+		// Drop anything recorded after the last sync point
+		{
+			std::lock_guard<std::mutex> lock(m_CommandBufferMutex);
+			for (auto& entry : m_CommandBuffers)
+				entry.Buffer->Reset();
+		}
 
-		// Shut down audio
-		m_Soloud.deinit();
+		// Shut down audio; the shared device stays open and only this scene's voices stop
+		if (m_Audio == &m_Soloud)
+		{
+			m_Soloud.deinit();
+		}
+		else if (m_Audio)
+		{
+			for (auto entity : m_Registry.view<AudioComponent>())
+				m_Audio->stop(m_Registry.get<AudioComponent>(entity).Handle);
+		}
+		m_Audio = nullptr;
 
 		// Disconnect from ENet server if connected
 		if (m_Client) {
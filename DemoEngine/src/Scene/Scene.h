@@ -1,10 +1,21 @@
 #pragma once
 #include "Core/Timestep.h"
 #include "entt.hpp"
+#include "SceneRegistry.h"
 #include "Core/UUID.h"
 #include <box2d/box2d.h>
 #include "Components.h"
+#include "ComponentRegistry.h"
+#include "CollisionEvents.h"
+#include "EntityIndex.h"
+#include "SpatialIndex.h"
+#include "EntityCommandBuffer.h"
+#include "SystemScheduler.h"
 #include <typeindex>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include "Renderer/Camera/EditorCamera.h"
 #include <enet\enet.h>
@@ -12,6 +23,7 @@
 namespace DemoEngine
 {
 	class Entity;
+	class InputReplay;
 
 
 	struct CopiedComponent
@@ -31,11 +43,71 @@ namespace DemoEngine
 		static Ref<Scene> Copy(Ref<Scene> other);
 		static void Scene::CopyTo(Ref<Scene> source, Ref<Scene> destination);
 
+		// Routes Box2D's allocations through the heap tracker. Call once at startup, before any
+		// scene creates a physics world, as Box2D must free with the allocator it allocated with.
+		static void InitPhysicsAllocator();
+
 		Entity CreateEntity(const std::string& name = std::string());
 		Entity CreateEntityWithID(UUID uuid, const std::string& name = "");
 
+		// Creates count entities at once with ID, Tag and Transform plus a copy of each
+		// prototype component, e.g. CreateEntities(100000, "Bullet", SpriteRendererComponent{}).
+		// ID and Tag prototypes are ignored; a Transform prototype is where every entity starts.
+		template<typename... Components>
+		std::vector<entt::entity> CreateEntities(size_t count, const std::string& name, const Components&... prototypes)
+		{
+			std::vector<entt::entity> entities(count);
+			if (count == 0)
+				return entities;
+
+			ReserveComponents<IDComponent, TagComponent, TransformComponent, Components...>(count);
+			m_EntityByUUID.Reserve(m_EntityByUUID.Size() + count);
+
+			m_Registry.create(entities.begin(), entities.end());
+
+			std::vector<IDComponent> ids(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				UUID id;
+				ids[i].ID = id;
+				m_EntityByUUID.Insert(id, entities[i]);
+			}
+
+			TransformComponent transform;
+			([&]()
+			{
+				if constexpr (std::is_same_v<Components, TransformComponent>)
+					transform = prototypes;
+			}(), ...);
+
+			m_Registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin());
+			m_Registry.insert<TagComponent>(entities.begin(), entities.end(), TagComponent(name.empty() ? "Entity" : name));
+			m_Registry.insert<TransformComponent>(entities.begin(), entities.end(), transform);
+			([&]()
+			{
+				if constexpr (!IsBaseComponent<Components>)
+					m_Registry.insert<Components>(entities.begin(), entities.end(), prototypes);
+			}(), ...);
+
+			// Only types with an OnComponentAdded overload pay for per-entity dispatch
+			DispatchComponentAdded<TransformComponent>(entities);
+			DispatchComponentAdded<IDComponent>(entities);
+			DispatchComponentAdded<TagComponent>(entities);
+			([&]()
+			{
+				if constexpr (!IsBaseComponent<Components>)
+					DispatchComponentAdded<Components>(entities);
+			}(), ...);
+
+			return entities;
+		}
+
 		Entity DuplicateEntity(Entity entity);
 
+		// Constant-time lookups; return a null Entity if not found
+		Entity GetEntityByUUID(UUID uuid);
+		Entity GetEntityByNetworkID(int networkID);
+
 		void OnUpdateEditor(Timestep ts, EditorCamera& camera);
 		void OnUpdateRuntime(Timestep ts);
 
@@ -56,42 +128,80 @@ namespace DemoEngine
 		inline void SetShowColliders(bool show) { m_ShowColliders = show; }
 		inline bool GetShowColliders() const { return m_ShowColliders; }
 
+		CollisionEventQueue& GetCollisionEvents() { return m_CollisionEvents; }
+
+		// Point, rect, radius and ray queries over entity bounds. Built on first use, so
+		// scenes that never query pay nothing for it.
+		SpatialIndex& GetSpatialIndex();
+
+		bool IsEntityValid(entt::entity entity) const { return m_Registry.valid(entity); }
+
+		// Systems run by OnUpdateRuntime; gameplay code can register its own here
+		SystemScheduler& GetSystems() { return m_Systems; }
+
+		// Headless scenes (replays, benchmarks) skip rendering and play audio to a null device.
+		// Set before OnRuntimeStart.
+		void SetHeadless(bool headless) { m_Headless = headless; }
+		bool IsHeadless() const { return m_Headless; }
+
+		// While set, network traffic comes from the replay's current frame instead of ENet
+		void SetNetworkReplay(const InputReplay* replay) { m_NetworkReplay = replay; }
+
+		// Command buffer owned by the calling thread. Structural changes recorded into it
+		// are applied at the next sync point, so it is safe to use while iterating views,
+		// from collision handlers and from worker threads.
+		EntityCommandBuffer& GetCommandBuffer();
+
+		// Applies every thread's recorded commands: creates, then adds/removes, then destroys.
+		// Must only be called from the main thread while no system is running.
+		void PlaybackCommandBuffers();
+
 		template<typename... Components>
 		auto GetAllEntitiesWith() 
 		{
 			return m_Registry.view<Components...>();
 		}
 
+		// Called by Entity::AddComponent. Components that need setup when added get their own
+		// overload (see OnComponentAdded(Entity, CameraComponent&)); everything else resolves to
+		// this no-op, which HasComponentAddedHandler tells apart by its return type.
+		struct NoComponentAddedHandler {};
 		template<typename T>
-		void RegisterComponentHandler(std::function<void(Entity, T&)> handler)
+		NoComponentAddedHandler OnComponentAdded(Entity, T&) { return {}; }
+		void OnComponentAdded(Entity entity, CameraComponent& component);
+		void OnComponentAdded(Entity entity, NetworkIDComponent& component);
+
+		template<typename T>
+		static constexpr bool HasComponentAddedHandler()
+		{
+			return !std::is_same_v<decltype(std::declval<Scene&>().OnComponentAdded(std::declval<Entity&>(), std::declval<T&>())), NoComponentAddedHandler>;
+		}
+
+		template<typename... Components>
+		void ReserveComponents(size_t additional)
 		{
-			m_ComponentHandlers[typeid(T)] = [handler](Entity entity) {
-				handler(entity, entity.GetComponent<T>());
-			};
+			(m_Registry.storage<Components>().reserve(m_Registry.storage<Components>().size() + additional), ...);
 		}
 
+		// Every entity has these from creation
+		template<typename T>
+		static constexpr bool IsBaseComponent = std::is_same_v<T, IDComponent> || std::is_same_v<T, TagComponent> || std::is_same_v<T, TransformComponent>;
+
 		template<typename T>
-		void OnComponentAdded(Entity entity, T& component)
+		void DispatchComponentAdded(const std::vector<entt::entity>& entities)
 		{
-			auto it = m_ComponentHandlers.find(typeid(T));
-			if (it != m_ComponentHandlers.end())
-			{
-				// Call the registered handler if it exists 
-				it->second(entity);
-			}
-			else
+			if constexpr (HasComponentAddedHandler<T>())
 			{
-				// Default behavior: log the component addition
-				LOG_INFO("Component of type {0} added to Entity ID {1}", typeid(T).name(), (uint32_t)entity);
+				for (entt::entity entity : entities)
+					OnComponentAdded(Entity{ entity, this }, m_Registry.get<T>(entity));
 			}
 		}
 
-
 		const std::string& GetName() const { return m_Name; }
 		void SetName(const std::string& name) { m_Name = name; }
 
 		template<typename TComponent>
-		void CopyComponentIfExists(entt::entity dst, entt::registry& dstRegistry, entt::entity src)
+		void CopyComponentIfExists(entt::entity dst, SceneRegistry& dstRegistry, entt::entity src)
 		{
 			if (m_Registry.any_of<TComponent>(src))
 			{
@@ -100,16 +210,36 @@ namespace DemoEngine
 			}
 		}
 
+		// Bulk-copies a whole component pool. Both registries must use the same entity
+		// identifiers (see CopyTo); no OnComponentAdded handlers are fired.
 		template<typename T>
-		static void CopyComponent(entt::registry& dstRegistry, entt::registry& srcRegistry, const std::unordered_map < UUID, entt::entity>& enttMap)
+		static void CopyComponentStorage(SceneRegistry& dstRegistry, SceneRegistry& srcRegistry)
 		{
-			auto srcEntities = srcRegistry.view<T>();
-			for (auto srcEntity : srcEntities)
+			auto& srcStorage = srcRegistry.storage<T>();
+			if (srcStorage.empty())
+				return;
+
+			auto& dstStorage = dstRegistry.storage<T>();
+			dstStorage.reserve(srcStorage.size());
+			const ScenePool& srcEntities = srcStorage;
+
+			constexpr size_t pageSize = entt::component_traits<T>::page_size;
+			if constexpr (ComponentTraits<T>::TriviallyRelocatable && pageSize != 0)
 			{
-				entt::entity destEntity = enttMap.at(srcRegistry.get<IDComponent>(srcEntity).ID);
-				auto& srcComponent = srcRegistry.get<T>(srcEntity);
-				auto& destComponent = dstRegistry.emplace_or_replace<T>(destEntity, srcComponent);
+				if (dstStorage.empty())
+				{
+					// Entities go in in packed order, so the destination's pages line up with the
+					// source's and each one is a single memcpy
+					const size_t count = srcStorage.size();
+					dstStorage.insert(srcEntities.data(), srcEntities.data() + count);
+					for (size_t page = 0, offset = 0; offset < count; page++, offset += pageSize)
+						std::memcpy(dstStorage.raw()[page], srcStorage.raw()[page], std::min(pageSize, count - offset) * sizeof(T));
+					return;
+				}
 			}
+
+			// Entity and component iterators walk the packed arrays in the same order
+			dstStorage.insert(srcEntities.begin(), srcEntities.end(), srcStorage.begin());
 		}
 
 		template<typename T>
@@ -142,7 +272,7 @@ namespace DemoEngine
 			return m_CopiedComponent.Type != typeid(void);
 		}
 
-		entt::registry m_Registry;
+		SceneRegistry m_Registry;
 		
 	private:
 		uint32_t GetViewportWidth() { return m_ViewportWidth; }
@@ -151,9 +281,20 @@ namespace DemoEngine
 		void SetSceneID(UUID id) { m_SceneID = id; }
 		UUID GetSceneID() { return m_SceneID; }
 
+		void RegisterRuntimeSystems();
+		void UpdateNetworking();
+		void OnNetworkPacket(const uint8_t* data, size_t size);
+		void ReplicateNetworkEntities();
+		void StepPhysics(Timestep ts);
+		void SyncPhysicsTransforms();
+		void RenderRuntime();
+		void OnRigidbodyDestroyed(SceneRegistry& registry, entt::entity entity);
+		void PlayCollisionSounds(const CollisionEventBatch& events);
+
 		b2WorldDef m_WorldDefinition;
 
-		SoLoud::Soloud m_Soloud;
+		SoLoud::Soloud m_Soloud; // Only opened for headless scenes, see OnRuntimeStart
+		SoLoud::Soloud* m_Audio = nullptr;
 
 	private:
 		UUID m_SceneID;
@@ -167,8 +308,6 @@ namespace DemoEngine
 		friend class SceneHierarchyPanel;
 		friend class SceneHierarchy;
 
-		std::unordered_map<std::type_index, std::function<void(Entity)>> m_ComponentHandlers;
-
 		uint32_t m_ViewportWidth = 0, m_ViewportHeight = 0;
 
 		std::string m_Name;
@@ -176,7 +315,55 @@ namespace DemoEngine
 
 		CopiedComponent m_CopiedComponent;
 
+		EntityIndex m_EntityByUUID;
+		EntityIndex m_EntityByNetworkID;
+		Scope<SpatialIndex> m_SpatialIndex;
+
 		b2WorldId m_PhysicsWorld = b2_nullWorldId;
+		CollisionEventQueue m_CollisionEvents;
+		SystemScheduler m_Systems;
+		bool m_Headless = false;
+		const InputReplay* m_NetworkReplay = nullptr;
+
+		// Remote positions received this frame, applied by ReplicateNetworkEntities
+		struct NetworkUpdate
+		{
+			int NetworkID;
+			glm::vec2 Position;
+		};
+		std::vector<NetworkUpdate> m_NetworkUpdates;
+
+		struct ThreadCommandBuffer
+		{
+			std::thread::id Thread;
+			Scope<EntityCommandBuffer> Buffer;
+		};
+		std::mutex m_CommandBufferMutex;
+		std::vector<ThreadCommandBuffer> m_CommandBuffers;
+		uint64_t m_InstanceID; // Keys the per-thread command buffer cache
+
+		friend struct EntityCommandBuffer::ComponentOps;
 	};
 
+	template<typename T>
+	const EntityCommandBuffer::ComponentOps& EntityCommandBuffer::ComponentOps::Get()
+	{
+		static const ComponentOps ops = {
+			// Moves the payload into the registry, then ends its lifetime in the arena
+			[](Scene& scene, entt::entity entity, void* data)
+			{
+				T& component = *static_cast<T*>(data);
+				if (scene.m_Registry.all_of<T>(entity))
+					scene.m_Registry.replace<T>(entity, std::move(component));
+				else
+					scene.OnComponentAdded(Entity{ entity, &scene }, scene.m_Registry.emplace<T>(entity, std::move(component)));
+
+				if constexpr (!std::is_trivially_destructible_v<T>)
+					component.~T();
+			},
+			[](Scene& scene, entt::entity entity) { scene.m_Registry.remove<T>(entity); },
+			[](void* data) { static_cast<T*>(data)->~T(); }
+		};
+		return ops;
+	}
 }
@@ -33,7 +33,7 @@ namespace DemoEngine
 			RecalculateProjection();
 		}
 
-		ProjectionType GetProjectionType() { return m_CameraType; }
+		ProjectionType GetProjectionType() const { return m_CameraType; }
 
 	private:
 		void RecalculateProjection();
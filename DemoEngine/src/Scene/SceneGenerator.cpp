@@ -0,0 +1,196 @@
+#include "DemoEngine_PCH.h"
+#include "SceneGenerator.h"
+#include "SceneSerialiser.h"
+#include "Entity.h"
+#include "Components.h"
+#include "Core/HeapTracker.h"
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace DemoEngine
+{
+	// Splits count over the weights; rounding leftovers go to the largest remainders
+	static std::vector<size_t> Apportion(size_t count, const std::vector<float>& weights)
+	{
+		double total = 0.0;
+		for (float weight : weights)
+			total += std::max(weight, 0.0f);
+
+		std::vector<size_t> counts(weights.size(), 0);
+		if (total <= 0.0)
+			return counts;
+
+		std::vector<std::pair<double, size_t>> remainders;
+		size_t assigned = 0;
+		for (size_t i = 0; i < weights.size(); i++)
+		{
+			double share = count * std::max(weights[i], 0.0f) / total;
+			counts[i] = (size_t)share;
+			assigned += counts[i];
+			remainders.emplace_back(share - counts[i], i);
+		}
+
+		std::sort(remainders.begin(), remainders.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+		for (size_t i = 0; assigned < count; i++, assigned++)
+			counts[remainders[i % remainders.size()].second]++;
+
+		return counts;
+	}
+
+	void SceneGenerator::Generate(const Ref<Scene>& scene, const SceneGeneratorSettings& settings)
+	{
+		PROFILE_FUNCTION();
+		MemoryTagScope memoryTag(MemoryTag::Scene);
+
+		const SceneGeneratorMix& mix = settings.Mix;
+		std::vector<size_t> counts = Apportion(settings.EntityCount,
+			{ mix.Sprites, mix.Circles, mix.Boxes, mix.Balls, mix.AudioSources, mix.Players });
+
+		Rigidbody2DComponent boxBody;
+		boxBody.BodyType = b2_dynamicBody;
+		boxBody.Mass = { 1.0f, { 0.0f, 0.0f }, 1.0f / 6.0f };
+
+		Rigidbody2DComponent ballBody = boxBody;
+		ballBody.Mass.rotationalInertia = 0.125f;
+
+		AudioComponent audio(settings.AudioClipPath);
+
+		// Every archetype is created in one bulk call
+		std::vector<entt::entity> entities;
+		entities.reserve(settings.EntityCount);
+		auto append = [&entities](const std::vector<entt::entity>& created) { entities.insert(entities.end(), created.begin(), created.end()); };
+
+		append(scene->CreateEntities(counts[0], "Sprite", SpriteRendererComponent{}));
+		append(scene->CreateEntities(counts[1], "Circle", CircleRendererComponent{}));
+		append(scene->CreateEntities(counts[2], "Box", SpriteRendererComponent{}, boxBody, BoxCollider2DComponent{}));
+		append(scene->CreateEntities(counts[3], "Ball", CircleRendererComponent{}, ballBody, CircleCollider2DComponent{}));
+		append(scene->CreateEntities(counts[4], "Audio Source", SpriteRendererComponent{}, audio));
+		append(scene->CreateEntities(counts[5], "Player", SpriteRendererComponent{}, boxBody, BoxCollider2DComponent{}, PlayerControllerComponent{}));
+
+		std::mt19937 random(settings.Seed);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		std::shuffle(entities.begin(), entities.end(), random);
+
+		uint32_t columns = std::max(1u, (uint32_t)std::ceil(std::sqrt((double)entities.size())));
+		glm::vec2 origin = { -(columns - 1) * settings.Spacing * 0.5f, -(columns - 1) * settings.Spacing * 0.5f };
+
+		auto& registry = scene->m_Registry;
+		for (size_t i = 0; i < entities.size(); i++)
+		{
+			entt::entity entity = entities[i];
+
+			auto& transform = registry.get<TransformComponent>(entity);
+			transform.Translation = { origin.x + (i % columns) * settings.Spacing, origin.y + (i / columns) * settings.Spacing, 0.0f };
+			transform.Rotation.z = unit(random) * glm::two_pi<float>();
+
+			glm::vec4 colour = { 0.2f + unit(random) * 0.8f, 0.2f + unit(random) * 0.8f, 0.2f + unit(random) * 0.8f, 1.0f };
+			if (auto* sprite = registry.try_get<SpriteRendererComponent>(entity))
+				sprite->Colour = colour;
+			else if (auto* circle = registry.try_get<CircleRendererComponent>(entity))
+				circle->Colour = colour;
+
+			if (auto* body = registry.try_get<Rigidbody2DComponent>(entity))
+			{
+				if (!registry.all_of<PlayerControllerComponent>(entity) && unit(random) < settings.StaticFraction)
+					body->BodyType = b2_staticBody;
+			}
+		}
+
+		// A camera that frames the whole grid, so the scene can be played straight away
+		Entity camera = scene->CreateEntity("Camera");
+		auto& cameraComponent = camera.AddComponent<CameraComponent>();
+		cameraComponent.camera.SetProjectionType(ProjectionType::Orthographic);
+		cameraComponent.camera.SetOrthographicSize(std::max(10.0f, columns * settings.Spacing));
+		camera.GetComponent<TransformComponent>().Translation.z = 10.0f;
+
+		LOG_INFO("Generated scene with {0} entities ({1} sprites, {2} circles, {3} boxes, {4} balls, {5} audio sources, {6} players)",
+			entities.size() + 1, counts[0], counts[1], counts[2], counts[3], counts[4], counts[5]);
+	}
+
+	static bool ParseMix(const std::string& text, SceneGeneratorMix& mix)
+	{
+		std::stringstream stream(text);
+		std::string entry;
+		while (std::getline(stream, entry, ','))
+		{
+			size_t separator = entry.find('=');
+			if (separator == std::string::npos)
+				return false;
+
+			std::string key = entry.substr(0, separator);
+			const char* value = entry.c_str() + separator + 1;
+			char* valueEnd = nullptr;
+			float weight = std::strtof(value, &valueEnd);
+			if (valueEnd == value || *valueEnd != '\0' || weight < 0.0f)
+				return false;
+
+			if (key == "sprites") mix.Sprites = weight;
+			else if (key == "circles") mix.Circles = weight;
+			else if (key == "boxes") mix.Boxes = weight;
+			else if (key == "balls") mix.Balls = weight;
+			else if (key == "audio") mix.AudioSources = weight;
+			else if (key == "players") mix.Players = weight;
+			else return false;
+		}
+
+		// All zero would write an empty scene
+		return mix.Sprites + mix.Circles + mix.Boxes + mix.Balls + mix.AudioSources + mix.Players > 0.0f;
+	}
+
+	bool ParseSceneGeneratorOptions(int argc, char** argv, SceneGeneratorOptions& options)
+	{
+		bool valid = true;
+		for (int i = 1; i + 1 < argc; i++)
+		{
+			std::string arg = argv[i];
+			if (arg == "--generate-scene")
+				options.OutputPath = argv[++i];
+			else if (arg == "--entities")
+				options.Settings.EntityCount = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+			else if (arg == "--mix")
+			{
+				// Only the archetypes listed are generated
+				options.Settings.Mix = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+				if (!ParseMix(argv[++i], options.Settings.Mix))
+				{
+					LOG_ERROR("Malformed --mix '{0}'; expected e.g. sprites=60,boxes=40", argv[i]);
+					valid = false;
+				}
+			}
+			else if (arg == "--static")
+				options.Settings.StaticFraction = (float)std::atof(argv[++i]);
+			else if (arg == "--spacing")
+				options.Settings.Spacing = (float)std::atof(argv[++i]);
+			else if (arg == "--audio-clip")
+				options.Settings.AudioClipPath = argv[++i];
+			else if (arg == "--seed")
+				options.Settings.Seed = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+		}
+
+		return valid && !options.OutputPath.empty();
+	}
+
+	int RunSceneGenerator(const SceneGeneratorOptions& options)
+	{
+		if (!SceneSerialiser::IsScenePath(options.OutputPath))
+		{
+			LOG_ERROR("'{0}' needs a {1} or {2} extension", options.OutputPath, SceneSerialiser::TextExtension, SceneSerialiser::BinaryExtension);
+			return 1;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		Ref<Scene> scene = CreateRef<Scene>();
+		SceneGenerator::Generate(scene, options.Settings);
+		auto generated = std::chrono::steady_clock::now();
+
+		SceneSerialiser(scene).Serialise(options.OutputPath);
+		auto written = std::chrono::steady_clock::now();
+
+		LOG_INFO("Generated in {0:.1f} ms, written in {1:.1f} ms",
+			std::chrono::duration<double, std::milli>(generated - start).count(),
+			std::chrono::duration<double, std::milli>(written - generated).count());
+		return 0;
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Scene.h"
+
+namespace DemoEngine
+{
+	// Relative weight of each entity archetype; they need not add up to anything
+	struct SceneGeneratorMix
+	{
+		float Sprites = 60.0f;
+		float Circles = 20.0f;
+		float Boxes = 10.0f; // Sprite with a rigidbody and box collider
+		float Balls = 8.0f; // Circle with a rigidbody and circle collider
+		float AudioSources = 0.1f; // Sprite with an audio component
+		float Players = 0.01f; // Physics box with a player controller
+	};
+
+	struct SceneGeneratorSettings
+	{
+		uint32_t EntityCount = 10000;
+		SceneGeneratorMix Mix;
+
+		float StaticFraction = 0.1f; // Share of physics bodies that never move
+		float Spacing = 1.5f; // Grid cell size; shapes are unit sized so nothing starts overlapping
+		std::string AudioClipPath; // Left empty, audio components load nothing
+		uint32_t Seed = 1;
+	};
+
+	// Procedural stress scenes for scaling tests. Archetypes are created in bulk and
+	// then shuffled over a square grid, so every region of the scene has the same mix.
+	// Everything but the UUIDs is deterministic for a given seed.
+	class SceneGenerator
+	{
+	public:
+		static void Generate(const Ref<Scene>& scene, const SceneGeneratorSettings& settings);
+	};
+
+	// Command line mode: writes a scene and exits, e.g.
+	//	--generate-scene stress.demoenginebin --entities 1000000 --mix sprites=50,boxes=50 --seed 7
+	struct SceneGeneratorOptions
+	{
+		std::string OutputPath;
+		SceneGeneratorSettings Settings;
+	};
+
+	// False when there is no --generate-scene, or the options are malformed (check OutputPath to tell apart)
+	bool ParseSceneGeneratorOptions(int argc, char** argv, SceneGeneratorOptions& options);
+	int RunSceneGenerator(const SceneGeneratorOptions& options);
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "entt.hpp"
+#include "Core/HeapTracker.h"
+
+namespace DemoEngine
+{
+	// Registry whose entity and component pools are charged to MemoryTag::Scene
+	using SceneRegistry = entt::basic_registry<entt::entity, TaggedAllocator<entt::entity, MemoryTag::Scene>>;
+
+	// Type-erased pool, what entt::sparse_set is for the default registry
+	using ScenePool = SceneRegistry::common_type;
+}
@@ -2,9 +2,12 @@
 #include "SceneSerialiser.h" 
 #include "Entity.h"
 #include "Components.h"
+#include "ComponentRegistry.h"
 #include "Utils/YamlConverter.h"
+#include "Core/HeapTracker.h"
 
 #include <yaml-cpp/yaml.h>
+#include <filesystem>
 #include <fstream>
 
 namespace DemoEngine
@@ -14,32 +17,52 @@ namespace DemoEngine
 	{
 	}
 
-	// Adaptaciones para los nuevos structs de Rigidbody2DComponent, BoxCollider2DComponent y CircleCollider2DComponent
+	bool SceneSerialiser::IsBinaryPath(const std::string& filePath)
+	{
+		return std::filesystem::path(filePath).extension() == BinaryExtension;
+	}
 
-	static void SerialiseAudioComponent(YAML::Emitter& out, Entity entity)
+	bool SceneSerialiser::IsScenePath(const std::string& filePath)
 	{
-		auto& audio = entity.GetComponent<AudioComponent>();
-		out << YAML::Key << "AudioComponent";
-		out << YAML::BeginMap;
-		out << YAML::Key << "FilePath" << YAML::Value << audio.FilePath;
-		out << YAML::Key << "Loop" << YAML::Value << audio.Loop;
-		out << YAML::Key << "PlayOnStart" << YAML::Value << audio.PlayOnStart;
+		return IsBinaryPath(filePath) || std::filesystem::path(filePath).extension() == TextExtension;
+	}
+
+	// Serialise/DeserialiseComponent for components flagged ComponentFlags_Serialised whose state
+	// their COMPONENT_LIST fields don't describe; the rest use the field-driven templates below.
+	// The enclosing map and its key (ComponentTraits<T>::Name) are written by SerialiseEntity.
+
+	static void SerialiseComponent(YAML::Emitter& out, const CameraComponent& cc)
+	{
+		auto& camera = cc.camera;
+		out << YAML::Key << "Camera" << YAML::BeginMap;
+		out << YAML::Key << "ProjectionType" << YAML::Value << (int)camera.GetProjectionType();
+		out << YAML::Key << "Perspective FOV" << YAML::Value << camera.GetPerspectiveFOV();
+		out << YAML::Key << "PerspectiveNear" << YAML::Value << camera.GetPerspectiveNear();
+		out << YAML::Key << "PerspectiveFar" << YAML::Value << camera.GetPerspectiveFar();
+		out << YAML::Key << "OrthographicSize" << YAML::Value << camera.GetOrthographicSize();
+		out << YAML::Key << "OrthographicNear" << YAML::Value << camera.GetOrthographicNear();
+		out << YAML::Key << "OrthographicFar" << YAML::Value << camera.GetOrthographicFar();
 		out << YAML::EndMap;
+		out << YAML::Key << "Primary" << YAML::Value << cc.Primary;
+		out << YAML::Key << "FixedAspectRatio" << YAML::Value << cc.FixedAspectRatio;
 	}
 
-	static void DeserialiseAudioComponent(Entity& entity, const YAML::Node& node)
+	static void DeserialiseComponent(const YAML::Node& node, CameraComponent& cc)
 	{
-		auto& audio = entity.AddComponent<AudioComponent>();
-		audio.FilePath = node["FilePath"] ? node["FilePath"].as<std::string>() : "";
-		audio.Loop = node["Loop"] ? node["Loop"].as<bool>() : false;
-		audio.PlayOnStart = node["PlayOnStart"] ? node["PlayOnStart"].as<bool>() : true;
+		const YAML::Node cameraProps = node["Camera"];
+		cc.camera.SetProjectionType((ProjectionType)cameraProps["ProjectionType"].as<int>());
+		cc.camera.SetPerspectiveFOV(cameraProps["Perspective FOV"].as<float>());
+		cc.camera.SetPerspectiveNear(cameraProps["PerspectiveNear"].as<float>());
+		cc.camera.SetPerspectiveFar(cameraProps["PerspectiveFar"].as<float>());
+		cc.camera.SetOrthographicSize(cameraProps["OrthographicSize"].as<float>());
+		cc.camera.SetOrthographicNear(cameraProps["OrthographicNear"].as<float>());
+		cc.camera.SetOrthographicFar(cameraProps["OrthographicFar"].as<float>());
+		cc.Primary = node["Primary"].as<bool>();
+		cc.FixedAspectRatio = node["FixedAspectRatio"].as<bool>();
 	}
 
-	static void SerialiseRigidbody2D(YAML::Emitter& out, Entity entity)
+	static void SerialiseComponent(YAML::Emitter& out, const Rigidbody2DComponent& rb)
 	{
-		auto& rb = entity.GetComponent<Rigidbody2DComponent>();
-		out << YAML::Key << "Rigidbody2DComponent";
-		out << YAML::BeginMap;
 		out << YAML::Key << "BodyType" << YAML::Value << (int)rb.BodyType;
 		out << YAML::Key << "FixedRotation" << YAML::Value << rb.FixedRotation;
 		out << YAML::Key << "AffectedbyGravity" << YAML::Value << rb.AffectedbyGravity;
@@ -47,12 +70,10 @@ namespace DemoEngine
 		glm::vec2 MassCenterTmp = { rb.Mass.center.x, rb.Mass.center.y };
 		out << YAML::Key << "CenterOfMass" << YAML::Value << MassCenterTmp;
 		out << YAML::Key << "Inertia" << YAML::Value << rb.Mass.rotationalInertia;
-		out << YAML::EndMap;
 	}
 
-	static void DeserialiseRigidbody2D(Entity& entity, const YAML::Node& rbNode)
+	static void DeserialiseComponent(const YAML::Node& rbNode, Rigidbody2DComponent& rb2d)
 	{
-		auto& rb2d = entity.AddComponent<Rigidbody2DComponent>();
 		rb2d.BodyType = rbNode["BodyType"] ? (b2BodyType)rbNode["BodyType"].as<int>() : b2_staticBody;
 		rb2d.FixedRotation = rbNode["FixedRotation"] ? rbNode["FixedRotation"].as<bool>() : false;
 		rb2d.AffectedbyGravity = rbNode["AffectedbyGravity"] ? rbNode["AffectedbyGravity"].as<bool>() : true;
@@ -64,50 +85,27 @@ namespace DemoEngine
 		rb2d.Mass.rotationalInertia = rbNode["Inertia"] ? glm::max(0.0f, rbNode["Inertia"].as<float>()) : 0.0f;
 	}
 
-	static void SerialiseBoxCollider2D(YAML::Emitter& out, Entity entity)
-	{
-		auto& box = entity.GetComponent<BoxCollider2DComponent>();
-		out << YAML::Key << "BoxCollider2DComponent";
-		out << YAML::BeginMap;
-		out << YAML::Key << "Offset" << YAML::Value << box.Offset;
-		out << YAML::Key << "HalfSize" << YAML::Value << box.HalfSize;
-		out << YAML::Key << "Density" << YAML::Value << box.Density;
-		out << YAML::Key << "Friction" << YAML::Value << box.Friction;
-		out << YAML::Key << "Restitution" << YAML::Value << box.Restitution;
-		out << YAML::EndMap;
-	}
-
-	static void DeserialiseBoxCollider2D(Entity& entity, const YAML::Node& boxNode)
-	{
-		auto& box = entity.AddComponent<BoxCollider2DComponent>();
-		box.Offset = boxNode["Offset"] ? boxNode["Offset"].as<glm::vec2>() : glm::vec2(0.0f);
-		box.HalfSize = boxNode["HalfSize"] ? boxNode["HalfSize"].as<glm::vec2>() : glm::vec2(0.5f);
-		box.Density = boxNode["Density"] ? boxNode["Density"].as<float>() : 1.0f;
-		box.Friction = boxNode["Friction"] ? boxNode["Friction"].as<float>() : 0.5f;
-		box.Restitution = boxNode["Restitution"] ? boxNode["Restitution"].as<float>() : 0.0f;
-	}
-
-	static void SerialiseCircleCollider2D(YAML::Emitter& out, Entity entity)
+	// One key per field; missing keys keep the component's defaults
+	template<typename T>
+	static void SerialiseComponent(YAML::Emitter& out, const T& component)
 	{
-		auto& circle = entity.GetComponent<CircleCollider2DComponent>();
-		out << YAML::Key << "CircleCollider2DComponent";
-		out << YAML::BeginMap;
-		out << YAML::Key << "Offset" << YAML::Value << circle.Offset;
-		out << YAML::Key << "Radius" << YAML::Value << circle.Radius;
-		out << YAML::Key << "Density" << YAML::Value << circle.Density;
-		out << YAML::Key << "Friction" << YAML::Value << circle.Friction;
-		out << YAML::Key << "Restitution" << YAML::Value << circle.Restitution;
-		out << YAML::EndMap;
+		static_assert(HasComponentFields<T>(), "Give the component fields in COMPONENT_LIST or a SerialiseComponent overload");
+		ForEachField<T>([&](const auto& field)
+			{
+				out << YAML::Key << field.Name << YAML::Value << component.*field.Pointer;
+			});
 	}
 
-	static void DeserialiseCircleCollider2D(Entity& entity, const YAML::Node& circleNode)
+	template<typename T>
+	static void DeserialiseComponent(const YAML::Node& node, T& component)
 	{
-		auto& circle = entity.AddComponent<CircleCollider2DComponent>();
-		circle.Offset = circleNode["Offset"] ? circleNode["Offset"].as<glm::vec2>() : glm::vec2(0.0f);
-		circle.Radius = circleNode["Radius"] ? circleNode["Radius"].as<float>() : 0.5f;
-		circle.Density = circleNode["Density"] ? circleNode["Density"].as<float>() : 1.0f;
-		circle.Friction = circleNode["Friction"] ? circleNode["Friction"].as<float>() : 0.5f;
-		circle.Restitution = circleNode["Restitution"] ? circleNode["Restitution"].as<float>() : 0.0f;
+		static_assert(HasComponentFields<T>(), "Give the component fields in COMPONENT_LIST or a DeserialiseComponent overload");
+		ForEachField<T>([&](const auto& field)
+			{
+				using Member = typename std::decay_t<decltype(field)>::Type;
+				if (const YAML::Node value = node[field.Name])
+					component.*field.Pointer = value.as<Member>();
+			});
 	}
 
 	// ------------------- SERIALIZACIN DE ENTIDAD -----------------------
@@ -119,83 +117,20 @@ namespace DemoEngine
 		out << YAML::BeginMap;
 		out << YAML::Key << "Entity" << YAML::Value << entity.GetUUID();
 
-		if (entity.HasComponent<TagComponent>())
-		{
-			out << YAML::Key << "TagComponent";
-			out << YAML::BeginMap;
-			out << YAML::Key << "Tag" << YAML::Value << entity.GetComponent<TagComponent>().Tag;
-			out << YAML::EndMap;
-		}
-
-		if (entity.HasComponent<TransformComponent>())
-		{
-			auto& tr = entity.GetComponent<TransformComponent>();
-			out << YAML::Key << "TransformComponent";
-			out << YAML::BeginMap;
-			out << YAML::Key << "Translation" << YAML::Value << tr.Translation;
-			out << YAML::Key << "Rotation" << YAML::Value << tr.Rotation;
-			out << YAML::Key << "Scale" << YAML::Value << tr.Scale;
-			out << YAML::EndMap;
-		}
-
-		if (entity.HasComponent<CameraComponent>())
-		{
-			auto& cc = entity.GetComponent<CameraComponent>();
-			auto& camera = cc.camera;
-			out << YAML::Key << "CameraComponent";
-			out << YAML::BeginMap;
-			out << YAML::Key << "Camera" << YAML::BeginMap;
-			out << YAML::Key << "ProjectionType" << YAML::Value << (int)camera.GetProjectionType();
-			out << YAML::Key << "Perspective FOV" << YAML::Value << camera.GetPerspectiveFOV();
-			out << YAML::Key << "PerspectiveNear" << YAML::Value << camera.GetPerspectiveNear();
-			out << YAML::Key << "PerspectiveFar" << YAML::Value << camera.GetPerspectiveFar();
-			out << YAML::Key << "OrthographicSize" << YAML::Value << camera.GetOrthographicSize();
-			out << YAML::Key << "OrthographicNear" << YAML::Value << camera.GetOrthographicNear();
-			out << YAML::Key << "OrthographicFar" << YAML::Value << camera.GetOrthographicFar();
-			out << YAML::EndMap;
-			out << YAML::Key << "Primary" << YAML::Value << cc.Primary;
-			out << YAML::Key << "FixedAspectRatio" << YAML::Value << cc.FixedAspectRatio;
-			out << YAML::EndMap;
-		}
-
-		if (entity.HasComponent<SpriteRendererComponent>())
-		{
-			auto& src = entity.GetComponent<SpriteRendererComponent>();
-			out << YAML::Key << "SpriteRendererComponent";
-			out << YAML::BeginMap;
-			out << YAML::Key << "Colour" << YAML::Value << src.Colour;
-			out << YAML::EndMap;
-		}
-
-		if (entity.HasComponent<CircleRendererComponent>())
-		{
-			auto& src = entity.GetComponent<CircleRendererComponent>();
-			out << YAML::Key << "CircleRendererComponent";
-			out << YAML::BeginMap;
-			out << YAML::Key << "Colour" << YAML::Value << src.Color;
-			out << YAML::EndMap;
-		}
-
-		if (entity.HasComponent<Rigidbody2DComponent>())
-			SerialiseRigidbody2D(out, entity);
-
-		if (entity.HasComponent<BoxCollider2DComponent>())
-			SerialiseBoxCollider2D(out, entity);
-
-		if (entity.HasComponent<CircleCollider2DComponent>())
-			SerialiseCircleCollider2D(out, entity);
-
-		if (entity.HasComponent<AudioComponent>())
-			SerialiseAudioComponent(out, entity);
-
-		if (entity.HasComponent<PlayerControllerComponent>())
-		{
-			auto& pc = entity.GetComponent<PlayerControllerComponent>();
-			out << YAML::Key << "PlayerControllerComponent";
-			out << YAML::BeginMap;
-			out << YAML::Key << "MoveForce" << YAML::Value << pc.MoveForce;
-			out << YAML::EndMap;
-		}
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+				{
+					if (entity.HasComponent<T>())
+					{
+						out << YAML::Key << ComponentTraits<T>::Name;
+						out << YAML::BeginMap;
+						SerialiseComponent(out, entity.GetComponent<T>());
+						out << YAML::EndMap;
+					}
+				}
+			});
 
 		out << YAML::EndMap;
 	}
@@ -204,6 +139,13 @@ namespace DemoEngine
 
 	void SceneSerialiser::Serialise(const std::string& filePath)
 	{
+		if (IsBinaryPath(filePath))
+		{
+			SerialiseBinary(filePath);
+			return;
+		}
+
+		MemoryTagScope memoryTag(MemoryTag::Serialisation);
 		YAML::Emitter out;
 		out << YAML::BeginMap;
 		out << YAML::Key << "Scene" << YAML::Value << "Untitled Scene";
@@ -233,6 +175,10 @@ namespace DemoEngine
 
 	bool SceneSerialiser::Deserialise(const std::string& filePath)
 	{
+		if (IsBinaryPath(filePath))
+			return DeserialiseBinary(filePath);
+
+		MemoryTagScope memoryTag(MemoryTag::Serialisation);
 		std::ifstream stream(filePath);
 		std::stringstream strStream;
 		strStream << stream.rdbuf();
@@ -257,58 +203,19 @@ namespace DemoEngine
 
 				Entity deserializedEntity = m_Scene->CreateEntityWithID(uuid, name);
 
-				if (entity["TransformComponent"])
-				{
-					auto& tc = deserializedEntity.GetComponent<TransformComponent>();
-					tc.Translation = entity["TransformComponent"]["Translation"].as<glm::vec3>();
-					tc.Rotation = entity["TransformComponent"]["Rotation"].as<glm::vec3>();
-					tc.Scale = entity["TransformComponent"]["Scale"].as<glm::vec3>();
-				}
-
-				if (entity["CameraComponent"])
-				{
-					auto& cc = deserializedEntity.AddComponent<CameraComponent>();
-					auto& cameraProps = entity["CameraComponent"]["Camera"];
-					cc.camera.SetProjectionType((ProjectionType)cameraProps["ProjectionType"].as<int>());
-					cc.camera.SetPerspectiveFOV(cameraProps["Perspective FOV"].as<float>());
-					cc.camera.SetPerspectiveNear(cameraProps["PerspectiveNear"].as<float>());
-					cc.camera.SetPerspectiveFar(cameraProps["PerspectiveFar"].as<float>());
-					cc.camera.SetOrthographicSize(cameraProps["OrthographicSize"].as<float>());
-					cc.camera.SetOrthographicNear(cameraProps["OrthographicNear"].as<float>());
-					cc.camera.SetOrthographicFar(cameraProps["OrthographicFar"].as<float>());
-					cc.Primary = entity["CameraComponent"]["Primary"].as<bool>();
-					cc.FixedAspectRatio = entity["CameraComponent"]["FixedAspectRatio"].as<bool>();
-				}
-
-				if (entity["SpriteRendererComponent"])
-				{
-					auto& src = deserializedEntity.AddComponent<SpriteRendererComponent>();
-					src.Colour = entity["SpriteRendererComponent"]["Colour"].as<glm::vec4>();
-				}
-
-				if (entity["CircleRendererComponent"])
-				{
-					auto& src = deserializedEntity.AddComponent<CircleRendererComponent>();
-					src.Color = entity["CircleRendererComponent"]["Colour"].as<glm::vec4>();
-				}
-
-				if (entity["Rigidbody2DComponent"])
-					DeserialiseRigidbody2D(deserializedEntity, entity["Rigidbody2DComponent"]);
-
-				if (entity["BoxCollider2DComponent"])
-					DeserialiseBoxCollider2D(deserializedEntity, entity["BoxCollider2DComponent"]);
-
-				if (entity["CircleCollider2DComponent"])
-					DeserialiseCircleCollider2D(deserializedEntity, entity["CircleCollider2DComponent"]);
-
-				if (entity["AudioComponent"])
-					DeserialiseAudioComponent(deserializedEntity, entity["AudioComponent"]);
-
-				if (entity["PlayerControllerComponent"])
-				{
-					auto& pc = deserializedEntity.AddComponent<PlayerControllerComponent>();
-					pc.MoveForce = entity["PlayerControllerComponent"]["MoveForce"].as<float>();
-				}
+				ForEachComponent(AllComponents{}, [&](auto componentType)
+					{
+						using T = typename decltype(componentType)::Type;
+						if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+						{
+							if (const YAML::Node componentNode = entity[ComponentTraits<T>::Name])
+							{
+								// Tag and Transform already exist from CreateEntityWithID
+								T& deserializedComponent = deserializedEntity.HasComponent<T>() ? deserializedEntity.GetComponent<T>() : deserializedEntity.AddComponent<T>();
+								DeserialiseComponent(componentNode, deserializedComponent);
+							}
+						}
+					});
 			}
 		}
 		return true;
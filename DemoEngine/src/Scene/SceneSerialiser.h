@@ -8,9 +8,29 @@ namespace DemoEngine
 	public:
 		SceneSerialiser(const Ref<Scene>& scene);
 
+		static constexpr const char* TextExtension = ".demoengine";
+		static constexpr const char* BinaryExtension = ".demoenginebin";
+
+		// Pick YAML or binary from the file extension
 		void Serialise(const std::string& filePath); 
 		bool Deserialise(const std::string& filePath);
 
+		// Compact and much faster to load for large (generated) scenes, see SceneSerialiserBinary.cpp
+		void SerialiseBinary(const std::string& filePath);
+		bool DeserialiseBinary(const std::string& filePath);
+		// The same encoding in memory, e.g. embedded in an input recording. source names it in errors.
+		void SerialiseBinary(std::vector<uint8_t>& buffer);
+		bool DeserialiseBinary(const uint8_t* data, size_t size, const std::string& source);
+
+		// One entity's serialised components in the binary encoding, appended to buffer. Used by the
+		// editor's undo history; not a file format, as type indices are this build's.
+		static void SerialiseEntityBinary(Entity entity, std::vector<uint8_t>& buffer);
+		// Sets the entity's serialised components to exactly those encoded, adding and removing as needed
+		static bool DeserialiseEntityBinary(Entity entity, const uint8_t* data, size_t size);
+
+		static bool IsBinaryPath(const std::string& filePath);
+		static bool IsScenePath(const std::string& filePath);
+
 	private:
 		Ref<Scene> m_Scene;
 	};
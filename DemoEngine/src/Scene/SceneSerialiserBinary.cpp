@@ -0,0 +1,461 @@
+#include "DemoEngine_PCH.h"
+#include "SceneSerialiser.h"
+#include "Entity.h"
+#include "Components.h"
+#include "ComponentRegistry.h"
+#include "Core/HeapTracker.h"
+
+#include <cstring>
+#include <fstream>
+
+// Binary scene layout (little endian):
+//	"DESB", uint32 version
+//	uint32 component type count, then each type's name; entities refer to types by this index
+//	uint64 entity count, then per entity:
+//		uint64 UUID, uint8 component count, then per component: uint8 type, uint32 size, payload
+// Sizes let a reader skip component types it does not know, and bound each component's
+// payload: fields an older writer did not have keep their defaults.
+
+namespace DemoEngine
+{
+	static constexpr char s_BinaryMagic[4] = { 'D', 'E', 'S', 'B' };
+	static constexpr uint32_t s_BinaryVersion = 1;
+
+	class BinaryWriter
+	{
+	public:
+		BinaryWriter() : m_Buffer(m_Storage) {}
+		BinaryWriter(std::vector<uint8_t>& buffer) : m_Buffer(buffer) {} // Appends to buffer
+
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+			m_Buffer.insert(m_Buffer.end(), bytes, bytes + sizeof(T));
+		}
+
+		void WriteString(const std::string& value)
+		{
+			Write((uint32_t)value.size());
+			m_Buffer.insert(m_Buffer.end(), value.begin(), value.end());
+		}
+
+		// Reserves room for a size written later with PatchSize
+		size_t BeginSize() { Write(uint32_t(0)); return m_Buffer.size(); }
+		void PatchSize(size_t start)
+		{
+			uint32_t size = (uint32_t)(m_Buffer.size() - start);
+			std::memcpy(m_Buffer.data() + start - sizeof(uint32_t), &size, sizeof(uint32_t));
+		}
+
+		const std::vector<uint8_t>& GetBuffer() const { return m_Buffer; }
+
+	private:
+		std::vector<uint8_t> m_Storage;
+		std::vector<uint8_t>& m_Buffer;
+	};
+
+	// Reads past the end fail softly: IsValid turns false, Read<T>() returns zero, and
+	// Read(value) and ReadOr leave the destination as it was
+	class BinaryReader
+	{
+	public:
+		BinaryReader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+		template<typename T>
+		T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T value{};
+			if (Require(sizeof(T)))
+			{
+				std::memcpy(&value, m_Data + m_Offset, sizeof(T));
+				m_Offset += sizeof(T);
+			}
+			return value;
+		}
+
+		template<typename T>
+		void Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			if (Require(sizeof(T)))
+			{
+				std::memcpy(&value, m_Data + m_Offset, sizeof(T));
+				m_Offset += sizeof(T);
+			}
+		}
+
+		template<typename T>
+		T ReadOr(T fallback)
+		{
+			Read(fallback);
+			return fallback;
+		}
+
+		void Read(std::string& value)
+		{
+			size_t offset = m_Offset;
+			uint32_t size = Read<uint32_t>();
+			if (!Require(size))
+			{
+				m_Offset = offset;
+				return;
+			}
+
+			value.assign(reinterpret_cast<const char*>(m_Data + m_Offset), size);
+			m_Offset += size;
+		}
+
+		std::string ReadString()
+		{
+			uint32_t size = Read<uint32_t>();
+			if (!Require(size))
+				return {};
+
+			std::string value(reinterpret_cast<const char*>(m_Data + m_Offset), size);
+			m_Offset += size;
+			return value;
+		}
+
+		void Skip(size_t size) { if (Require(size)) m_Offset += size; }
+
+		// Reader over the next size bytes, which this one steps past. Reads beyond the
+		// block's end fail without touching what follows it.
+		BinaryReader ReadBlock(size_t size)
+		{
+			if (!Require(size))
+				return BinaryReader(m_Data, 0);
+
+			BinaryReader block(m_Data + m_Offset, size);
+			m_Offset += size;
+			return block;
+		}
+
+		size_t GetOffset() const { return m_Offset; }
+		bool IsValid() const { return m_Valid; }
+
+	private:
+		bool Require(size_t size)
+		{
+			if (m_Valid && size <= m_Size - m_Offset)
+				return true;
+
+			m_Valid = false;
+			return false;
+		}
+
+	private:
+		const uint8_t* m_Data;
+		size_t m_Size;
+		size_t m_Offset = 0;
+		bool m_Valid = true;
+	};
+
+	// Serialise/DeserialiseComponent for components flagged ComponentFlags_Serialised whose state
+	// their COMPONENT_LIST fields don't describe, mirroring the YAML ones in SceneSerialiser.cpp.
+	// Append fields only (here or in COMPONENT_LIST), reading them with Read(value) or ReadOr so
+	// older files keep the defaults, or bump s_BinaryVersion.
+
+	static void SerialiseComponent(BinaryWriter& out, const CameraComponent& cc)
+	{
+		auto& camera = cc.camera;
+		out.Write((int32_t)camera.GetProjectionType());
+		out.Write(camera.GetPerspectiveFOV());
+		out.Write(camera.GetPerspectiveNear());
+		out.Write(camera.GetPerspectiveFar());
+		out.Write(camera.GetOrthographicSize());
+		out.Write(camera.GetOrthographicNear());
+		out.Write(camera.GetOrthographicFar());
+		out.Write(cc.Primary);
+		out.Write(cc.FixedAspectRatio);
+	}
+
+	static void DeserialiseComponent(BinaryReader& in, CameraComponent& cc)
+	{
+		auto& camera = cc.camera;
+		camera.SetProjectionType((ProjectionType)in.ReadOr((int32_t)camera.GetProjectionType()));
+		camera.SetPerspectiveFOV(in.ReadOr(camera.GetPerspectiveFOV()));
+		camera.SetPerspectiveNear(in.ReadOr(camera.GetPerspectiveNear()));
+		camera.SetPerspectiveFar(in.ReadOr(camera.GetPerspectiveFar()));
+		camera.SetOrthographicSize(in.ReadOr(camera.GetOrthographicSize()));
+		camera.SetOrthographicNear(in.ReadOr(camera.GetOrthographicNear()));
+		camera.SetOrthographicFar(in.ReadOr(camera.GetOrthographicFar()));
+		in.Read(cc.Primary);
+		in.Read(cc.FixedAspectRatio);
+	}
+
+	static void SerialiseComponent(BinaryWriter& out, const Rigidbody2DComponent& rb)
+	{
+		out.Write((int32_t)rb.BodyType);
+		out.Write(rb.FixedRotation);
+		out.Write(rb.AffectedbyGravity);
+		out.Write(rb.Mass.mass);
+		out.Write(rb.Mass.center);
+		out.Write(rb.Mass.rotationalInertia);
+	}
+
+	static void DeserialiseComponent(BinaryReader& in, Rigidbody2DComponent& rb)
+	{
+		rb.BodyType = (b2BodyType)in.ReadOr((int32_t)rb.BodyType);
+		in.Read(rb.FixedRotation);
+		in.Read(rb.AffectedbyGravity);
+		rb.Mass.mass = glm::max(0.0f, in.ReadOr(rb.Mass.mass));
+		in.Read(rb.Mass.center);
+		rb.Mass.rotationalInertia = glm::max(0.0f, in.ReadOr(rb.Mass.rotationalInertia));
+	}
+
+	// Fields in COMPONENT_LIST order
+	template<typename T>
+	static void SerialiseComponent(BinaryWriter& out, const T& component)
+	{
+		static_assert(HasComponentFields<T>(), "Give the component fields in COMPONENT_LIST or a SerialiseComponent overload");
+		ForEachField<T>([&](const auto& field)
+			{
+				using Member = typename std::decay_t<decltype(field)>::Type;
+				if constexpr (std::is_same_v<Member, std::string>)
+					out.WriteString(component.*field.Pointer);
+				else
+					out.Write(component.*field.Pointer);
+			});
+	}
+
+	template<typename T>
+	static void DeserialiseComponent(BinaryReader& in, T& component)
+	{
+		static_assert(HasComponentFields<T>(), "Give the component fields in COMPONENT_LIST or a DeserialiseComponent overload");
+		ForEachField<T>([&](const auto& field)
+			{
+				in.Read(component.*field.Pointer);
+			});
+	}
+
+	// Names of the serialised component types, in AllComponents order
+	static std::vector<std::string> GetSerialisedComponentNames()
+	{
+		std::vector<std::string> names;
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+					names.push_back(ComponentTraits<T>::Name);
+			});
+		return names;
+	}
+
+	// uint8 component count, then per component: uint8 type, uint32 size, payload
+	static void SerialiseComponents(BinaryWriter& out, SceneRegistry& registry, entt::entity entityID)
+	{
+		uint8_t count = 0;
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+					count += registry.all_of<T>(entityID) ? 1 : 0;
+			});
+		out.Write(count);
+
+		uint8_t typeIndex = 0;
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+				{
+					if (registry.all_of<T>(entityID))
+					{
+						out.Write(typeIndex);
+						size_t start = out.BeginSize();
+						SerialiseComponent(out, registry.get<T>(entityID));
+						out.PatchSize(start);
+					}
+					typeIndex++;
+				}
+			});
+	}
+
+	void SceneSerialiser::SerialiseBinary(const std::string& filePath)
+	{
+		std::vector<uint8_t> buffer;
+		SerialiseBinary(buffer);
+
+		std::ofstream fout(filePath, std::ios::binary | std::ios::trunc);
+		if (!fout.is_open())
+		{
+			LOG_ERROR("Could not open scene file '{0}' for writing", filePath);
+			return;
+		}
+
+		fout.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+		LOG_INFO("Binary scene saved to '{0}' ({1} entities, {2} KB)", filePath, m_Scene->m_Registry.view<IDComponent>().size(), buffer.size() / 1024);
+	}
+
+	void SceneSerialiser::SerialiseBinary(std::vector<uint8_t>& buffer)
+	{
+		MemoryTagScope memoryTag(MemoryTag::Serialisation);
+
+		BinaryWriter out(buffer);
+		out.Write(s_BinaryMagic);
+		out.Write(s_BinaryVersion);
+
+		std::vector<std::string> names = GetSerialisedComponentNames();
+		out.Write((uint32_t)names.size());
+		for (const std::string& name : names)
+			out.WriteString(name);
+
+		auto& registry = m_Scene->m_Registry;
+		auto view = registry.view<IDComponent>();
+		out.Write((uint64_t)view.size());
+
+		for (auto entityID : view)
+		{
+			Entity entity = { entityID, m_Scene.get() };
+			out.Write((uint64_t)entity.GetUUID());
+
+			SerialiseComponents(out, registry, entityID);
+		}
+	}
+
+	bool SceneSerialiser::DeserialiseBinary(const std::string& filePath)
+	{
+		MemoryTagScope memoryTag(MemoryTag::Serialisation);
+
+		std::ifstream stream(filePath, std::ios::binary | std::ios::ate);
+		if (!stream.is_open())
+			return false;
+
+		std::vector<uint8_t> buffer((size_t)stream.tellg());
+		stream.seekg(0);
+		stream.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+
+		return DeserialiseBinary(buffer.data(), buffer.size(), filePath);
+	}
+
+	bool SceneSerialiser::DeserialiseBinary(const uint8_t* data, size_t size, const std::string& source)
+	{
+		MemoryTagScope memoryTag(MemoryTag::Serialisation);
+
+		BinaryReader in(data, size);
+
+		char magic[4];
+		for (char& c : magic)
+			in.Read(c);
+		uint32_t version = in.Read<uint32_t>();
+		if (!in.IsValid() || std::memcmp(magic, s_BinaryMagic, sizeof(magic)) != 0 || version > s_BinaryVersion)
+		{
+			LOG_ERROR("'{0}' is not a binary scene this version can read", source);
+			return false;
+		}
+
+		// Map the file's type indices onto ours; unknown types are skipped
+		std::vector<std::string> names = GetSerialisedComponentNames();
+		std::vector<int> localIndex(in.Read<uint32_t>(), -1);
+		for (int& index : localIndex)
+		{
+			auto it = std::find(names.begin(), names.end(), in.ReadString());
+			if (it != names.end())
+				index = (int)(it - names.begin());
+		}
+
+		uint64_t entityCount = in.Read<uint64_t>();
+
+		for (uint64_t i = 0; i < entityCount && in.IsValid(); i++)
+		{
+			uint64_t uuid = in.Read<uint64_t>();
+			Entity deserializedEntity = m_Scene->CreateEntityWithID(uuid);
+
+			uint8_t count = in.Read<uint8_t>();
+			for (uint8_t c = 0; c < count && in.IsValid(); c++)
+			{
+				uint8_t fileIndex = in.Read<uint8_t>();
+				uint32_t size = in.Read<uint32_t>();
+
+				// A payload running past the end of the file is corrupt, and fails the whole read below
+				BinaryReader payload = in.ReadBlock(size);
+				if (!in.IsValid())
+					break;
+
+				int target = fileIndex < localIndex.size() ? localIndex[fileIndex] : -1;
+				int typeIndex = 0;
+				ForEachComponent(AllComponents{}, [&](auto componentType)
+					{
+						using T = typename decltype(componentType)::Type;
+						if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+						{
+							if (typeIndex++ == target)
+							{
+								// Tag and Transform already exist from CreateEntityWithID. A short payload
+								// is from an older writer, and the fields it lacks keep their defaults.
+								T& component = deserializedEntity.HasComponent<T>() ? deserializedEntity.GetComponent<T>() : deserializedEntity.AddComponent<T>();
+								DeserialiseComponent(payload, component);
+							}
+						}
+					});
+			}
+		}
+
+		if (!in.IsValid())
+		{
+			LOG_ERROR("Binary scene '{0}' is truncated", source);
+			return false;
+		}
+		return true;
+	}
+
+	void SceneSerialiser::SerialiseEntityBinary(Entity entity, std::vector<uint8_t>& buffer)
+	{
+		BinaryWriter out(buffer);
+		SerialiseComponents(out, entity.GetScene()->m_Registry, entity);
+	}
+
+	bool SceneSerialiser::DeserialiseEntityBinary(Entity entity, const uint8_t* data, size_t size)
+	{
+		BinaryReader in(data, size);
+		uint32_t present = 0; // Bit per serialised type index
+
+		uint8_t count = in.Read<uint8_t>();
+		for (uint8_t c = 0; c < count && in.IsValid(); c++)
+		{
+			uint8_t target = in.Read<uint8_t>();
+			BinaryReader payload = in.ReadBlock(in.Read<uint32_t>());
+
+			uint8_t typeIndex = 0;
+			ForEachComponent(AllComponents{}, [&](auto componentType)
+				{
+					using T = typename decltype(componentType)::Type;
+					if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+					{
+						if (typeIndex++ != target)
+							return;
+
+						if (!entity.HasComponent<T>())
+							entity.AddComponent<T>();
+
+						// Patched rather than written in place, so registry listeners see the change
+						entity.PatchComponent<T>([&](T& component) { DeserialiseComponent(payload, component); });
+						present |= 1u << target;
+					}
+				});
+
+			// Read past its own size: the encoding is corrupt, not from an older version
+			if (!payload.IsValid())
+				return false;
+		}
+
+		if (!in.IsValid())
+			return false;
+
+		// The encoding lists every serialised component, so anything missing from it was not there
+		uint8_t typeIndex = 0;
+		ForEachComponent(AllComponents{}, [&](auto componentType)
+			{
+				using T = typename decltype(componentType)::Type;
+				if constexpr (HasComponentFlag<T>(ComponentFlags_Serialised))
+				{
+					if (!(present & (1u << typeIndex++)) && entity.HasComponent<T>())
+						entity.RemoveComponent<T>();
+				}
+			});
+		return true;
+	}
+}
@@ -0,0 +1,355 @@
+#include "DemoEngine_PCH.h"
+#include "SpatialIndex.h"
+#include "Components.h"
+
+namespace DemoEngine
+{
+	// Fattening for tree bounds, so entities that jitter in place are not reinserted every frame
+	static constexpr float s_BoundsMargin = 0.1f;
+
+	static int ToUserData(entt::entity entity) { return (int)entt::to_integral(entity); }
+	static entt::entity FromUserData(int userData) { return (entt::entity)(uint32_t)userData; }
+
+	static bool Overlaps(const b2AABB& a, const b2AABB& b)
+	{
+		return a.lowerBound.x <= b.upperBound.x && b.lowerBound.x <= a.upperBound.x
+			&& a.lowerBound.y <= b.upperBound.y && b.lowerBound.y <= a.upperBound.y;
+	}
+
+	SpatialIndex::SpatialIndex(SceneRegistry& registry)
+		: m_Registry(registry), m_Tree(b2DynamicTree_Create())
+	{
+		m_Registry.on_construct<TransformComponent>().connect<&SpatialIndex::OnChanged>(*this);
+		m_Registry.on_update<TransformComponent>().connect<&SpatialIndex::OnChanged>(*this);
+		m_Registry.on_destroy<TransformComponent>().connect<&SpatialIndex::OnTransformDestroyed>(*this);
+
+		// The renderer components decide the shape and category
+		m_Registry.on_construct<SpriteRendererComponent>().connect<&SpatialIndex::OnChanged>(*this);
+		m_Registry.on_destroy<SpriteRendererComponent>().connect<&SpatialIndex::OnChanged>(*this);
+		m_Registry.on_construct<CircleRendererComponent>().connect<&SpatialIndex::OnChanged>(*this);
+		m_Registry.on_destroy<CircleRendererComponent>().connect<&SpatialIndex::OnChanged>(*this);
+
+		const ScenePool& transforms = m_Registry.storage<TransformComponent>();
+		m_Slots.reserve(transforms.size());
+		for (entt::entity entity : transforms)
+			OnChanged(m_Registry, entity);
+	}
+
+	SpatialIndex::~SpatialIndex()
+	{
+		m_Registry.on_construct<TransformComponent>().disconnect(this);
+		m_Registry.on_update<TransformComponent>().disconnect(this);
+		m_Registry.on_destroy<TransformComponent>().disconnect(this);
+		m_Registry.on_construct<SpriteRendererComponent>().disconnect(this);
+		m_Registry.on_destroy<SpriteRendererComponent>().disconnect(this);
+		m_Registry.on_construct<CircleRendererComponent>().disconnect(this);
+		m_Registry.on_destroy<CircleRendererComponent>().disconnect(this);
+
+		b2DynamicTree_Destroy(&m_Tree);
+	}
+
+	void SpatialIndex::QueryPoint(const glm::vec2& point, std::vector<entt::entity>& results, uint64_t mask)
+	{
+		Update();
+		results.clear();
+
+		struct Context { SpatialIndex* Index; glm::vec2 Point; uint64_t Mask; std::vector<entt::entity>* Results; };
+		Context context = { this, point, mask, &results };
+
+		b2AABB aabb = { { point.x, point.y }, { point.x, point.y } };
+		b2DynamicTree_Query(&m_Tree, aabb, mask, [](int, int userData, void* data)
+		{
+			Context& context = *(Context*)data;
+			entt::entity entity = FromUserData(userData);
+			if ((context.Index->FindSlot(entity)->Category & context.Mask) && context.Index->ContainsPoint(entity, context.Point))
+				context.Results->push_back(entity);
+			return true;
+		}, &context);
+	}
+
+	void SpatialIndex::QueryRect(const glm::vec2& min, const glm::vec2& max, std::vector<entt::entity>& results, uint64_t mask)
+	{
+		Update();
+		results.clear();
+
+		struct Context { SpatialIndex* Index; b2AABB Rect; uint64_t Mask; std::vector<entt::entity>* Results; };
+		Context context = { this, { { min.x, min.y }, { max.x, max.y } }, mask, &results };
+
+		b2DynamicTree_Query(&m_Tree, context.Rect, mask, [](int, int userData, void* data)
+		{
+			Context& context = *(Context*)data;
+			entt::entity entity = FromUserData(userData);
+			const Slot& slot = *context.Index->FindSlot(entity);
+			if ((slot.Category & context.Mask) && Overlaps(slot.Bounds, context.Rect))
+				context.Results->push_back(entity);
+			return true;
+		}, &context);
+	}
+
+	void SpatialIndex::QueryRadius(const glm::vec2& center, float radius, std::vector<entt::entity>& results, uint64_t mask)
+	{
+		Update();
+		results.clear();
+
+		struct Context { SpatialIndex* Index; glm::vec2 Center; float RadiusSquared; uint64_t Mask; std::vector<entt::entity>* Results; };
+		Context context = { this, center, radius * radius, mask, &results };
+
+		b2AABB aabb = { { center.x - radius, center.y - radius }, { center.x + radius, center.y + radius } };
+		b2DynamicTree_Query(&m_Tree, aabb, mask, [](int, int userData, void* data)
+		{
+			Context& context = *(Context*)data;
+			entt::entity entity = FromUserData(userData);
+			const Slot& slot = *context.Index->FindSlot(entity);
+
+			// Distance from the centre to the closest point of the bounds
+			glm::vec2 closest = glm::clamp(context.Center, glm::vec2(slot.Bounds.lowerBound.x, slot.Bounds.lowerBound.y),
+				glm::vec2(slot.Bounds.upperBound.x, slot.Bounds.upperBound.y));
+			glm::vec2 offset = closest - context.Center;
+			if ((slot.Category & context.Mask) && glm::dot(offset, offset) <= context.RadiusSquared)
+				context.Results->push_back(entity);
+			return true;
+		}, &context);
+	}
+
+	struct SpatialIndex::RayCastContext
+	{
+		SpatialIndex* Index;
+		glm::vec3 Origin, Direction;
+		float Start, End; // Part of the ray inside the indexed z range
+		uint64_t Mask;
+		SpatialRayHit Hit;
+	};
+
+	SpatialRayHit SpatialIndex::RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, uint64_t mask)
+	{
+		Update();
+
+		// Only the stretch of the ray inside the indexed z range can hit anything. The range is
+		// padded, as a flat scene would otherwise leave a zero-length stretch for rounding to miss.
+		float minZ = m_MinZ - 0.001f, maxZ = m_MaxZ + 0.001f;
+		float start = 0.0f, end = maxDistance;
+		if (std::abs(direction.z) > 1e-6f)
+		{
+			float a = (minZ - origin.z) / direction.z;
+			float b = (maxZ - origin.z) / direction.z;
+			start = std::max(start, std::min(a, b));
+			end = std::min(end, std::max(a, b));
+		}
+		else if (origin.z < minZ || origin.z > maxZ)
+			return {};
+
+		if (start > end)
+			return {};
+
+		SpatialRayHit hit;
+		hit.Distance = end;
+		RayCastContext context = { this, origin, direction, start, end, mask, hit };
+
+		glm::vec2 from = glm::vec2(origin + direction * start);
+		glm::vec2 to = glm::vec2(origin + direction * end);
+		glm::vec2 translation = to - from;
+
+		if (glm::dot(translation, translation) > 1e-8f)
+		{
+			// The 2D projection is linear in distance, so a hit clips the cast exactly
+			b2RayCastInput input = { { from.x, from.y }, { translation.x, translation.y }, 1.0f };
+			b2DynamicTree_RayCast(&m_Tree, &input, mask, [](const b2RayCastInput* input, int, int userData, void* data)
+			{
+				RayCastContext& context = *(RayCastContext*)data;
+				if (!context.Index->TestRayHit(context, FromUserData(userData)))
+					return input->maxFraction;
+				return (context.Hit.Distance - context.Start) / (context.End - context.Start);
+			}, &context);
+		}
+		else
+		{
+			// Looking straight down z: everything under the ray's footprint is a candidate
+			b2AABB aabb = { { std::min(from.x, to.x), std::min(from.y, to.y) }, { std::max(from.x, to.x), std::max(from.y, to.y) } };
+			b2DynamicTree_Query(&m_Tree, aabb, mask, [](int, int userData, void* data)
+			{
+				RayCastContext& context = *(RayCastContext*)data;
+				context.Index->TestRayHit(context, FromUserData(userData));
+				return true;
+			}, &context);
+		}
+
+		if (context.Hit)
+			context.Hit.Point = origin + direction * context.Hit.Distance;
+		else
+			context.Hit.Distance = 0.0f;
+		return context.Hit;
+	}
+
+	bool SpatialIndex::GetBounds(entt::entity entity, glm::vec2& min, glm::vec2& max)
+	{
+		Update();
+
+		const Slot* slot = FindSlot(entity);
+		if (!slot)
+			return false;
+
+		min = { slot->Bounds.lowerBound.x, slot->Bounds.lowerBound.y };
+		max = { slot->Bounds.upperBound.x, slot->Bounds.upperBound.y };
+		return true;
+	}
+
+	void SpatialIndex::GetDepthRange(float& minZ, float& maxZ)
+	{
+		Update();
+		minZ = m_MinZ;
+		maxZ = m_MaxZ;
+	}
+
+	void SpatialIndex::Update()
+	{
+		if (m_Pending.empty())
+			return;
+
+		PROFILE_FUNCTION();
+
+		for (entt::entity entity : m_Pending)
+		{
+			if (!m_Registry.valid(entity))
+				continue;
+
+			Slot& slot = m_Slots[entt::to_entity(entity)];
+			if (!slot.Queued)
+				continue;
+
+			slot.Queued = false;
+			Refresh(entity);
+		}
+		m_Pending.clear();
+	}
+
+	void SpatialIndex::OnChanged(SceneRegistry&, entt::entity entity)
+	{
+		uint32_t index = entt::to_entity(entity);
+		if (index >= m_Slots.size())
+			m_Slots.resize(index + 1);
+
+		// Each entity is queued once however often it changes before the next update
+		Slot& slot = m_Slots[index];
+		if (slot.Queued && slot.Entity == entity)
+			return;
+
+		slot.Entity = entity;
+		slot.Queued = true;
+		m_Pending.push_back(entity);
+	}
+
+	void SpatialIndex::OnTransformDestroyed(SceneRegistry&, entt::entity entity)
+	{
+		Remove(entity);
+	}
+
+	void SpatialIndex::Refresh(entt::entity entity)
+	{
+		const TransformComponent* transform = m_Registry.try_get<TransformComponent>(entity);
+		if (!transform)
+		{
+			Remove(entity);
+			return;
+		}
+
+		uint64_t category = m_Registry.all_of<SpriteRendererComponent>(entity) ? SpatialCategory_Sprite
+			: m_Registry.all_of<CircleRendererComponent>(entity) ? SpatialCategory_Circle : SpatialCategory_Other;
+
+		// World bounds of the unit quad both renderers draw into
+		glm::mat4 matrix = transform->GetTransform();
+		b2AABB bounds = { { FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX } };
+		for (glm::vec2 corner : { glm::vec2(-0.5f, -0.5f), glm::vec2(0.5f, -0.5f), glm::vec2(0.5f, 0.5f), glm::vec2(-0.5f, 0.5f) })
+		{
+			glm::vec3 world = glm::vec3(matrix * glm::vec4(corner, 0.0f, 1.0f));
+			bounds.lowerBound = { std::min(bounds.lowerBound.x, world.x), std::min(bounds.lowerBound.y, world.y) };
+			bounds.upperBound = { std::max(bounds.upperBound.x, world.x), std::max(bounds.upperBound.y, world.y) };
+			m_MinZ = std::min(m_MinZ, world.z);
+			m_MaxZ = std::max(m_MaxZ, world.z);
+		}
+
+		Slot& slot = m_Slots[entt::to_entity(entity)];
+		slot.Entity = entity;
+		slot.Bounds = bounds;
+
+		b2AABB fat = { { bounds.lowerBound.x - s_BoundsMargin, bounds.lowerBound.y - s_BoundsMargin },
+			{ bounds.upperBound.x + s_BoundsMargin, bounds.upperBound.y + s_BoundsMargin } };
+
+		// Category bits live in the tree node, so a new shape means a new proxy
+		if (slot.Proxy != -1 && slot.Category != category)
+		{
+			b2DynamicTree_DestroyProxy(&m_Tree, slot.Proxy);
+			slot.Proxy = -1;
+		}
+
+		if (slot.Proxy == -1)
+			slot.Proxy = b2DynamicTree_CreateProxy(&m_Tree, fat, category, ToUserData(entity));
+		else if (!b2AABB_Contains(b2DynamicTree_GetAABB(&m_Tree, slot.Proxy), bounds))
+			b2DynamicTree_MoveProxy(&m_Tree, slot.Proxy, fat);
+
+		slot.Category = category;
+	}
+
+	void SpatialIndex::Remove(entt::entity entity)
+	{
+		uint32_t index = entt::to_entity(entity);
+		if (index >= m_Slots.size() || m_Slots[index].Entity != entity)
+			return;
+
+		Slot& slot = m_Slots[index];
+		if (slot.Proxy != -1)
+			b2DynamicTree_DestroyProxy(&m_Tree, slot.Proxy);
+		slot = {};
+	}
+
+	SpatialIndex::Slot* SpatialIndex::FindSlot(entt::entity entity)
+	{
+		uint32_t index = entt::to_entity(entity);
+		if (index >= m_Slots.size() || m_Slots[index].Entity != entity || m_Slots[index].Proxy == -1)
+			return nullptr;
+		return &m_Slots[index];
+	}
+
+	bool SpatialIndex::IntersectShape(entt::entity entity, const glm::vec3& origin, const glm::vec3& direction, float& distance)
+	{
+		// Local (x, y) on the quad plane and distance t along the ray: T + x * X + y * Y = origin + t * direction
+		glm::mat4 matrix = m_Registry.get<TransformComponent>(entity).GetTransform();
+		glm::mat3 system(glm::vec3(matrix[0]), glm::vec3(matrix[1]), -direction);
+		if (std::abs(glm::determinant(system)) < 1e-12f)
+			return false;
+
+		glm::vec3 solution = glm::inverse(system) * (origin - glm::vec3(matrix[3]));
+		glm::vec2 local = { solution.x, solution.y };
+		distance = solution.z;
+
+		if (const auto* circle = m_Registry.try_get<CircleRendererComponent>(entity))
+		{
+			// Same ring as the circle shader, where the quad spans -1..1
+			float radius = glm::length(local) * 2.0f;
+			return radius <= 1.0f && radius >= 1.0f - circle->Thickness;
+		}
+		return std::abs(local.x) <= 0.5f && std::abs(local.y) <= 0.5f;
+	}
+
+	bool SpatialIndex::TestRayHit(RayCastContext& context, entt::entity entity)
+	{
+		const Slot* slot = FindSlot(entity);
+		float distance = 0.0f;
+		if (!slot || !(slot->Category & context.Mask) || !IntersectShape(entity, context.Origin, context.Direction, distance))
+			return false;
+
+		// Keeps the closest hit, as the depth test would
+		if (distance < context.Start || distance > context.Hit.Distance)
+			return false;
+
+		context.Hit.Entity = entity;
+		context.Hit.Distance = distance;
+		return true;
+	}
+
+	bool SpatialIndex::ContainsPoint(entt::entity entity, const glm::vec2& point)
+	{
+		// A ray straight down z through the point
+		float distance = 0.0f;
+		return IntersectShape(entity, { point.x, point.y, 0.0f }, { 0.0f, 0.0f, 1.0f }, distance);
+	}
+}
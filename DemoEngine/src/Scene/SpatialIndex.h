@@ -0,0 +1,97 @@
+#pragma once
+#include "SceneRegistry.h"
+#include <box2d/collision.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace DemoEngine
+{
+	// What an entity's bounds stand for; OR them together as a query mask
+	enum SpatialCategory : uint64_t
+	{
+		SpatialCategory_Sprite = 1 << 0,
+		SpatialCategory_Circle = 1 << 1,
+		SpatialCategory_Other = 1 << 2, // Transform only: cameras, audio sources, empties
+		SpatialCategory_Drawable = SpatialCategory_Sprite | SpatialCategory_Circle,
+		SpatialCategory_All = SpatialCategory_Drawable | SpatialCategory_Other
+	};
+
+	struct SpatialRayHit
+	{
+		entt::entity Entity = entt::null;
+		float Distance = 0.0f; // Along the ray, in multiples of its direction
+		glm::vec3 Point = { 0.0f, 0.0f, 0.0f };
+
+		explicit operator bool() const { return Entity != entt::null; }
+	};
+
+	// Box2D's dynamic AABB tree over the XY bounds of every entity with a transform. Each
+	// entity is the unit quad or circle the renderer draws, so point and ray queries agree
+	// with what is on screen. Changes arrive through registry signals and are applied before
+	// the next query; transform writes must go through patch (Entity::PatchComponent) to be seen.
+	class SpatialIndex
+	{
+	public:
+		SpatialIndex(SceneRegistry& registry);
+		~SpatialIndex();
+
+		SpatialIndex(const SpatialIndex&) = delete;
+		SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+		// Each query clears results first; the order is the tree's, not creation order
+
+		// Entities whose shape covers point
+		void QueryPoint(const glm::vec2& point, std::vector<entt::entity>& results, uint64_t mask = SpatialCategory_All);
+		// Entities whose bounds overlap the rectangle
+		void QueryRect(const glm::vec2& min, const glm::vec2& max, std::vector<entt::entity>& results, uint64_t mask = SpatialCategory_All);
+		// Entities whose bounds come within radius of center
+		void QueryRadius(const glm::vec2& center, float radius, std::vector<entt::entity>& results, uint64_t mask = SpatialCategory_All);
+		// Closest shape hit by the ray within maxDistance, e.g. from EditorCamera through the mouse
+		SpatialRayHit RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance = 1000.0f, uint64_t mask = SpatialCategory_All);
+
+		// World-space bounds as of the last update; false if the entity is not indexed
+		bool GetBounds(entt::entity entity, glm::vec2& min, glm::vec2& max);
+		// Lowest and highest z of anything indexed so far; the range never shrinks
+		void GetDepthRange(float& minZ, float& maxZ);
+
+		// Applies the changes recorded since the last call. Queries do this themselves.
+		void Update();
+
+		size_t GetCount() const { return (size_t)b2DynamicTree_GetProxyCount(&m_Tree); }
+		int GetHeight() const { return b2DynamicTree_GetHeight(&m_Tree); }
+
+	private:
+		struct Slot
+		{
+			entt::entity Entity = entt::null;
+			int Proxy = -1;
+			b2AABB Bounds = {}; // Tight; the tree holds a fattened copy
+			uint64_t Category = 0;
+			bool Queued = false;
+		};
+
+		void OnChanged(SceneRegistry&, entt::entity entity);
+		void OnTransformDestroyed(SceneRegistry&, entt::entity entity);
+
+		void Refresh(entt::entity entity);
+		void Remove(entt::entity entity);
+		Slot* FindSlot(entt::entity entity);
+
+		struct RayCastContext;
+		bool TestRayHit(RayCastContext& context, entt::entity entity);
+
+		// Solves for the local-space point of the entity's quad plane hit by the ray, then tests its shape
+		bool IntersectShape(entt::entity entity, const glm::vec3& origin, const glm::vec3& direction, float& distance);
+		bool ContainsPoint(entt::entity entity, const glm::vec2& point);
+
+	private:
+		SceneRegistry& m_Registry;
+		b2DynamicTree m_Tree;
+
+		std::vector<Slot> m_Slots; // By entity index
+		std::vector<entt::entity> m_Pending;
+
+		// Z range of everything indexed so far; bounds the 2D part of a ray cast
+		float m_MinZ = 0.0f, m_MaxZ = 0.0f;
+	};
+}
@@ -0,0 +1,191 @@
+#include "DemoEngine_PCH.h"
+#include "SystemScheduler.h"
+#include "Core/ThreadPool.h"
+#include "Core/FrameAllocator.h"
+#include "Core/HeapTracker.h"
+#include <condition_variable>
+#include <mutex>
+
+namespace DemoEngine
+{
+	SystemScheduler::SystemBuilder SystemScheduler::AddSystem(const std::string& name, SystemFunction function)
+	{
+		System& system = m_Systems.emplace_back();
+		system.Name = name;
+		system.ProfileName = Profiler::InternName(name);
+		system.Function = std::move(function);
+
+		m_Dirty = true;
+		return SystemBuilder(*this, m_Systems.size() - 1);
+	}
+
+	void SystemScheduler::Clear()
+	{
+		m_Systems.clear();
+		m_Dirty = true;
+	}
+
+	static bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b)
+	{
+		for (entt::id_type id : a)
+		{
+			if (std::find(b.begin(), b.end(), id) != b.end())
+				return true;
+		}
+		return false;
+	}
+
+	bool SystemScheduler::Conflicts(const System& a, const System& b)
+	{
+		if (a.Exclusive || b.Exclusive)
+			return true;
+
+		return Intersects(a.Writes, b.Writes) || Intersects(a.Writes, b.Reads) || Intersects(a.Reads, b.Writes);
+	}
+
+	void SystemScheduler::Build()
+	{
+		// Edges only point forward, so registration order is already a topological order
+		for (auto& system : m_Systems)
+		{
+			system.Dependents.clear();
+			system.DependencyCount = 0;
+		}
+
+		for (size_t i = 0; i < m_Systems.size(); i++)
+		{
+			for (size_t j = i + 1; j < m_Systems.size(); j++)
+			{
+				if (Conflicts(m_Systems[i], m_Systems[j]))
+				{
+					m_Systems[i].Dependents.push_back(j);
+					m_Systems[j].DependencyCount++;
+				}
+			}
+		}
+
+		m_Dirty = false;
+	}
+
+	void SystemScheduler::RunSystem(System& system, Scene& scene, Timestep ts, std::chrono::steady_clock::time_point frameStart)
+	{
+		PROFILE_SCOPE(system.ProfileName);
+
+		HeapCounters heapBefore = HeapTracker::GetThreadCounters();
+		auto start = std::chrono::steady_clock::now();
+		system.Function(scene, ts);
+		auto end = std::chrono::steady_clock::now();
+		HeapCounters heapAfter = HeapTracker::GetThreadCounters();
+
+		SystemStats& stats = system.Stats;
+		stats.LastTime = std::chrono::duration<float, std::milli>(end - start).count();
+		stats.AverageTime = stats.AverageTime == 0.0f ? stats.LastTime : stats.AverageTime + (stats.LastTime - stats.AverageTime) * 0.1f;
+		stats.StartOffset = std::chrono::duration<float, std::milli>(start - frameStart).count();
+		stats.Thread = ThreadPool::GetCurrentWorkerIndex() + 1;
+		stats.HeapAllocations = (uint32_t)(heapAfter.Allocations - heapBefore.Allocations);
+	}
+
+	void SystemScheduler::Run(Scene& scene, Timestep ts)
+	{
+		if (m_Dirty)
+			Build();
+
+		auto frameStart = std::chrono::steady_clock::now();
+
+		if (!m_Parallel || ThreadPool::GetWorkerCount() == 0)
+		{
+			for (auto& system : m_Systems)
+				RunSystem(system, scene, ts, frameStart);
+		}
+		else
+		{
+			// Per-frame bookkeeping lives in the calling thread's scratch arena, which scenes updated
+			// off the main thread may use too. Jobs capture a single pointer so std::function keeps
+			// them in its small buffer. Both vectors are reserved up front, so workers scheduling a
+			// dependent never allocate from an arena they do not own.
+			ScratchScope scratch;
+			struct RunState
+			{
+				SystemScheduler* Scheduler;
+				Scene* Target;
+				Timestep Step;
+				std::chrono::steady_clock::time_point FrameStart;
+
+				std::mutex Mutex;
+				std::condition_variable Finished;
+				ArenaVector<uint32_t> Remaining;
+				ArenaVector<size_t> MainThreadQueue;
+				size_t MainThreadNext = 0;
+				size_t FinishedCount = 0;
+
+				RunState(LinearArena& arena) : Remaining(arena), MainThreadQueue(arena) {}
+
+				// Called with Mutex held
+				void Schedule(size_t index)
+				{
+					if (Scheduler->m_Systems[index].MainThreadOnly)
+					{
+						MainThreadQueue.push_back(index);
+						return;
+					}
+
+					ThreadPool::Submit([this, index]()
+					{
+						Scheduler->RunSystem(Scheduler->m_Systems[index], *Target, Step, FrameStart);
+
+						std::lock_guard<std::mutex> lock(Mutex);
+						OnFinished(index);
+						Finished.notify_all();
+					});
+				}
+
+				void OnFinished(size_t index)
+				{
+					FinishedCount++;
+					for (size_t dependent : Scheduler->m_Systems[index].Dependents)
+					{
+						if (--Remaining[dependent] == 0)
+							Schedule(dependent);
+					}
+				}
+			} state(scratch.GetArena());
+
+			state.Scheduler = this;
+			state.Target = &scene;
+			state.Step = ts;
+			state.FrameStart = frameStart;
+
+			state.Remaining.reserve(m_Systems.size());
+			state.MainThreadQueue.reserve(m_Systems.size());
+			for (const auto& system : m_Systems)
+				state.Remaining.push_back(system.DependencyCount);
+
+			std::unique_lock<std::mutex> lock(state.Mutex);
+			for (size_t i = 0; i < m_Systems.size(); i++)
+			{
+				if (state.Remaining[i] == 0)
+					state.Schedule(i);
+			}
+
+			// The calling thread runs main-thread systems as they become ready
+			while (state.FinishedCount < m_Systems.size())
+			{
+				if (state.MainThreadNext == state.MainThreadQueue.size())
+				{
+					state.Finished.wait(lock);
+					continue;
+				}
+
+				size_t index = state.MainThreadQueue[state.MainThreadNext++];
+
+				lock.unlock();
+				RunSystem(m_Systems[index], scene, ts, frameStart);
+				lock.lock();
+
+				state.OnFinished(index);
+			}
+		}
+
+		m_LastFrameTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+	}
+}
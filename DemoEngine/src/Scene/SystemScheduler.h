@@ -0,0 +1,99 @@
+#pragma once
+#include "Core/Timestep.h"
+#include "entt.hpp"
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace DemoEngine
+{
+	class Scene;
+
+	using SystemFunction = std::function<void(Scene&, Timestep)>;
+
+	// Tags for shared state that does not live in a component. Systems declare them
+	// with Reads/Writes exactly like component types.
+	struct PhysicsWorldResource {};
+	struct NetworkResource {};
+
+	struct SystemStats
+	{
+		float LastTime = 0.0f; // ms
+		float AverageTime = 0.0f; // ms, exponential moving average
+		float StartOffset = 0.0f; // ms since the start of the frame
+		int Thread = 0; // 0 = main thread, otherwise worker index + 1
+		uint32_t HeapAllocations = 0; // Global heap allocations during the last run (see HeapTracker)
+	};
+
+	struct System
+	{
+		std::string Name;
+		const char* ProfileName = nullptr; // Interned copy of Name; profiler scopes outlive the system
+		SystemFunction Function;
+
+		std::vector<entt::id_type> Reads;
+		std::vector<entt::id_type> Writes;
+		bool MainThreadOnly = false; // e.g. anything touching GLFW or OpenGL
+		bool Exclusive = false; // Structural changes or arbitrary callbacks; runs alone
+
+		// Built by the scheduler: systems that must wait for this one
+		std::vector<size_t> Dependents;
+		uint32_t DependencyCount = 0;
+
+		SystemStats Stats;
+	};
+
+	// Runs the systems registered on a scene once per frame. Each system declares the
+	// components (and resources) it reads and writes; two systems conflict if either
+	// writes something the other touches. Conflicting systems run in registration
+	// order, everything else may run concurrently on the ThreadPool.
+	class SystemScheduler
+	{
+	public:
+		class SystemBuilder
+		{
+		public:
+			template<typename... T>
+			SystemBuilder& Reads() { (Get().Reads.push_back(entt::type_hash<T>::value()), ...); return *this; }
+			template<typename... T>
+			SystemBuilder& Writes() { (Get().Writes.push_back(entt::type_hash<T>::value()), ...); return *this; }
+
+			SystemBuilder& MainThreadOnly() { Get().MainThreadOnly = true; return *this; }
+			SystemBuilder& Exclusive() { Get().Exclusive = true; return *this; }
+
+		private:
+			SystemBuilder(SystemScheduler& scheduler, size_t index) : m_Scheduler(scheduler), m_Index(index) {}
+			System& Get() { m_Scheduler.m_Dirty = true; return m_Scheduler.m_Systems[m_Index]; }
+
+			SystemScheduler& m_Scheduler;
+			size_t m_Index;
+
+			friend class SystemScheduler;
+		};
+
+		// e.g. AddSystem("Movement", func).Reads<VelocityComponent>().Writes<TransformComponent>()
+		SystemBuilder AddSystem(const std::string& name, SystemFunction function);
+		void Clear();
+
+		void Run(Scene& scene, Timestep ts);
+
+		// When disabled every system runs on the calling thread, in registration order
+		void SetParallel(bool parallel) { m_Parallel = parallel; }
+		bool IsParallel() const { return m_Parallel; }
+
+		const std::vector<System>& GetSystems() const { return m_Systems; }
+		float GetLastFrameTime() const { return m_LastFrameTime; }
+
+	private:
+		void Build();
+		void RunSystem(System& system, Scene& scene, Timestep ts, std::chrono::steady_clock::time_point frameStart);
+		static bool Conflicts(const System& a, const System& b);
+
+	private:
+		std::vector<System> m_Systems;
+		bool m_Dirty = true;
+		bool m_Parallel = true;
+		float m_LastFrameTime = 0.0f;
+	};
+}
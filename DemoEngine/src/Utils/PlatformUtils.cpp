@@ -1,6 +1,9 @@
 #include "DemoEngine_PCH.h"
 #include "PlatformUtils.h"
 #include "Platform/Windows/WindowsPlatformUtils.h"
+#include <chrono>
+#include <ctime>
+#include <iomanip>
 
 namespace DemoEngine
 {
@@ -17,4 +20,31 @@ namespace DemoEngine
 		// // using approaches like 'switch' statements.
 		return WindowsFileDialogs::SaveFile(filter);
 	}
+
+	std::string LocalTime::Format(const char* format)
+	{
+		std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+
+		// std::localtime shares one buffer between threads
+		std::tm local = {};
+	#ifdef _WIN32
+		localtime_s(&local, &now);
+	#else
+		localtime_r(&now, &local);
+	#endif
+
+		std::stringstream out;
+		out << std::put_time(&local, format);
+		return out.str();
+	}
+
+	uint64_t ProcessMemory::GetWorkingSet()
+	{
+		return WindowsProcessMemory::GetWorkingSet();
+	}
+
+	uint64_t ProcessMemory::GetPrivateBytes()
+	{
+		return WindowsProcessMemory::GetPrivateBytes();
+	}
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once 
+#include <cstdint>
 #include <string>
 #include <stdio.h>
 #include <stdlib.h>
@@ -14,4 +15,19 @@ namespace DemoEngine
 		static std::string SaveFile(const char* filter);
 	};
 
+	// Local wall-clock time through std::put_time; the default format suits file names
+	class LocalTime
+	{
+	public:
+		static std::string Format(const char* format = "%Y%m%d_%H%M%S");
+	};
+
+	// Memory use of the whole process, in bytes (0 if unavailable)
+	class ProcessMemory
+	{
+	public:
+		static uint64_t GetWorkingSet();
+		static uint64_t GetPrivateBytes();
+	};
+
 }
\ No newline at end of file
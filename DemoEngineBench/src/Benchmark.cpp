@@ -0,0 +1,465 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "Utils/PlatformUtils.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <regex>
+#include <thread>
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <Windows.h>
+#endif
+
+namespace DemoEngine::Bench
+{
+	static constexpr int64_t MaxIterations = 1000000000;
+
+	static double RealSeconds()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Process time, so work handed to the thread pool is counted as well
+	static double CPUSeconds()
+	{
+	#ifdef _WIN32
+		FILETIME creation, exit, kernel, user;
+		GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+		auto toSeconds = [](const FILETIME& time) { return (double)(((uint64_t)time.dwHighDateTime << 32) | time.dwLowDateTime) * 1e-7; };
+		return toSeconds(kernel) + toSeconds(user);
+	#else
+		timespec time;
+		clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+		return time.tv_sec + time.tv_nsec * 1e-9;
+	#endif
+	}
+
+	void UseCharPointer(const volatile char*)
+	{
+	}
+
+	State::State(int64_t maxIterations, const std::vector<int64_t>& args)
+		: m_MaxIterations(maxIterations), m_Args(args)
+	{
+	}
+
+	void State::StartRunning()
+	{
+		ResumeTiming();
+	}
+
+	void State::FinishRunning()
+	{
+		if (m_Running)
+			PauseTiming();
+	}
+
+	void State::PauseTiming()
+	{
+		m_RealTime += RealSeconds() - m_RealStart;
+		m_CPUTime += CPUSeconds() - m_CPUStart;
+		m_Running = false;
+	}
+
+	void State::ResumeTiming()
+	{
+		m_Running = true;
+		m_CPUStart = CPUSeconds();
+		m_RealStart = RealSeconds();
+	}
+
+	struct RunResult
+	{
+		std::string Name;
+		int64_t Iterations = 0;
+		double RealTime = 0.0; // Per iteration, in the benchmark's unit
+		double CPUTime = 0.0;
+		double ItemsPerSecond = 0.0;
+		double BytesPerSecond = 0.0;
+		std::string Label;
+		std::string Error;
+		std::string AggregateName; // Empty for individual repetitions
+		uint32_t RepetitionIndex = 0;
+	};
+
+	struct Options
+	{
+		std::string Filter = ".";
+		uint32_t Repetitions = 1;
+		double MinTime = 0.5; // Seconds
+		std::string OutPath;
+		bool ListOnly = false;
+		std::vector<std::pair<std::string, std::string>> Context;
+	};
+
+	static std::vector<std::unique_ptr<Benchmark>>& GetRegistry()
+	{
+		static std::vector<std::unique_ptr<Benchmark>> registry;
+		return registry;
+	}
+
+	Benchmark* RegisterBenchmark(const std::string& name, Function function)
+	{
+		return GetRegistry().emplace_back(std::make_unique<Benchmark>(name, std::move(function))).get();
+	}
+
+	static const char* GetUnitName(TimeUnit unit)
+	{
+		switch (unit)
+		{
+			case TimeUnit::Nanosecond: return "ns";
+			case TimeUnit::Microsecond: return "us";
+			case TimeUnit::Millisecond: return "ms";
+		}
+		return "ns";
+	}
+
+	static double GetUnitScale(TimeUnit unit)
+	{
+		switch (unit)
+		{
+			case TimeUnit::Nanosecond: return 1e9;
+			case TimeUnit::Microsecond: return 1e6;
+			case TimeUnit::Millisecond: return 1e3;
+		}
+		return 1e9;
+	}
+
+	class Runner
+	{
+	public:
+		// Grows the iteration count until one run takes MinTime (on the wall clock), then
+		// repeats that run; the calibrated run counts as the first repetition
+		static std::vector<RunResult> Run(const Benchmark& benchmark, const std::string& name, const std::vector<int64_t>& args, const Options& options)
+		{
+			double minTime = benchmark.m_MinTime > 0.0 ? benchmark.m_MinTime : options.MinTime;
+			int64_t iterations = benchmark.m_Iterations ? benchmark.m_Iterations : 1;
+
+			std::vector<RunResult> results;
+			while (true)
+			{
+				State state(iterations, args);
+				benchmark.m_Function(state);
+
+				if (!state.m_Error.empty())
+				{
+					RunResult& result = results.emplace_back();
+					result.Name = name;
+					result.Error = state.m_Error;
+					return results;
+				}
+
+				if (benchmark.m_Iterations || state.m_RealTime >= minTime || iterations >= MaxIterations)
+				{
+					results.push_back(MakeResult(benchmark, name, state, 0));
+					break;
+				}
+
+				// Far too short runs only tell us the next try can be much longer
+				double multiplier = minTime * 1.4 / std::max(state.m_RealTime, 1e-9);
+				if (state.m_RealTime / minTime <= 0.1)
+					multiplier = std::min(multiplier, 10.0);
+
+				iterations = std::min(MaxIterations, std::max(iterations + 1, (int64_t)(iterations * multiplier)));
+			}
+
+			for (uint32_t repetition = 1; repetition < options.Repetitions; repetition++)
+			{
+				State state(iterations, args);
+				benchmark.m_Function(state);
+				results.push_back(MakeResult(benchmark, name, state, repetition));
+			}
+
+			return results;
+		}
+
+	private:
+		static RunResult MakeResult(const Benchmark& benchmark, const std::string& name, const State& state, uint32_t repetition)
+		{
+			double scale = GetUnitScale(benchmark.m_Unit);
+
+			RunResult result;
+			result.Name = name;
+			result.Iterations = state.m_MaxIterations;
+			result.RealTime = state.m_RealTime * scale / state.m_MaxIterations;
+			result.CPUTime = state.m_CPUTime * scale / state.m_MaxIterations;
+			result.ItemsPerSecond = state.m_ItemsProcessed && state.m_RealTime > 0.0 ? state.m_ItemsProcessed / state.m_RealTime : 0.0;
+			result.BytesPerSecond = state.m_BytesProcessed && state.m_RealTime > 0.0 ? state.m_BytesProcessed / state.m_RealTime : 0.0;
+			result.Label = state.m_Label;
+			result.RepetitionIndex = repetition;
+			return result;
+		}
+	};
+
+	static std::vector<RunResult> Aggregate(const std::vector<RunResult>& runs)
+	{
+		auto mean = [](std::vector<double> values)
+		{
+			double sum = 0.0;
+			for (double value : values)
+				sum += value;
+			return sum / values.size();
+		};
+		auto median = [](std::vector<double> values)
+		{
+			std::sort(values.begin(), values.end());
+			size_t middle = values.size() / 2;
+			return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) * 0.5;
+		};
+		auto stddev = [&mean](std::vector<double> values)
+		{
+			double average = mean(values), sum = 0.0;
+			for (double value : values)
+				sum += (value - average) * (value - average);
+			return std::sqrt(sum / (values.size() - 1));
+		};
+
+		std::vector<double> real, cpu, items, bytes;
+		for (const RunResult& run : runs)
+		{
+			real.push_back(run.RealTime);
+			cpu.push_back(run.CPUTime);
+			items.push_back(run.ItemsPerSecond);
+			bytes.push_back(run.BytesPerSecond);
+		}
+
+		std::vector<RunResult> aggregates;
+		auto add = [&](const char* name, const std::function<double(std::vector<double>)>& statistic)
+		{
+			RunResult& result = aggregates.emplace_back();
+			result.Name = runs[0].Name + "_" + name;
+			result.AggregateName = name;
+			result.Iterations = (int64_t)runs.size();
+			result.RealTime = statistic(real);
+			result.CPUTime = statistic(cpu);
+			result.ItemsPerSecond = statistic(items);
+			result.BytesPerSecond = statistic(bytes);
+		};
+		add("mean", mean);
+		add("median", median);
+		add("stddev", stddev);
+		return aggregates;
+	}
+
+	static std::string Escape(const std::string& text)
+	{
+		std::string escaped;
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+
+	static bool WriteJson(const std::string& path, const Options& options, const char* executable,
+		const std::vector<std::pair<const Benchmark*, RunResult>>& results)
+	{
+		std::filesystem::path filePath(path);
+		if (filePath.has_parent_path())
+			std::filesystem::create_directories(filePath.parent_path());
+
+		std::ofstream out(path, std::ios::trunc);
+		if (!out)
+			return false;
+
+		out << "{\n  \"context\": {\n";
+		out << "    \"date\": \"" << LocalTime::Format("%Y-%m-%dT%H:%M:%S") << "\",\n";
+		out << "    \"executable\": \"" << Escape(executable) << "\",\n";
+		out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+		for (const auto& [key, value] : options.Context)
+			out << "    \"" << Escape(key) << "\": \"" << Escape(value) << "\",\n";
+	#ifdef NDEBUG
+		out << "    \"library_build_type\": \"release\"\n";
+	#else
+		out << "    \"library_build_type\": \"debug\"\n";
+	#endif
+		out << "  },\n  \"benchmarks\": [";
+
+		out << std::setprecision(10);
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const auto& [benchmark, result] = results[i];
+			std::string runName = result.AggregateName.empty() ? result.Name : result.Name.substr(0, result.Name.size() - result.AggregateName.size() - 1);
+
+			out << (i ? ",\n" : "\n") << "    {\n";
+			out << "      \"name\": \"" << Escape(result.Name) << "\",\n";
+			out << "      \"run_name\": \"" << Escape(runName) << "\",\n";
+			if (result.AggregateName.empty())
+			{
+				out << "      \"run_type\": \"iteration\",\n";
+				out << "      \"repetitions\": " << options.Repetitions << ",\n";
+				out << "      \"repetition_index\": " << result.RepetitionIndex << ",\n";
+			}
+			else
+			{
+				out << "      \"run_type\": \"aggregate\",\n";
+				out << "      \"repetitions\": " << options.Repetitions << ",\n";
+				out << "      \"aggregate_name\": \"" << result.AggregateName << "\",\n";
+			}
+			out << "      \"threads\": 1,\n";
+
+			if (!result.Error.empty())
+			{
+				out << "      \"error_occurred\": true,\n";
+				out << "      \"error_message\": \"" << Escape(result.Error) << "\"\n    }";
+				continue;
+			}
+
+			out << "      \"iterations\": " << result.Iterations << ",\n";
+			out << "      \"real_time\": " << result.RealTime << ",\n";
+			out << "      \"cpu_time\": " << result.CPUTime << ",\n";
+			if (result.ItemsPerSecond > 0.0)
+				out << "      \"items_per_second\": " << result.ItemsPerSecond << ",\n";
+			if (result.BytesPerSecond > 0.0)
+				out << "      \"bytes_per_second\": " << result.BytesPerSecond << ",\n";
+			if (!result.Label.empty())
+				out << "      \"label\": \"" << Escape(result.Label) << "\",\n";
+			out << "      \"time_unit\": \"" << GetUnitName(benchmark->GetUnit()) << "\"\n    }";
+		}
+		out << "\n  ]\n}\n";
+
+		return out.good();
+	}
+
+	static void PrintResult(const Benchmark& benchmark, const RunResult& result)
+	{
+		if (!result.Error.empty())
+		{
+			printf("%-48s ERROR OCCURRED: '%s'\n", result.Name.c_str(), result.Error.c_str());
+			return;
+		}
+
+		const char* unit = GetUnitName(benchmark.GetUnit());
+		printf("%-48s %10.3f %-2s %10.3f %-2s %12lld", result.Name.c_str(), result.RealTime, unit, result.CPUTime, unit, (long long)result.Iterations);
+		if (result.ItemsPerSecond > 0.0)
+			printf(" items_per_second=%.4gM/s", result.ItemsPerSecond * 1e-6);
+		if (result.BytesPerSecond > 0.0)
+			printf(" bytes_per_second=%.4gMiB/s", result.BytesPerSecond / (1024.0 * 1024.0));
+		if (!result.Label.empty())
+			printf(" %s", result.Label.c_str());
+		printf("\n");
+		fflush(stdout);
+	}
+
+	static bool ParseFlag(const std::string& arg, const char* flag, std::string& value)
+	{
+		std::string prefix = std::string("--") + flag + "=";
+		if (arg.compare(0, prefix.size(), prefix) != 0)
+			return false;
+
+		value = arg.substr(prefix.size());
+		return true;
+	}
+
+	int RunBenchmarks(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; i++)
+		{
+			std::string arg = argv[i], value;
+			if (ParseFlag(arg, "benchmark_filter", value))
+				options.Filter = value;
+			else if (ParseFlag(arg, "benchmark_repetitions", value))
+				options.Repetitions = (uint32_t)std::max(1, std::atoi(value.c_str()));
+			else if (ParseFlag(arg, "benchmark_min_time", value))
+				options.MinTime = std::atof(value.c_str()); // Accepts "0.5" and "0.5s"
+			else if (ParseFlag(arg, "benchmark_out", value))
+				options.OutPath = value;
+			else if (ParseFlag(arg, "benchmark_context", value) && value.find('=') != std::string::npos)
+				options.Context.emplace_back(value.substr(0, value.find('=')), value.substr(value.find('=') + 1));
+			else if (arg == "--benchmark_list_tests")
+				options.ListOnly = true;
+			else
+			{
+				LOG_ERROR("Unknown argument '{0}'", arg);
+				return 1;
+			}
+		}
+
+		std::regex filter;
+		try { filter = std::regex(options.Filter); }
+		catch (const std::regex_error&)
+		{
+			LOG_ERROR("Invalid --benchmark_filter '{0}'", options.Filter);
+			return 1;
+		}
+
+		// Every arg set becomes its own instance, named like google-benchmark's "BM_Name/1000"
+		std::vector<std::tuple<const Benchmark*, std::string, std::vector<int64_t>>> instances;
+		for (const auto& benchmark : GetRegistry())
+		{
+			std::vector<std::vector<int64_t>> argSets = benchmark->GetArgSets();
+			if (argSets.empty())
+				argSets.emplace_back();
+
+			for (const auto& args : argSets)
+			{
+				std::string name = benchmark->GetName();
+				for (int64_t arg : args)
+					name += "/" + std::to_string(arg);
+
+				if (std::regex_search(name, filter))
+					instances.emplace_back(benchmark.get(), name, args);
+			}
+		}
+
+		if (options.ListOnly)
+		{
+			for (const auto& [benchmark, name, args] : instances)
+				printf("%s\n", name.c_str());
+			return 0;
+		}
+
+		if (instances.empty())
+		{
+			LOG_ERROR("No benchmark matches '{0}'", options.Filter);
+			return 1;
+		}
+
+		if (options.OutPath.empty())
+		{
+			options.OutPath = "Benchmarks/Bench_" + LocalTime::Format() + ".json";
+		}
+
+		printf("%-48s %13s %13s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+		printf("%s\n", std::string(90, '-').c_str());
+
+		std::vector<std::pair<const Benchmark*, RunResult>> results;
+		bool failed = false;
+		for (const auto& [benchmark, name, args] : instances)
+		{
+			std::vector<RunResult> runs = Runner::Run(*benchmark, name, args, options);
+			for (const RunResult& run : runs)
+			{
+				PrintResult(*benchmark, run);
+				results.emplace_back(benchmark, run);
+				failed |= !run.Error.empty();
+			}
+
+			if (runs.size() > 1)
+			{
+				for (const RunResult& aggregate : Aggregate(runs))
+				{
+					PrintResult(*benchmark, aggregate);
+					results.emplace_back(benchmark, aggregate);
+				}
+			}
+		}
+
+		if (!WriteJson(options.OutPath, options, argv[0], results))
+		{
+			LOG_ERROR("Could not write benchmark results to '{0}'", options.OutPath);
+			return 1;
+		}
+
+		printf("\nResults written to '%s'\n", options.OutPath.c_str());
+		return failed ? 1 : 0;
+	}
+}
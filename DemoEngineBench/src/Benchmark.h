@@ -0,0 +1,147 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+// Small in-repo benchmark harness following google-benchmark's API and JSON output,
+// so results can be compared with the usual tooling (e.g. compare.py) between commits:
+//
+//	static void BM_Something(Bench::State& state)
+//	{
+//		// Setup
+//		for (auto _ : state)
+//			Bench::DoNotOptimize(Work(state.range(0)));
+//	}
+//	BENCHMARK(BM_Something)->Arg(1000)->Arg(10000);
+
+namespace DemoEngine::Bench
+{
+	enum class TimeUnit { Nanosecond, Microsecond, Millisecond };
+
+	class State
+	{
+	public:
+		State(int64_t maxIterations, const std::vector<int64_t>& args);
+
+		struct Value {};
+		struct Iterator
+		{
+			State* Parent;
+			int64_t Remaining;
+
+			Value operator*() const { return {}; }
+			void operator++() { Remaining--; }
+			bool operator!=(const Iterator&)
+			{
+				if (Remaining != 0)
+					return true;
+				Parent->FinishRunning();
+				return false;
+			}
+		};
+
+		// The timer runs from begin() until the loop exits
+		Iterator begin() { StartRunning(); return { this, m_MaxIterations }; }
+		Iterator end() { return { this, 0 }; }
+
+		int64_t range(size_t index = 0) const { return m_Args[index]; }
+		int64_t iterations() const { return m_MaxIterations; }
+
+		// Excludes per-iteration setup or teardown from the measurement
+		void PauseTiming();
+		void ResumeTiming();
+
+		void SetItemsProcessed(int64_t items) { m_ItemsProcessed = items; }
+		void SetBytesProcessed(int64_t bytes) { m_BytesProcessed = bytes; }
+		void SetLabel(const std::string& label) { m_Label = label; }
+		void SkipWithError(const std::string& error) { m_Error = error; }
+
+	private:
+		void StartRunning();
+		void FinishRunning();
+
+	private:
+		int64_t m_MaxIterations;
+		std::vector<int64_t> m_Args;
+
+		bool m_Running = false;
+		double m_RealStart = 0.0, m_CPUStart = 0.0;
+		double m_RealTime = 0.0, m_CPUTime = 0.0;
+
+		int64_t m_ItemsProcessed = 0;
+		int64_t m_BytesProcessed = 0;
+		std::string m_Label;
+		std::string m_Error;
+
+		friend class Runner;
+	};
+
+	using Function = std::function<void(State&)>;
+
+	class Benchmark
+	{
+	public:
+		Benchmark(const std::string& name, Function function) : m_Name(name), m_Function(std::move(function)) {}
+
+		Benchmark* Arg(int64_t arg) { m_ArgSets.push_back({ arg }); return this; }
+		Benchmark* Args(const std::vector<int64_t>& args) { m_ArgSets.push_back(args); return this; }
+		Benchmark* Unit(TimeUnit unit) { m_Unit = unit; return this; }
+		Benchmark* MinTime(double seconds) { m_MinTime = seconds; return this; }
+		Benchmark* Iterations(int64_t iterations) { m_Iterations = iterations; return this; }
+
+		const std::string& GetName() const { return m_Name; }
+		const std::vector<std::vector<int64_t>>& GetArgSets() const { return m_ArgSets; }
+		TimeUnit GetUnit() const { return m_Unit; }
+
+	private:
+		std::string m_Name;
+		Function m_Function;
+		std::vector<std::vector<int64_t>> m_ArgSets;
+		TimeUnit m_Unit = TimeUnit::Nanosecond;
+		double m_MinTime = 0.0; // Seconds; 0 uses the command line default
+		int64_t m_Iterations = 0; // Fixed count instead of calibrating
+
+		friend class Runner;
+	};
+
+	Benchmark* RegisterBenchmark(const std::string& name, Function function);
+
+	// Parses --benchmark_* flags, runs everything that matches and writes the JSON report.
+	// Returns the process exit code.
+	int RunBenchmarks(int argc, char** argv);
+
+	void UseCharPointer(const volatile char* pointer);
+
+	// Keeps the compiler from discarding a computed value
+	template<typename T>
+	inline void DoNotOptimize(T&& value)
+	{
+#if defined(_MSC_VER)
+		UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "g"(&value) : "memory");
+#endif
+	}
+
+	inline void ClobberMemory()
+	{
+#if defined(_MSC_VER)
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+}
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+
+#define BENCHMARK(function) \
+	static ::DemoEngine::Bench::Benchmark* BENCHMARK_CONCAT(s_Benchmark_, __LINE__) = \
+		::DemoEngine::Bench::RegisterBenchmark(#function, function)
@@ -0,0 +1,34 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "Core/FrameAllocator.h"
+#include "Core/Input.h"
+#include "Core/ThreadPool.h"
+#include "Scene/Scene.h"
+#include "Renderer/2D/Renderer2D.h"
+
+// Runs the engine benchmarks without a window or GPU; see Benchmark.h for the flags.
+// Results go to Benchmarks/Bench_<timestamp>.json unless --benchmark_out is given.
+int main(int argc, char** argv)
+{
+	DemoEngine::Log::Init();
+	DemoEngine::Profiler::Init();
+
+	// Scene loads and saves log every call; keep the results table readable
+	DemoEngine::Log::GetLogger()->set_level(spdlog::level::warn);
+
+	DemoEngine::ThreadPool::Init();
+	DemoEngine::FrameAllocator::Init();
+	DemoEngine::Input::Init();
+	DemoEngine::Scene::InitPhysicsAllocator();
+	DemoEngine::Renderer2D::Init(DemoEngine::RendererBackend::Null);
+
+	int result = DemoEngine::Bench::RunBenchmarks(argc, argv);
+
+	DemoEngine::Renderer2D::Shutdown();
+	DemoEngine::FrameAllocator::Shutdown();
+	DemoEngine::ThreadPool::Shutdown();
+
+	DemoEngine::Profiler::Shutdown();
+	DemoEngine::Log::Shutdown();
+	return result;
+}
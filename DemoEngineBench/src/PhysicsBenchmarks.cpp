@@ -0,0 +1,49 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include <box2d/box2d.h>
+
+namespace DemoEngine::Bench
+{
+	// Raw Box2D cost for a settled pile of boxes, without the scene's component sync
+	static void BM_Box2DStep(State& state)
+	{
+		int count = (int)state.range(0);
+
+		b2WorldDef worldDef = b2DefaultWorldDef();
+		worldDef.gravity = { 0.0f, -9.8f };
+		worldDef.enableSleep = false; // Keep every body awake so each step costs the same
+		b2WorldId world = b2CreateWorld(&worldDef);
+
+		int columns = 100;
+		float width = columns * 1.5f;
+
+		b2BodyDef groundDef = b2DefaultBodyDef();
+		b2BodyId ground = b2CreateBody(world, &groundDef);
+		b2ShapeDef groundShape = b2DefaultShapeDef();
+		b2Polygon groundBox = b2MakeOffsetBox(width, 1.0f, { width * 0.5f, -1.0f }, b2Rot_identity);
+		b2CreatePolygonShape(ground, &groundShape, &groundBox);
+
+		b2Polygon box = b2MakeBox(0.5f, 0.5f);
+		b2ShapeDef shapeDef = b2DefaultShapeDef();
+		for (int i = 0; i < count; i++)
+		{
+			b2BodyDef bodyDef = b2DefaultBodyDef();
+			bodyDef.type = b2_dynamicBody;
+			bodyDef.position = { (i % columns) * 1.5f, 0.5f + (i / columns) * 1.1f };
+			b2BodyId body = b2CreateBody(world, &bodyDef);
+			b2CreatePolygonShape(body, &shapeDef, &box);
+		}
+
+		// Let the stacks come to rest first
+		for (int i = 0; i < 120; i++)
+			b2World_Step(world, 1.0f / 60.0f, 4);
+
+		for (auto _ : state)
+			b2World_Step(world, 1.0f / 60.0f, 4);
+
+		state.SetLabel(std::to_string(b2World_GetCounters(world).contactCount) + " contacts");
+		state.SetItemsProcessed(state.iterations() * count);
+		b2DestroyWorld(world);
+	}
+	BENCHMARK(BM_Box2DStep)->Arg(1000)->Arg(10000)->Unit(TimeUnit::Microsecond);
+}
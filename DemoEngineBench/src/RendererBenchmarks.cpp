@@ -0,0 +1,58 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "Renderer/2D/Renderer2D.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace DemoEngine::Bench
+{
+	// Renderer2D runs on the null backend (see Main.cpp), so this measures batch building only
+	static std::vector<glm::mat4> MakeTransforms(size_t count)
+	{
+		std::vector<glm::mat4> transforms(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			glm::vec3 position = { (float)(i % 1000), (float)(i / 1000), 0.0f };
+			transforms[i] = glm::translate(glm::mat4(1.0f), position) * glm::rotate(glm::mat4(1.0f), (float)i, { 0.0f, 0.0f, 1.0f });
+		}
+		return transforms;
+	}
+
+	static void BM_Renderer2DQuads(State& state)
+	{
+		std::vector<glm::mat4> transforms = MakeTransforms((size_t)state.range(0));
+		EditorCamera camera(30.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+		glm::vec4 color = { 0.8f, 0.2f, 0.3f, 1.0f };
+
+		for (auto _ : state)
+		{
+			Renderer2D::ResetStats();
+			Renderer2D::BeginScene(camera);
+			for (size_t i = 0; i < transforms.size(); i++)
+				Renderer2D::DrawQuad(transforms[i], color, (int)i);
+			Renderer2D::EndScene();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		state.SetLabel(std::to_string(Renderer2D::GetStats().DrawCalls) + " draw calls");
+	}
+	BENCHMARK(BM_Renderer2DQuads)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(TimeUnit::Microsecond);
+
+	static void BM_Renderer2DCircles(State& state)
+	{
+		std::vector<glm::mat4> transforms = MakeTransforms((size_t)state.range(0));
+		EditorCamera camera(30.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+		glm::vec4 color = { 0.2f, 0.8f, 0.3f, 1.0f };
+
+		for (auto _ : state)
+		{
+			Renderer2D::ResetStats();
+			Renderer2D::BeginScene(camera);
+			for (size_t i = 0; i < transforms.size(); i++)
+				Renderer2D::DrawCircle(transforms[i], color, 1.0f, 0.005f, (int)i);
+			Renderer2D::EndScene();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_Renderer2DCircles)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(TimeUnit::Microsecond);
+}
@@ -0,0 +1,69 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "SceneFixtures.h"
+#include "Core/FrameAllocator.h"
+#include "Scene/SceneGenerator.h"
+
+namespace DemoEngine::Bench
+{
+	static void BM_SceneUpdateRuntime(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		scene->SetHeadless(true);
+		scene->OnRuntimeStart();
+
+		for (auto _ : state)
+		{
+			FrameAllocator::BeginFrame();
+			scene->OnUpdateRuntime(1.0f / 60.0f);
+		}
+
+		scene->OnRuntimeStop();
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SceneUpdateRuntime)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(TimeUnit::Microsecond);
+
+	// SceneGenerator's default mix, where falling bodies land on static ones
+	static void BM_SceneUpdateGenerated(State& state)
+	{
+		SceneGeneratorSettings settings;
+		settings.EntityCount = (uint32_t)state.range(0);
+
+		Ref<Scene> scene = CreateRef<Scene>();
+		SceneGenerator::Generate(scene, settings);
+		scene->SetHeadless(true);
+		scene->OnRuntimeStart();
+
+		for (auto _ : state)
+		{
+			FrameAllocator::BeginFrame();
+			scene->OnUpdateRuntime(1.0f / 60.0f);
+		}
+
+		scene->OnRuntimeStop();
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SceneUpdateGenerated)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(TimeUnit::Microsecond);
+
+	static void BM_SceneCopyTo(State& state)
+	{
+		Ref<Scene> source = CreateBenchmarkScene((size_t)state.range(0));
+
+		for (auto _ : state)
+		{
+			state.PauseTiming();
+			Ref<Scene> destination = CreateRef<Scene>();
+			state.ResumeTiming();
+
+			Scene::CopyTo(source, destination);
+
+			// Tearing the copy down is not part of CopyTo
+			state.PauseTiming();
+			destination.reset();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SceneCopyTo)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(TimeUnit::Microsecond);
+}
@@ -0,0 +1,36 @@
+#include "DemoEngine_PCH.h"
+#include "SceneFixtures.h"
+#include "Scene/Components.h"
+#include "Scene/Entity.h"
+
+namespace DemoEngine::Bench
+{
+	Ref<Scene> CreateBenchmarkScene(size_t count)
+	{
+		Ref<Scene> scene = CreateRef<Scene>();
+
+		SpriteRendererComponent sprite;
+		sprite.Colour = { 0.8f, 0.2f, 0.3f, 1.0f };
+
+		// Spaced so the boxes never touch: every step moves the whole broadphase
+		// without the cost drifting as contacts pile up
+		Rigidbody2DComponent body;
+		body.BodyType = b2_dynamicBody;
+		body.Mass = { 1.0f, { 0.0f, 0.0f }, 0.1f };
+
+		size_t bodyCount = count / 10;
+		scene->CreateEntities(count - bodyCount, "Sprite", sprite);
+		scene->CreateEntities(bodyCount, "Body", sprite, body, BoxCollider2DComponent{});
+
+		size_t index = 0;
+		auto view = scene->GetAllEntitiesWith<TransformComponent>();
+		for (auto entity : view)
+		{
+			auto& transform = view.get<TransformComponent>(entity);
+			transform.Translation = { (float)(index % 1000) * 2.0f, (float)(index / 1000) * 2.0f, 0.0f };
+			index++;
+		}
+
+		return scene;
+	}
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "Scene/Scene.h"
+
+namespace DemoEngine::Bench
+{
+	// count entities laid out on a grid: nine in ten are sprites, the rest falling physics boxes
+	Ref<Scene> CreateBenchmarkScene(size_t count);
+}
@@ -0,0 +1,84 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "SceneFixtures.h"
+#include "Scene/SceneSerialiser.h"
+#include <filesystem>
+
+namespace DemoEngine::Bench
+{
+	// range(1) picks the format: 0 for YAML, 1 for binary
+	static std::string GetScenePath(const State& state)
+	{
+		const char* extension = state.range(1) ? SceneSerialiser::BinaryExtension : SceneSerialiser::TextExtension;
+		return (std::filesystem::temp_directory_path() / ("DemoEngineBench_" + std::to_string(state.range(0)) + extension)).string();
+	}
+
+	static void BM_SceneSerialise(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		std::string path = GetScenePath(state);
+
+		for (auto _ : state)
+			SceneSerialiser(scene).Serialise(path);
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		state.SetBytesProcessed(state.iterations() * (int64_t)std::filesystem::file_size(path));
+		std::filesystem::remove(path);
+	}
+	BENCHMARK(BM_SceneSerialise)->Args({ 1000, 0 })->Args({ 10000, 0 })->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 100000, 1 })->Unit(TimeUnit::Millisecond);
+
+	static void BM_SceneDeserialise(State& state)
+	{
+		std::string path = GetScenePath(state);
+		SceneSerialiser(CreateBenchmarkScene((size_t)state.range(0))).Serialise(path);
+
+		for (auto _ : state)
+		{
+			state.PauseTiming();
+			Ref<Scene> scene = CreateRef<Scene>();
+			state.ResumeTiming();
+
+			if (!SceneSerialiser(scene).Deserialise(path))
+			{
+				state.SkipWithError("Could not deserialise '" + path + "'");
+				break;
+			}
+
+			state.PauseTiming();
+			scene.reset();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		state.SetBytesProcessed(state.iterations() * (int64_t)std::filesystem::file_size(path));
+		std::filesystem::remove(path);
+	}
+	BENCHMARK(BM_SceneDeserialise)->Args({ 1000, 0 })->Args({ 10000, 0 })->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 100000, 1 })->Unit(TimeUnit::Millisecond);
+
+	// Save and load back, as the editor does when switching scenes
+	static void BM_SceneRoundTrip(State& state)
+	{
+		Ref<Scene> source = CreateBenchmarkScene((size_t)state.range(0));
+		std::string path = GetScenePath(state);
+
+		for (auto _ : state)
+		{
+			SceneSerialiser(source).Serialise(path);
+
+			Ref<Scene> loaded = CreateRef<Scene>();
+			if (!SceneSerialiser(loaded).Deserialise(path))
+			{
+				state.SkipWithError("Could not deserialise '" + path + "'");
+				break;
+			}
+
+			state.PauseTiming();
+			loaded.reset();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		std::filesystem::remove(path);
+	}
+	BENCHMARK(BM_SceneRoundTrip)->Args({ 1000, 0 })->Args({ 10000, 0 })->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 100000, 1 })->Unit(TimeUnit::Millisecond);
+}
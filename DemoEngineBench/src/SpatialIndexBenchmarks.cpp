@@ -0,0 +1,177 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "SceneFixtures.h"
+#include "Scene/Components.h"
+#include "Scene/SpatialIndex.h"
+#include <random>
+
+namespace DemoEngine::Bench
+{
+	// CreateBenchmarkScene lays entities out 1000 to a row, 2 units apart
+	static glm::vec2 GetSceneExtent(size_t count)
+	{
+		return { 2000.0f, (float)((count + 999) / 1000) * 2.0f };
+	}
+
+	static std::vector<glm::vec2> GetRandomPoints(size_t count, const glm::vec2& extent)
+	{
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> x(0.0f, extent.x), y(0.0f, extent.y);
+
+		std::vector<glm::vec2> points(count);
+		for (glm::vec2& point : points)
+			point = { x(random), y(random) };
+		return points;
+	}
+
+	// What a query costs without the index: every transform, every time
+	static void ScanRect(const Ref<Scene>& scene, const glm::vec2& min, const glm::vec2& max, std::vector<entt::entity>& results)
+	{
+		results.clear();
+		auto view = scene->GetAllEntitiesWith<TransformComponent>();
+		for (auto entity : view)
+		{
+			glm::mat4 transform = view.get<TransformComponent>(entity).GetTransform();
+
+			glm::vec2 boundsMin = glm::vec2(FLT_MAX), boundsMax = glm::vec2(-FLT_MAX);
+			for (const glm::vec2& corner : { glm::vec2(-0.5f, -0.5f), glm::vec2(0.5f, -0.5f), glm::vec2(0.5f, 0.5f), glm::vec2(-0.5f, 0.5f) })
+			{
+				glm::vec2 world = glm::vec2(transform * glm::vec4(corner, 0.0f, 1.0f));
+				boundsMin = glm::min(boundsMin, world);
+				boundsMax = glm::max(boundsMax, world);
+			}
+
+			if (boundsMin.x <= max.x && boundsMax.x >= min.x && boundsMin.y <= max.y && boundsMax.y >= min.y)
+				results.push_back(entity);
+		}
+	}
+
+	static void BM_SpatialIndexBuild(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+
+		for (auto _ : state)
+		{
+			Scope<SpatialIndex> index = CreateScope<SpatialIndex>(scene->m_Registry);
+			index->Update();
+
+			state.PauseTiming();
+			index.reset();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SpatialIndexBuild)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(TimeUnit::Millisecond);
+
+	// A 20x20 window, about what a zoomed-in viewport or a marquee covers
+	static void BM_SpatialIndexQueryRect(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		SpatialIndex& index = scene->GetSpatialIndex();
+		index.Update(); // Built outside the timed loop, so the first iteration isn't the whole build
+		std::vector<glm::vec2> centres = GetRandomPoints(1024, GetSceneExtent((size_t)state.range(0)));
+
+		std::vector<entt::entity> results;
+		size_t next = 0;
+		for (auto _ : state)
+		{
+			index.QueryRect(centres[next] - 10.0f, centres[next] + 10.0f, results);
+			DoNotOptimize(results.data());
+			next = (next + 1) % centres.size();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialIndexQueryRect)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(TimeUnit::Microsecond);
+
+	static void BM_SpatialScanQueryRect(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		std::vector<glm::vec2> centres = GetRandomPoints(1024, GetSceneExtent((size_t)state.range(0)));
+
+		std::vector<entt::entity> results;
+		size_t next = 0;
+		for (auto _ : state)
+		{
+			ScanRect(scene, centres[next] - 10.0f, centres[next] + 10.0f, results);
+			DoNotOptimize(results.data());
+			next = (next + 1) % centres.size();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialScanQueryRect)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(TimeUnit::Microsecond);
+
+	static void BM_SpatialIndexQueryPoint(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		SpatialIndex& index = scene->GetSpatialIndex();
+		index.Update(); // Built outside the timed loop, so the first iteration isn't the whole build
+		std::vector<glm::vec2> points = GetRandomPoints(1024, GetSceneExtent((size_t)state.range(0)));
+
+		std::vector<entt::entity> results;
+		size_t next = 0;
+		for (auto _ : state)
+		{
+			index.QueryPoint(points[next], results);
+			DoNotOptimize(results.data());
+			next = (next + 1) % points.size();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialIndexQueryPoint)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+	static void BM_SpatialScanQueryPoint(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		std::vector<glm::vec2> points = GetRandomPoints(1024, GetSceneExtent((size_t)state.range(0)));
+
+		// Bounds only; the shape test after it is the same for both
+		std::vector<entt::entity> results;
+		size_t next = 0;
+		for (auto _ : state)
+		{
+			ScanRect(scene, points[next], points[next], results);
+			DoNotOptimize(results.data());
+			next = (next + 1) % points.size();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialScanQueryPoint)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(TimeUnit::Microsecond);
+
+	// A tenth of the scene moves each frame, alternately within and beyond the fat margin
+	static void BM_SpatialIndexUpdate(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		SpatialIndex& index = scene->GetSpatialIndex();
+		index.Update();
+
+		std::vector<entt::entity> moving;
+		auto view = scene->GetAllEntitiesWith<TransformComponent>();
+		for (auto entity : view)
+		{
+			if (moving.size() * 10 < (size_t)state.range(0))
+				moving.push_back(entity);
+		}
+
+		// Steps that return to the start, so the tree never drifts between runs
+		const float steps[] = { 0.05f, -0.05f, 1.0f, -1.0f };
+		size_t frame = 0;
+		for (auto _ : state)
+		{
+			state.PauseTiming();
+			float offset = steps[frame++ % 4];
+			for (entt::entity entity : moving)
+				scene->m_Registry.patch<TransformComponent>(entity, [offset](TransformComponent& transform) { transform.Translation.x += offset; });
+			state.ResumeTiming();
+
+			index.Update();
+		}
+
+		state.SetItemsProcessed(state.iterations() * (int64_t)moving.size());
+	}
+	BENCHMARK(BM_SpatialIndexUpdate)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(TimeUnit::Millisecond);
+}
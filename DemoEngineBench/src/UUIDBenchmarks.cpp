@@ -0,0 +1,56 @@
+#include "DemoEngine_PCH.h"
+#include "Benchmark.h"
+#include "SceneFixtures.h"
+#include "Scene/Entity.h"
+#include <random>
+
+namespace DemoEngine::Bench
+{
+	static std::vector<UUID> GetShuffledIDs(const Ref<Scene>& scene)
+	{
+		std::vector<UUID> ids;
+		auto view = scene->GetAllEntitiesWith<IDComponent>();
+		for (auto entity : view)
+			ids.push_back(view.get<IDComponent>(entity).ID);
+
+		// Random order defeats any locality between creation order and table layout
+		std::shuffle(ids.begin(), ids.end(), std::mt19937_64(1234));
+		return ids;
+	}
+
+	static void BM_UUIDLookupHit(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+		std::vector<UUID> ids = GetShuffledIDs(scene);
+
+		size_t next = 0;
+		for (auto _ : state)
+		{
+			Entity entity = scene->GetEntityByUUID(ids[next]);
+			DoNotOptimize(entity);
+			next = next + 1 == ids.size() ? 0 : next + 1;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_UUIDLookupHit)->Arg(1000)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+	static void BM_UUIDLookupMiss(State& state)
+	{
+		Ref<Scene> scene = CreateBenchmarkScene((size_t)state.range(0));
+
+		// UUID() is random; a collision with the scene is astronomically unlikely
+		std::vector<UUID> ids(4096);
+
+		size_t next = 0;
+		for (auto _ : state)
+		{
+			Entity entity = scene->GetEntityByUUID(ids[next]);
+			DoNotOptimize(entity);
+			next = (next + 1) & (ids.size() - 1);
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_UUIDLookupMiss)->Arg(1000)->Arg(100000);
+}
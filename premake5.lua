@@ -117,4 +117,148 @@ project "DemoEngine"
 		filter "configurations:Dist"
 			runtime "Release"
 			optimize "on"
-			symbols "Off"
\ No newline at end of file
+			symbols "Off"
+			defines { "DEMOENGINE_PROFILE=0", "DEMOENGINE_LOG_LEVEL=2" } -- Warnings and up
+
+-- Headless benchmarks (renderer on the null backend, scene, physics, serialisation).
+-- Builds the engine sources directly; the editor's main is left out.
+project "DemoEngineBench"
+	location "DemoEngineBench"
+	kind "ConsoleApp"
+	language "C++"
+	staticruntime "on"
+	cppdialect "C++17"
+
+	targetdir ("bin/"..outputdir.."/%{prj.name}")
+	objdir ("bin-int/"..outputdir.."/%{prj.name}")
+
+	pchheader "DemoEngine_PCH.h"
+	pchsource "DemoEngine/src/DemoEngine_PCH.cpp"
+
+		files
+		{
+			"%{prj.name}/src/**.h",
+			"%{prj.name}/src/**.cpp",
+			"DemoEngine/src/**.h",
+			"DemoEngine/src/**.cpp",
+			"%{IncludeDir.IMGUIZMO}/**.h",
+			"%{IncludeDir.IMGUIZMO}/**.cpp",
+		}
+
+		removefiles
+		{
+			"DemoEngine/src/Editor/DemoEngineApp.cpp"
+		}
+
+		defines
+		{
+			"_CRT_SECURE_NO_WARNINGS",
+			"YAML_CPP_STATIC_DEFINE"
+		}
+
+		includedirs
+		{
+			"%{prj.name}/src/",
+			"DemoEngine/src/",
+			"DemoEngine/Middleware",
+			"%{IncludeDir.GLFW}",
+			"%{IncludeDir.Glad}",
+			"%{IncludeDir.spdlog}",
+			"%{IncludeDir.glm}",
+			"%{IncludeDir.IMGUI}",
+			"%{IncludeDir.enTT}",
+			"%{IncludeDir.IMGUIZMO}",
+			"%{IncludeDir.YAMLCPP}",
+			"%{IncludeDir.Box2D}",
+			"%{IncludeDir.SoLoud}",
+			"%{IncludeDir.ENet}",
+		}
+
+		links
+		{
+			"GLFW",
+			"Glad",
+			"IMGUI",
+			"YAML-CPP",
+			"Box2D",
+			"SoLoud",
+			"ENet"
+		}
+
+		filter "files:DemoEngine/Middleware/ImGuizmo/**.cpp"
+			flags{"NoPCH"}
+
+		filter "system:windows"
+			systemversion "latest"
+			buildoptions {"/utf-8"}
+			defines { "GLFW_INCLUDE_NONE" }
+
+		filter "configurations:Debug"
+			staticruntime "off"
+			runtime "Debug"
+			symbols "On"
+
+		filter "configurations: Release"
+			staticruntime "off"
+			runtime "Release"
+			optimize "on"
+
+		filter "configurations:Dist"
+			runtime "Release"
+			optimize "on"
+			symbols "Off"
+			defines { "DEMOENGINE_PROFILE=0", "DEMOENGINE_LOG_LEVEL=2" }
+
+
+-- Compares DemoEngineBench result files and fails on regressions; only needs yaml-cpp
+project "BenchCompare"
+	location "BenchCompare"
+	kind "ConsoleApp"
+	language "C++"
+	staticruntime "on"
+	cppdialect "C++17"
+
+	targetdir ("bin/"..outputdir.."/%{prj.name}")
+	objdir ("bin-int/"..outputdir.."/%{prj.name}")
+
+		files
+		{
+			"%{prj.name}/src/**.h",
+			"%{prj.name}/src/**.cpp",
+		}
+
+		defines
+		{
+			"_CRT_SECURE_NO_WARNINGS",
+			"YAML_CPP_STATIC_DEFINE"
+		}
+
+		includedirs
+		{
+			"%{prj.name}/src/",
+			"%{IncludeDir.YAMLCPP}",
+		}
+
+		links
+		{
+			"YAML-CPP"
+		}
+
+		filter "system:windows"
+			systemversion "latest"
+			buildoptions {"/utf-8"}
+
+		filter "configurations:Debug"
+			staticruntime "off"
+			runtime "Debug"
+			symbols "On"
+
+		filter "configurations: Release"
+			staticruntime "off"
+			runtime "Release"
+			optimize "on"
+
+		filter "configurations:Dist"
+			runtime "Release"
+			optimize "on"
+			symbols "Off"